@@ -338,6 +338,7 @@ namespace Assets
 				, TrianglesSource(Shapes::ChristmasStar::Triangles)
 				, AlbedoSource()
 			{
+				BoundingRadius = Shapes::ChristmasStar::BoundingRadius;
 			}
 		};
 
@@ -374,6 +375,7 @@ namespace Assets
 				, TrianglesSource(Shapes::ChristmasGlobes::Triangles)
 				, AlbedoSource(Assets::ChristmasGlobes::Pallete, Shapes::ChristmasGlobes::Group)
 			{
+				BoundingRadius = Shapes::ChristmasGlobes::BoundingRadius;
 			}
 		};
 
@@ -416,6 +418,7 @@ namespace Assets
 				, TrianglesSource(Shapes::ChristmasLeaves::Triangles)
 				, NormalSource(Shapes::ChristmasLeaves::VertexNormals)
 			{
+				BoundingRadius = Shapes::ChristmasLeaves::BoundingRadius;
 			}
 		};
 
@@ -457,6 +460,7 @@ namespace Assets
 				, TrianglesSource(Shapes::ChristmasTrunk::Triangles)
 				, NormalSource(Shapes::ChristmasTrunk::VertexNormals)
 			{
+				BoundingRadius = Shapes::ChristmasTrunk::BoundingRadius;
 			}
 		};
 
@@ -496,6 +500,7 @@ namespace Assets
 					Assets::ChristmasPresent::GetAlbedos(palleteIndex), Shapes::ChristmasPresent::Group)
 				, MaterialSource(Assets::ChristmasPresent::Materials, Shapes::ChristmasPresent::Group)
 			{
+				Base::BoundingRadius = Shapes::ChristmasPresent::BoundingRadius;
 			}
 		};
 
@@ -532,6 +537,7 @@ namespace Assets
 				, VerticesSource(Shapes::ChristmasTree::Vertices)
 				, TrianglesSource(Shapes::ChristmasTree::Triangles)
 			{
+				BoundingRadius = Shapes::ChristmasTree::BoundingRadius;
 			}
 
 			void SetAlbedo(const Rgb8::color_t color)
@@ -630,7 +636,7 @@ namespace Assets
 				}
 			}
 
-			virtual bool WorldShade(const frustum_t& frustum, const uint16_t primitiveIndex)
+			virtual bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex)
 			{
 				if (primitiveIndex >= VertexCount)
 					return true;
@@ -647,7 +653,7 @@ namespace Assets
 				return false;
 			}
 
-			virtual bool ScreenShade(const uint16_t primitiveIndex)
+			virtual bool ScreenShade(const primitive_index_t primitiveIndex)
 			{
 				if (primitiveIndex >= VertexCount)
 					return true;
@@ -668,7 +674,7 @@ namespace Assets
 				}
 			}
 
-			virtual void FragmentShade(WindowRasterizer& rasterizer, const uint16_t primitiveIndex)
+			virtual void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex)
 			{
 				if (FragmentShader == nullptr || AlbedoSource == nullptr)
 					return;
@@ -732,6 +738,7 @@ namespace Assets
 					NormalSource,
 					UvsSource)
 			{
+				BoundingRadius = Shapes::ChristmasCarpet::BoundingRadius;
 			}
 
 			virtual void FragmentCollect(FragmentCollector& fragmentCollector) override
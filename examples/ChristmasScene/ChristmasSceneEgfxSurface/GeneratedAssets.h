@@ -160,6 +160,8 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(251)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{0, 1, 2},
@@ -501,6 +503,8 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(244)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{0, 1, 2},
@@ -796,6 +800,8 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(51)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{0, 1, 2},
@@ -922,6 +928,8 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(276)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{0, 1, 2},
@@ -1300,6 +1308,8 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(171)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{0, 1, 2},
@@ -2806,6 +2816,8 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(222)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{3, 1, 0},
@@ -3668,6 +3680,8 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(56)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{1, 2, 3},
@@ -3891,6 +3905,8 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(123)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{2, 3, 0},
@@ -4033,6 +4049,8 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(195)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{3, 6, 4},
@@ -0,0 +1,192 @@
+/*
+* Integer World asset pack round-trip check.
+* Packs every shape in Assets/Shapes.h, plus a test palette and texture, writes the pack to file and maps it back.
+* Each chunk is read in place through the static primitive sources and compared against the original arrays.
+* With a pack file argument, lists its chunks instead (e.g. a pack written by scripts/obj_converter).
+*
+* Build (Linux):
+*	g++ -std=c++17 -O2 -I<IntegerWorld>/src -I<IntegerSignal>/src AssetPack.cpp -o AssetPack
+* Usage:
+*	./AssetPack [--list pack.iwpk] [--output roundtrip.iwpk]
+*/
+
+#include "../HostAssetPack.h"
+
+#include <Assets/Shapes.h>
+
+#include <cstdio>
+#include <cstring>
+
+using namespace IntegerWorld;
+
+static constexpr uint16_t TextureMesh = 0xFFFF;
+
+template<typename SourceType, typename element_t, typename Getter>
+static bool CompareArray(const char* name, const SourceType& source, const element_t* expected, const uint32_t expectedCount, const uint32_t packedCount, Getter get)
+{
+	if (packedCount != expectedCount)
+	{
+		printf("    %s: count %u, expected %u\n", name, packedCount, expectedCount);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < expectedCount; i++)
+	{
+		const element_t value = get(source, uint16_t(i));
+		if (memcmp(&value, &expected[i], sizeof(element_t)) != 0)
+		{
+			printf("    %s: element %u differs\n", name, i);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool CompareMesh(const AssetPackReader& reader, const uint16_t mesh, const char* name,
+	const vertex16_t* vertices, const uint32_t vertexCount,
+	const triangle_face_t* triangles, const uint32_t triangleCount,
+	const edge_line_t* edges, const uint32_t edgeCount,
+	const vertex16_t* normals)
+{
+	bool success = true;
+	uint32_t count = 0;
+
+	PrimitiveSources::Vertex::Static::Source vertexSource(reader.GetVertices(mesh, count));
+	success &= CompareArray("Vertices", vertexSource, vertices, vertexCount, count,
+		[](const PrimitiveSources::Vertex::Static::Source& source, const uint16_t i) { return source.GetVertex(i); });
+
+	PrimitiveSources::Triangle::Static::Source triangleSource(reader.GetTriangles(mesh, count));
+	success &= CompareArray("Triangles", triangleSource, triangles, triangleCount, count,
+		[](const PrimitiveSources::Triangle::Static::Source& source, const uint16_t i) { return source.GetTriangle(i); });
+
+	PrimitiveSources::Edge::Static::Source edgeSource(reader.GetEdges(mesh, count));
+	success &= CompareArray("Edges", edgeSource, edges, edgeCount, count,
+		[](const PrimitiveSources::Edge::Static::Source& source, const uint16_t i) { return source.GetEdge(i); });
+
+	if (normals != nullptr)
+	{
+		PrimitiveSources::Normal::Static::Source normalSource(reader.GetFaceNormals(mesh, count));
+		success &= CompareArray("FaceNormals", normalSource, normals, triangleCount, count,
+			[](const PrimitiveSources::Normal::Static::Source& source, const uint16_t i) { return source.GetNormal(i); });
+	}
+
+	printf("  %-12s vertices %3u triangles %3u edges %3u: %s\n", name, vertexCount, triangleCount, edgeCount, success ? "match" : "MISMATCH");
+
+	return success;
+}
+
+static bool RoundTrip(const char* path)
+{
+	namespace Shapes = Assets::Shapes;
+
+	// Test palette and a checker texture.
+	static const Rgb8::color_t Albedos[] = { Rgb8::RED, Rgb8::GREEN, Rgb8::BLUE, Rgb8::WHITE };
+	static Rgb8::color_t Texels[TextureSize16x16::Width * TextureSize16x16::Height]{};
+	for (uint16_t i = 0; i < TextureSize16x16::Width * TextureSize16x16::Height; i++)
+	{
+		Texels[i] = (((i / TextureSize16x16::Width) ^ i) & 1) ? Rgb8::WHITE : Rgb8::BLACK;
+	}
+
+	HostAssetPack::Writer writer{};
+	writer.AddChunk(AssetPackChunkEnum::Vertices, 0, Shapes::Cube::Vertices, Shapes::Cube::VertexCount);
+	writer.AddChunk(AssetPackChunkEnum::Triangles, 0, Shapes::Cube::Triangles, Shapes::Cube::TriangleCount);
+	writer.AddChunk(AssetPackChunkEnum::Edges, 0, Shapes::Cube::Edges, Shapes::Cube::EdgeCount);
+	writer.AddChunk(AssetPackChunkEnum::FaceNormals, 0, Shapes::Cube::Normals, Shapes::Cube::TriangleCount);
+	writer.AddChunk(AssetPackChunkEnum::Albedos, 0, Albedos, sizeof(Albedos) / sizeof(Rgb8::color_t));
+	writer.AddChunk(AssetPackChunkEnum::Vertices, 1, Shapes::Octahedron::Vertices, Shapes::Octahedron::VertexCount);
+	writer.AddChunk(AssetPackChunkEnum::Triangles, 1, Shapes::Octahedron::Triangles, Shapes::Octahedron::TriangleCount);
+	writer.AddChunk(AssetPackChunkEnum::Edges, 1, Shapes::Octahedron::Edges, Shapes::Octahedron::EdgeCount);
+	writer.AddChunk(AssetPackChunkEnum::Vertices, 2, Shapes::Icosahedron::Vertices, Shapes::Icosahedron::VertexCount);
+	writer.AddChunk(AssetPackChunkEnum::Triangles, 2, Shapes::Icosahedron::Triangles, Shapes::Icosahedron::TriangleCount);
+	writer.AddChunk(AssetPackChunkEnum::Edges, 2, Shapes::Icosahedron::Edges, Shapes::Icosahedron::EdgeCount);
+	writer.AddChunk(AssetPackChunkEnum::Texture, TextureMesh, Texels, TextureSize16x16::Width * TextureSize16x16::Height,
+		uint8_t(uint8_t(TextureDimensionEnum::Dimension16) | (uint8_t(TextureDimensionEnum::Dimension16) << 4)));
+
+	if (!writer.Write(path))
+	{
+		printf("Failed to write %s.\n", path);
+		return false;
+	}
+
+	HostAssetPack::MappedFile file{};
+	if (!file.Open(path))
+	{
+		printf("Failed to map %s.\n", path);
+		return false;
+	}
+	const AssetPackReader& reader = file.Reader;
+	printf("Asset pack %s: %u chunks\n", path, reader.GetChunkCount());
+
+	bool success = true;
+	success &= CompareMesh(reader, 0, "Cube",
+		Shapes::Cube::Vertices, Shapes::Cube::VertexCount,
+		Shapes::Cube::Triangles, Shapes::Cube::TriangleCount,
+		Shapes::Cube::Edges, Shapes::Cube::EdgeCount,
+		Shapes::Cube::Normals);
+	success &= CompareMesh(reader, 1, "Octahedron",
+		Shapes::Octahedron::Vertices, Shapes::Octahedron::VertexCount,
+		Shapes::Octahedron::Triangles, Shapes::Octahedron::TriangleCount,
+		Shapes::Octahedron::Edges, Shapes::Octahedron::EdgeCount,
+		nullptr);
+	success &= CompareMesh(reader, 2, "Icosahedron",
+		Shapes::Icosahedron::Vertices, Shapes::Icosahedron::VertexCount,
+		Shapes::Icosahedron::Triangles, Shapes::Icosahedron::TriangleCount,
+		Shapes::Icosahedron::Edges, Shapes::Icosahedron::EdgeCount,
+		nullptr);
+
+	uint32_t albedoCount = 0;
+	const Rgb8::color_t* albedos = reader.GetAlbedos(0, albedoCount);
+	const bool albedosMatch = albedos != nullptr
+		&& albedoCount == sizeof(Albedos) / sizeof(Rgb8::color_t)
+		&& memcmp(albedos, Albedos, sizeof(Albedos)) == 0;
+	printf("  %-12s count %u: %s\n", "Albedos", albedoCount, albedosMatch ? "match" : "MISMATCH");
+
+	uint16_t width = 0, height = 0;
+	const Rgb8::color_t* texels = reader.GetTexture(TextureMesh, width, height);
+	bool textureMatch = texels != nullptr && width == TextureSize16x16::Width && height == TextureSize16x16::Height;
+	if (textureMatch)
+	{
+		PrimitiveSources::Texture::Static::Source<TextureSize16x16> textureSource(texels);
+		for (uint16_t v = 0; v < height; v++)
+			for (uint16_t u = 0; u < width; u++)
+				textureMatch &= textureSource.GetTexel(uint8_t(u), uint8_t(v)) == Texels[(v * width) + u];
+	}
+	printf("  %-12s %ux%u: %s\n", "Texture", width, height, textureMatch ? "match" : "MISMATCH");
+
+	return success && albedosMatch && textureMatch;
+}
+
+static bool List(const char* path)
+{
+	HostAssetPack::MappedFile file{};
+	if (!file.Open(path))
+	{
+		printf("Failed to open %s as an asset pack.\n", path);
+		return false;
+	}
+
+	printf("Asset pack %s: %u chunks\n", path, file.Reader.GetChunkCount());
+	for (uint16_t i = 0; i < file.Reader.GetChunkCount(); i++)
+	{
+		const asset_pack_chunk_t* chunk = file.Reader.GetChunk(i);
+		printf("  mesh %5u type %2u parameter %3u count %6u offset %8u\n",
+			chunk->mesh, chunk->type, chunk->parameter, chunk->count, chunk->offset);
+	}
+
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	const char* output = "roundtrip.iwpk";
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		if (strcmp(argv[i], "--list") == 0)
+			return List(argv[i + 1]) ? 0 : 1;
+		else if (strcmp(argv[i], "--output") == 0)
+			output = argv[i + 1];
+	}
+
+	return RoundTrip(output) ? 0 : 1;
+}
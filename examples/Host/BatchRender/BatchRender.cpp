@@ -0,0 +1,380 @@
+/*
+* Integer World offline batch renderer for Linux/macOS hosts.
+* Renders a sequence of frames of the animated demo scene into in-memory frame buffers and writes them as PPM or PNG files.
+* - Animation time is fixed per frame (frame / fps), so every frame renders the same on every run and thread count.
+* - The camera follows a scripted keyframe path.
+* - Independent frames are rendered in parallel, one engine instance per thread.
+* - With --golden, frames are compared against reference PPM files, to be used as an image regression test.
+* - With --threads 1 it is a single-threaded profiling entry point (e.g. for perf record).
+*
+* Build (Linux):
+*	g++ -std=c++17 -O2 -pthread -I<IntegerWorld>/src -I<IntegerSignal>/src -I<TaskScheduler>/src BatchRender.cpp -o BatchRender
+* Usage:
+*	./BatchRender [--width 640] [--height 360] [--frames 60] [--fps 30] [--threads N]
+*		[--output frame_####.png] [--camera path.txt] [--golden golden_####.ppm]
+* Camera path file, one keyframe per line, linearly interpolated between keyframes ('#' starts a comment):
+*	<frame> <x> <y> <z> <pitch degrees> <yaw degrees> <roll degrees>
+*/
+
+#include "../HostPlatform.h"
+#include "../HostImage.h"
+
+#define _TASK_OO_CALLBACKS
+#include <TScheduler.hpp>
+
+#include <IntegerWorld.h>
+#include <IntegerWorldTasks.h>
+#include <IntegerWorldOutputs.h>
+#include <IntegerWorldExperimental.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace IntegerWorld;
+
+using EngineType = EngineRenderTask<AnimatedDemoScene::ObjectsCount, AnimatedDemoScene::MaxDrawCallCount, 16>;
+
+struct render_options_t
+{
+	int16_t Width = 640;
+	int16_t Height = 360;
+	uint32_t Frames = 60;
+	uint32_t Fps = 30;
+	uint8_t Threads = 0;
+	std::string Output{};
+	std::string Camera{};
+	std::string Golden{};
+};
+
+/// <summary>
+/// Camera keyframe, with rotation in degrees.
+/// </summary>
+struct camera_key_t
+{
+	uint32_t Frame;
+	int32_t X, Y, Z;
+	int32_t Pitch, Yaw, Roll;
+};
+
+/// <summary>
+/// Linearly interpolated camera keyframe path.
+/// </summary>
+class CameraPath
+{
+private:
+	std::vector<camera_key_t> Keys{};
+
+public:
+	/// <summary>
+	/// Default path: a slow pan across the scene over the whole sequence.
+	/// </summary>
+	void SetDefault(const uint32_t frames)
+	{
+		static constexpr int32_t Pan = Assets::Shapes::SHAPE_UNIT / 2;
+
+		Keys.clear();
+		Keys.push_back({ 0, -Pan, 0, 0, 0, 4, 0 });
+		Keys.push_back({ frames > 1 ? frames - 1 : 1, Pan, 0, 0, 0, -4, 0 });
+	}
+
+	bool Load(const char* path)
+	{
+		FILE* file = fopen(path, "r");
+		if (file == nullptr)
+			return false;
+
+		Keys.clear();
+		char line[256];
+		while (fgets(line, sizeof(line), file) != nullptr)
+		{
+			char* comment = strchr(line, '#');
+			if (comment != nullptr)
+				*comment = 0;
+
+			camera_key_t key{};
+			unsigned long frame = 0;
+			long x, y, z, pitch, yaw, roll;
+			const int count = sscanf(line, "%lu %ld %ld %ld %ld %ld %ld", &frame, &x, &y, &z, &pitch, &yaw, &roll);
+			if (count == 7)
+			{
+				key = { uint32_t(frame), int32_t(x), int32_t(y), int32_t(z), int32_t(pitch), int32_t(yaw), int32_t(roll) };
+				if (!Keys.empty() && key.Frame <= Keys.back().Frame)
+				{
+					fclose(file);
+					return false;
+				}
+				Keys.push_back(key);
+			}
+			else if (count > 0)
+			{
+				fclose(file);
+				return false;
+			}
+		}
+		fclose(file);
+
+		return !Keys.empty();
+	}
+
+	void Apply(const uint32_t frame, camera_state_t& camera) const
+	{
+		size_t next = 0;
+		while (next < Keys.size() && Keys[next].Frame < frame)
+			next++;
+
+		const camera_key_t& b = Keys[next < Keys.size() ? next : Keys.size() - 1];
+		const camera_key_t& a = Keys[next > 0 ? next - 1 : 0];
+
+		const int32_t span = int32_t(b.Frame) - int32_t(a.Frame);
+		const int32_t step = span > 0 ? LimitValue<int32_t>(int32_t(frame) - int32_t(a.Frame), 0, span) : 0;
+
+		camera.Position.x = int16_t(Lerp(a.X, b.X, step, span));
+		camera.Position.y = int16_t(Lerp(a.Y, b.Y, step, span));
+		camera.Position.z = int16_t(Lerp(a.Z, b.Z, step, span));
+		camera.Rotation.x = Angle(Lerp(a.Pitch * 100, b.Pitch * 100, step, span));
+		camera.Rotation.y = Angle(Lerp(a.Yaw * 100, b.Yaw * 100, step, span));
+		camera.Rotation.z = Angle(Lerp(a.Roll * 100, b.Roll * 100, step, span));
+	}
+
+private:
+	static int32_t Lerp(const int32_t a, const int32_t b, const int32_t step, const int32_t span)
+	{
+		if (span == 0)
+			return a;
+
+		return a + int32_t((int64_t(b - a) * step) / span);
+	}
+
+	static angle_t Angle(const int32_t centiDegrees)
+	{
+		const int32_t wrapped = ((centiDegrees % 36000) + 36000) % 36000;
+
+		return angle_t((int64_t(wrapped) * ANGLE_RANGE) / 36000);
+	}
+};
+
+/// <summary>
+/// Heap-backed frame buffer surface that counts presented frames.
+/// </summary>
+class BatchSurface : public FrameBufferOutput::BufferSurface
+{
+public:
+	uint32_t FrameCount = 0;
+
+public:
+	BatchSurface(std::vector<Rgb8::color_t>& frame, const int16_t width, const int16_t height)
+		: FrameBufferOutput::BufferSurface(frame.data(), width, height)
+	{
+	}
+
+	void FlipSurface() final
+	{
+		FrameCount++;
+	}
+};
+
+/// <summary>
+/// One engine and scene instance, rendering any requested frame on its own thread.
+/// </summary>
+class FrameRenderer
+{
+private:
+	const render_options_t& Options;
+	const CameraPath& Path;
+
+	std::vector<Rgb8::color_t> Frame;
+	BatchSurface Surface;
+	TS::Scheduler Scheduler{};
+	std::unique_ptr<EngineType> Engine;
+	std::unique_ptr<AnimatedDemoScene> Scene;
+
+public:
+	FrameRenderer(const render_options_t& options, const CameraPath& path)
+		: Options(options)
+		, Path(path)
+		, Frame(size_t(options.Width) * options.Height)
+		, Surface(Frame, options.Width, options.Height)
+		, Engine(new EngineType(Scheduler, Surface))
+		, Scene(new AnimatedDemoScene(Scheduler))
+	{
+	}
+
+	bool Start()
+	{
+		HostPlatform::SetFixedClock(0);
+		Engine->Start();
+
+		return Scene->Start(*Engine, Options.Width, Options.Height);
+	}
+
+	void Stop()
+	{
+		Engine->Stop();
+	}
+
+	const Rgb8::color_t* Render(const uint32_t frame)
+	{
+		// Freeze time at the frame's timestamp, then animate and place the camera before the engine starts the frame.
+		HostPlatform::SetFixedClock(uint32_t((uint64_t(frame) * 1000000) / Options.Fps));
+		Scene->Callback();
+		Path.Apply(frame, *Engine->GetCameraControls());
+
+		const uint32_t target = Surface.FrameCount + 1;
+		while (Surface.FrameCount < target)
+		{
+			Scheduler.execute();
+		}
+
+		return Frame.data();
+	}
+};
+
+static void PrintUsage()
+{
+	printf("Usage: BatchRender [--width W] [--height H] [--frames N] [--fps F] [--threads T]\n"
+		"\t[--output frame_####.png|.ppm] [--camera path.txt] [--golden golden_####.ppm]\n");
+}
+
+static bool ParseOptions(const int argc, char** argv, render_options_t& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* option = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+		if (value == nullptr)
+			return false;
+
+		if (strcmp(option, "--width") == 0) options.Width = int16_t(atoi(value));
+		else if (strcmp(option, "--height") == 0) options.Height = int16_t(atoi(value));
+		else if (strcmp(option, "--frames") == 0) options.Frames = uint32_t(atoi(value));
+		else if (strcmp(option, "--fps") == 0) options.Fps = uint32_t(atoi(value));
+		else if (strcmp(option, "--threads") == 0) options.Threads = uint8_t(atoi(value));
+		else if (strcmp(option, "--output") == 0) options.Output = value;
+		else if (strcmp(option, "--camera") == 0) options.Camera = value;
+		else if (strcmp(option, "--golden") == 0) options.Golden = value;
+		else return false;
+		i++;
+	}
+
+	return options.Width > 0 && options.Height > 0 && options.Fps > 0;
+}
+
+int main(int argc, char** argv)
+{
+	render_options_t options{};
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	if (options.Threads == 0)
+		options.Threads = uint8_t(MinValue(255u, MaxValue(1u, std::thread::hardware_concurrency())));
+
+	CameraPath path{};
+	if (options.Camera.empty())
+	{
+		path.SetDefault(options.Frames);
+	}
+	else if (!path.Load(options.Camera.c_str()))
+	{
+		printf("Invalid camera path file: %s\n", options.Camera.c_str());
+		return 2;
+	}
+
+	printf("Integer World batch render %dx%d, %u frames at %u fps, %u threads\n",
+		options.Width, options.Height, options.Frames, options.Fps, options.Threads);
+
+	std::atomic<uint32_t> nextFrame{ 0 };
+	std::atomic<uint32_t> failures{ 0 };
+	std::atomic<uint32_t> mismatches{ 0 };
+	std::mutex printMutex{};
+
+	auto worker = [&]()
+		{
+			FrameRenderer renderer(options, path);
+			if (!renderer.Start())
+			{
+				failures++;
+				return;
+			}
+
+			for (uint32_t frame = nextFrame.fetch_add(1); frame < options.Frames; frame = nextFrame.fetch_add(1))
+			{
+				const Rgb8::color_t* buffer = renderer.Render(frame);
+
+				if (!options.Output.empty())
+				{
+					const std::string file = HostImage::FramePath(options.Output, frame);
+					if (!HostImage::WriteImage(file.c_str(), buffer, options.Width, options.Height))
+					{
+						std::lock_guard<std::mutex> lock(printMutex);
+						printf("Failed to write %s\n", file.c_str());
+						failures++;
+					}
+				}
+
+				if (!options.Golden.empty())
+				{
+					const std::string file = HostImage::FramePath(options.Golden, frame);
+					std::vector<Rgb8::color_t> golden;
+					int16_t width = 0, height = 0;
+					if (!HostImage::ReadPpm(file.c_str(), golden, width, height)
+						|| width != options.Width || height != options.Height)
+					{
+						std::lock_guard<std::mutex> lock(printMutex);
+						printf("Missing or invalid golden image %s\n", file.c_str());
+						failures++;
+						continue;
+					}
+
+					uint32_t different = 0;
+					for (size_t i = 0; i < golden.size(); i++)
+					{
+						// Compare RGB only, PPM has no alpha.
+						if ((golden[i] & 0xFFFFFF) != (buffer[i] & 0xFFFFFF))
+							different++;
+					}
+					if (different > 0)
+					{
+						std::lock_guard<std::mutex> lock(printMutex);
+						printf("Frame %u differs from %s in %u pixels\n", frame, file.c_str(), different);
+						mismatches++;
+					}
+				}
+			}
+
+			renderer.Stop();
+		};
+
+	const auto start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	for (uint_fast8_t i = 1; i < options.Threads; i++)
+	{
+		threads.emplace_back(worker);
+	}
+	worker();
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	printf("Rendered %u frames in %.3f s (%.2f ms per frame)\n", options.Frames, seconds, options.Frames > 0 ? (seconds * 1000.0) / options.Frames : 0.0);
+
+	if (!options.Golden.empty())
+	{
+		printf("Golden comparison: %u of %u frames differ\n", mismatches.load(), options.Frames);
+	}
+
+	return (failures == 0 && mismatches == 0) ? 0 : 1;
+}
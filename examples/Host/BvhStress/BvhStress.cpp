@@ -0,0 +1,200 @@
+/*
+* Integer World headless object culling stress test for large scenes.
+* Renders a field of small octahedra around a panning camera into an in-memory frame buffer,
+* once visiting every object in every stage and once with the ObjectBvh culler selecting the visible objects.
+* Reports frame time and visible objects per frame; every frame of the culled run is checked to be identical.
+*
+* Build (Linux):
+*	g++ -std=c++17 -O2 -I<IntegerWorld>/src -I<IntegerSignal>/src -I<TaskScheduler>/src BvhStress.cpp -o BvhStress
+* Usage:
+*	./BvhStress [objects] [frames]
+*/
+
+#include "../HostPlatform.h"
+#include "../HostSurface.h"
+
+#define _TASK_OO_CALLBACKS
+#include <TScheduler.hpp>
+
+#include <IntegerWorld.h>
+#include <IntegerWorldTasks.h>
+#include <IntegerWorldOutputs.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace IntegerWorld;
+
+static constexpr int16_t Width = 640;
+static constexpr int16_t Height = 360;
+
+static constexpr uint16_t MaxObjectCount = 16384;
+static constexpr uint16_t MaxDrawCallCount = 32768;
+
+using EngineType = EngineRenderTask<MaxObjectCount, MaxDrawCallCount, 64>;
+using BvhType = ObjectBvh<MaxObjectCount>;
+using ShapeObjectType = RenderObjects::Mesh::SimpleStaticMeshTriangleObject<
+	Assets::Shapes::Octahedron::VertexCount,
+	Assets::Shapes::Octahedron::TriangleCount,
+	FrustumCullingEnum::ObjectCulling>;
+
+/// <summary>
+/// Object culler wrapper that accumulates the visible object count.
+/// </summary>
+class CountingCuller : public IObjectCuller
+{
+private:
+	IObjectCuller& Culler;
+
+public:
+	uint64_t VisibleSum = 0;
+
+public:
+	CountingCuller(IObjectCuller& culler)
+		: IObjectCuller()
+		, Culler(culler)
+	{
+	}
+
+	uint16_t CullObjects(IRenderObject* const* objects, const uint16_t objectCount, const frustum_t& frustum, IRenderObject* const*& visibleObjects) final
+	{
+		const uint16_t visibleCount = Culler.CullObjects(objects, objectCount, frustum, visibleObjects);
+		VisibleSum += visibleCount;
+
+		return visibleCount;
+	}
+};
+
+/// <summary>
+/// Square field of spinning octahedra around the origin, with the camera panning around.
+/// Animated by frame number so every run renders the same frames.
+/// </summary>
+class StressScene : public IFrameListener
+{
+private:
+	static constexpr int16_t FieldHalfSize = VERTEX16_UNIT * 3;
+
+private:
+	std::vector<std::unique_ptr<ShapeObjectType>> Shapes{};
+
+	RenderObjects::Background::FillObject Background{};
+	RenderObjects::Background::FragmentShaders::FillShader BackgroundShader{};
+	RenderObjects::Mesh::FragmentShaders::TriangleShade::FillShader TriangleShader{};
+
+	camera_state_t* Camera = nullptr;
+
+	uint32_t Frame = 0;
+
+public:
+	StressScene(const uint16_t objectCount)
+		: IFrameListener()
+	{
+		const uint16_t columns = MaxValue<uint16_t>(1, uint16_t(sqrt(objectCount)));
+		const uint16_t rows = (objectCount + columns - 1) / columns;
+		const int32_t spacing = (int32_t(FieldHalfSize) * 2) / MaxValue<uint16_t>(columns, rows);
+
+		for (uint16_t i = 0; i < objectCount; i++)
+		{
+			ShapeObjectType* shape = new ShapeObjectType(Assets::Shapes::Octahedron::Vertices, Assets::Shapes::Octahedron::Triangles);
+			shape->Translation.x = int16_t(-FieldHalfSize + (int32_t(i % columns) * spacing) + spacing / 2);
+			shape->Translation.y = int16_t(((i * 7919) % 9) * (spacing / 8) - spacing / 2);
+			shape->Translation.z = int16_t(-FieldHalfSize + (int32_t(i / columns) * spacing) + spacing / 2);
+			shape->Resize = Scale16::GetFactor<uint16_t>(spacing, Assets::Shapes::SHAPE_UNIT * 4);
+			shape->BoundingRadius = Assets::Shapes::Octahedron::BoundingRadius;
+			shape->SetAlbedo(Rgb8::ColorHsvFraction(UFraction16::GetScalar<uint16_t>(i, objectCount), UFRACTION16_1X, UFRACTION16_1X));
+			shape->FragmentShader = &TriangleShader;
+			Shapes.emplace_back(shape);
+		}
+
+		Background.Color = Rgb8::BLACK;
+		Background.FragmentShader = &BackgroundShader;
+	}
+
+	bool Start(EngineType& engine)
+	{
+		engine.ClearObjects();
+		if (!engine.AddObject(&Background))
+			return false;
+
+		for (auto& shape : Shapes)
+		{
+			if (!engine.AddObject(shape.get()))
+				return false;
+		}
+
+		engine.SetFov((uint32_t(UFRACTION16_1X) * 30) / 100);
+		Camera = engine.GetCameraControls();
+		engine.SetFrameListener(this);
+
+		return true;
+	}
+
+	void OnFrameStart() final
+	{
+		Camera->Position = { 0, int16_t(VERTEX16_UNIT / 8), 0 };
+		Camera->Rotation = { 0, angle_t(Frame * 512), 0 };
+
+		for (size_t i = 0; i < Shapes.size(); i++)
+		{
+			Shapes[i]->Rotation.x = angle_t(Frame * 97 + i * 331);
+			Shapes[i]->Rotation.y = angle_t(Frame * 193 + i * 89);
+		}
+		Frame++;
+	}
+};
+
+static bool RunStress(const uint16_t objectCount, const uint32_t frames, BvhType* bvh, std::vector<uint32_t>& referenceHashes)
+{
+	std::vector<Rgb8::color_t> frame(size_t(Width) * Height);
+	HostSurface::HashingSurface surface(frame, Width, Height);
+
+	TS::Scheduler scheduler;
+	std::unique_ptr<EngineType> engine(new EngineType(scheduler, surface));
+	std::unique_ptr<StressScene> scene(new StressScene(objectCount));
+
+	std::unique_ptr<CountingCuller> culler(bvh != nullptr ? new CountingCuller(*bvh) : nullptr);
+	engine->SetObjectCuller(culler.get());
+	engine->Start();
+	if (!scene->Start(*engine))
+	{
+		printf("Failed to add %u objects.\n", objectCount);
+		return false;
+	}
+
+	const double frameMillis = HostSurface::RenderFrames(scheduler, surface, frames);
+	engine->Stop();
+
+	bool match = true;
+	if (bvh == nullptr)
+	{
+		referenceHashes = surface.FrameHashes;
+		printf("    all objects: frame %8.3f ms, objects per frame %6u\n", frameMillis, objectCount + 1);
+	}
+	else
+	{
+		match = surface.MatchesHashes(referenceHashes);
+		printf("     ObjectBvh: frame %8.3f ms, objects per frame %6u, nodes %u, %s\n", frameMillis,
+			uint32_t(culler->VisibleSum / frames), bvh->GetNodeCount(),
+			match ? "match" : "MISMATCH");
+	}
+
+	return match;
+}
+
+int main(int argc, char** argv)
+{
+	const uint16_t objects = argc > 1 ? uint16_t(MinValue(atoi(argv[1]), int(MaxObjectCount - 1))) : 10000;
+	const uint32_t frames = argc > 2 ? uint32_t(atoi(argv[2])) : 32;
+
+	printf("Integer World object culling stress test %dx%d, %u objects, %u frames (ms per frame)\n", Width, Height, objects, frames);
+
+	std::vector<uint32_t> referenceHashes{};
+	std::unique_ptr<BvhType> bvh(new BvhType());
+
+	bool success = RunStress(objects, frames, nullptr, referenceHashes);
+	success &= RunStress(objects, frames, bvh.get(), referenceHashes);
+
+	return success ? 0 : 1;
+}
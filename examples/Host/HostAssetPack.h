@@ -0,0 +1,192 @@
+/*
+* Asset pack helpers for IntegerWorld host programs (Linux/macOS).
+* Builds packs in memory and writes them to file, and memory-maps pack files read-only for AssetPackReader.
+*/
+
+#ifndef _INTEGER_WORLD_HOST_ASSET_PACK_h
+#define _INTEGER_WORLD_HOST_ASSET_PACK_h
+
+#include <IntegerWorld.h>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace HostAssetPack
+{
+	using namespace IntegerWorld;
+
+	/// <summary>
+	/// Collects chunks and lays them out as an asset pack.
+	/// </summary>
+	class Writer
+	{
+	private:
+		struct pending_chunk_t
+		{
+			asset_pack_chunk_t Chunk;
+			std::vector<uint8_t> Bytes;
+		};
+
+		std::vector<pending_chunk_t> Chunks{};
+
+	public:
+		/// <summary>
+		/// Adds a chunk of count elements, copied from data.
+		/// </summary>
+		/// <returns>False for unknown chunk types.</returns>
+		bool AddChunk(const AssetPackChunkEnum type, const uint16_t mesh, const void* data, const uint32_t count, const uint8_t parameter = 0)
+		{
+			const uint32_t elementSize = AssetPackReader::GetElementSize(type);
+			if (elementSize == 0)
+				return false;
+
+			pending_chunk_t pending{};
+			pending.Chunk.type = static_cast<uint8_t>(type);
+			pending.Chunk.parameter = parameter;
+			pending.Chunk.mesh = mesh;
+			pending.Chunk.count = count;
+			pending.Bytes.resize(size_t(count) * elementSize);
+			if (count > 0)
+			{
+				memcpy(pending.Bytes.data(), data, pending.Bytes.size());
+			}
+			Chunks.push_back(pending);
+
+			return true;
+		}
+
+		/// <summary>
+		/// Pack bytes: header, chunk table, then aligned chunk data in insertion order.
+		/// </summary>
+		std::vector<uint8_t> GetBytes() const
+		{
+			uint32_t offset = Align(uint32_t(sizeof(asset_pack_header_t) + (Chunks.size() * sizeof(asset_pack_chunk_t))));
+
+			std::vector<asset_pack_chunk_t> table{};
+			for (const auto& pending : Chunks)
+			{
+				asset_pack_chunk_t chunk = pending.Chunk;
+				chunk.offset = offset;
+				table.push_back(chunk);
+				offset = Align(offset + uint32_t(pending.Bytes.size()));
+			}
+
+			asset_pack_header_t header{};
+			header.magic = AssetPack::Magic;
+			header.version = AssetPack::Version;
+			header.chunkCount = uint16_t(Chunks.size());
+			header.size = offset;
+
+			std::vector<uint8_t> bytes(offset, 0);
+			memcpy(bytes.data(), &header, sizeof(header));
+			if (!table.empty())
+			{
+				memcpy(bytes.data() + sizeof(header), table.data(), table.size() * sizeof(asset_pack_chunk_t));
+			}
+			for (size_t i = 0; i < Chunks.size(); i++)
+			{
+				if (!Chunks[i].Bytes.empty())
+				{
+					memcpy(bytes.data() + table[i].offset, Chunks[i].Bytes.data(), Chunks[i].Bytes.size());
+				}
+			}
+
+			return bytes;
+		}
+
+		bool Write(const char* path) const
+		{
+			const std::vector<uint8_t> bytes = GetBytes();
+
+			FILE* file = fopen(path, "wb");
+			if (file == nullptr)
+				return false;
+
+			const bool success = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+			fclose(file);
+
+			return success;
+		}
+
+	private:
+		static uint32_t Align(const uint32_t offset)
+		{
+			return (offset + AssetPack::Alignment - 1) & ~uint32_t(AssetPack::Alignment - 1);
+		}
+	};
+
+	/// <summary>
+	/// Read-only memory-mapped pack file. Arrays from Reader point into the mapping and stay valid until Close.
+	/// </summary>
+	class MappedFile
+	{
+	private:
+		void* Mapping = nullptr;
+		size_t MappingSize = 0;
+
+	public:
+		AssetPackReader Reader{};
+
+	public:
+		MappedFile() {}
+
+		~MappedFile()
+		{
+			Close();
+		}
+
+		/// <summary>
+		/// Maps the file and validates the pack.
+		/// </summary>
+		bool Open(const char* path)
+		{
+			Close();
+
+			const int descriptor = open(path, O_RDONLY);
+			if (descriptor < 0)
+				return false;
+
+			struct stat status {};
+			if (fstat(descriptor, &status) != 0
+				|| status.st_size <= 0
+				|| uint64_t(status.st_size) > UINT32_MAX)
+			{
+				close(descriptor);
+				return false;
+			}
+
+			void* mapping = mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+			close(descriptor);
+			if (mapping == MAP_FAILED)
+				return false;
+
+			Mapping = mapping;
+			MappingSize = size_t(status.st_size);
+			if (!Reader.Open(Mapping, uint32_t(MappingSize)))
+			{
+				Close();
+				return false;
+			}
+
+			return true;
+		}
+
+		void Close()
+		{
+			Reader.Close();
+			if (Mapping != nullptr)
+			{
+				munmap(Mapping, MappingSize);
+				Mapping = nullptr;
+				MappingSize = 0;
+			}
+		}
+	};
+}
+#endif
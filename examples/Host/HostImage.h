@@ -0,0 +1,226 @@
+/*
+* Minimal image file helpers for IntegerWorld host programs.
+* Writes Rgb8 frame buffers as binary PPM (P6) or uncompressed PNG, and reads binary PPM back for comparison.
+* No external dependencies.
+*/
+
+#ifndef _INTEGER_WORLD_HOST_IMAGE_h
+#define _INTEGER_WORLD_HOST_IMAGE_h
+
+#include <IntegerWorld.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace HostImage
+{
+	using namespace IntegerWorld;
+
+	/// <summary>
+	/// Writes the buffer as a binary PPM (P6) file.
+	/// </summary>
+	inline bool WritePpm(const char* path, const Rgb8::color_t* buffer, const int16_t width, const int16_t height)
+	{
+		FILE* file = fopen(path, "wb");
+		if (file == nullptr)
+			return false;
+
+		fprintf(file, "P6\n%d %d\n255\n", width, height);
+
+		std::vector<uint8_t> row(size_t(width) * 3);
+		for (int_fast16_t y = 0; y < height; y++)
+		{
+			for (int_fast16_t x = 0; x < width; x++)
+			{
+				const Rgb8::color_t color = buffer[uint32_t(y) * width + x];
+				row[x * 3 + 0] = Rgb8::Red(color);
+				row[x * 3 + 1] = Rgb8::Green(color);
+				row[x * 3 + 2] = Rgb8::Blue(color);
+			}
+			fwrite(row.data(), 1, row.size(), file);
+		}
+
+		return fclose(file) == 0;
+	}
+
+	/// <summary>
+	/// Reads a binary PPM (P6, 8 bit) file into an opaque Rgb8 buffer.
+	/// </summary>
+	inline bool ReadPpm(const char* path, std::vector<Rgb8::color_t>& buffer, int16_t& width, int16_t& height)
+	{
+		FILE* file = fopen(path, "rb");
+		if (file == nullptr)
+			return false;
+
+		int w = 0, h = 0, maxValue = 0;
+		const bool valid = fscanf(file, "P6 %d %d %d", &w, &h, &maxValue) == 3
+			&& fgetc(file) != EOF
+			&& w > 0 && w <= INT16_MAX && h > 0 && h <= INT16_MAX && maxValue == 255;
+
+		bool success = false;
+		if (valid)
+		{
+			std::vector<uint8_t> pixels(size_t(w) * h * 3);
+			if (fread(pixels.data(), 1, pixels.size(), file) == pixels.size())
+			{
+				width = int16_t(w);
+				height = int16_t(h);
+				buffer.resize(size_t(w) * h);
+				for (size_t i = 0; i < buffer.size(); i++)
+				{
+					buffer[i] = Rgb8::Color(pixels[i * 3 + 0], pixels[i * 3 + 1], pixels[i * 3 + 2]);
+				}
+				success = true;
+			}
+		}
+		fclose(file);
+
+		return success;
+	}
+
+	namespace Png
+	{
+		static uint32_t Crc32(const uint8_t* data, const size_t size, uint32_t crc = 0)
+		{
+			crc = ~crc;
+			for (size_t i = 0; i < size; i++)
+			{
+				crc ^= data[i];
+				for (uint_fast8_t k = 0; k < 8; k++)
+					crc = (crc >> 1) ^ (0xEDB88320u & (0 - (crc & 1)));
+			}
+			return ~crc;
+		}
+
+		static void PutU32(std::vector<uint8_t>& out, const uint32_t value)
+		{
+			out.push_back(uint8_t(value >> 24));
+			out.push_back(uint8_t(value >> 16));
+			out.push_back(uint8_t(value >> 8));
+			out.push_back(uint8_t(value));
+		}
+
+		static void WriteChunk(FILE* file, const char* type, const std::vector<uint8_t>& data)
+		{
+			std::vector<uint8_t> chunk;
+			chunk.reserve(data.size() + 12);
+			PutU32(chunk, uint32_t(data.size()));
+			chunk.insert(chunk.end(), type, type + 4);
+			chunk.insert(chunk.end(), data.begin(), data.end());
+			PutU32(chunk, Crc32(chunk.data() + 4, chunk.size() - 4));
+			fwrite(chunk.data(), 1, chunk.size(), file);
+		}
+	}
+
+	/// <summary>
+	/// Writes the buffer as an 8 bit RGB PNG file, using stored (uncompressed) deflate blocks.
+	/// </summary>
+	inline bool WritePng(const char* path, const Rgb8::color_t* buffer, const int16_t width, const int16_t height)
+	{
+		FILE* file = fopen(path, "wb");
+		if (file == nullptr)
+			return false;
+
+		static const uint8_t Signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		fwrite(Signature, 1, sizeof(Signature), file);
+
+		std::vector<uint8_t> header;
+		Png::PutU32(header, uint32_t(width));
+		Png::PutU32(header, uint32_t(height));
+		header.push_back(8); // Bit depth.
+		header.push_back(2); // Truecolor.
+		header.push_back(0); // Deflate.
+		header.push_back(0); // Adaptive filtering.
+		header.push_back(0); // No interlace.
+		Png::WriteChunk(file, "IHDR", header);
+
+		// Raw scanlines, each with filter type 0.
+		const size_t stride = size_t(width) * 3 + 1;
+		std::vector<uint8_t> raw(stride * height);
+		for (int_fast16_t y = 0; y < height; y++)
+		{
+			uint8_t* row = &raw[stride * y];
+			row[0] = 0;
+			for (int_fast16_t x = 0; x < width; x++)
+			{
+				const Rgb8::color_t color = buffer[uint32_t(y) * width + x];
+				row[1 + x * 3 + 0] = Rgb8::Red(color);
+				row[1 + x * 3 + 1] = Rgb8::Green(color);
+				row[1 + x * 3 + 2] = Rgb8::Blue(color);
+			}
+		}
+
+		// zlib stream with stored blocks.
+		static constexpr size_t BlockMax = 65535;
+		std::vector<uint8_t> data;
+		data.reserve(raw.size() + (raw.size() / BlockMax + 1) * 5 + 6);
+		data.push_back(0x78);
+		data.push_back(0x01);
+		size_t offset = 0;
+		do
+		{
+			const size_t size = raw.size() - offset < BlockMax ? raw.size() - offset : BlockMax;
+			data.push_back(offset + size == raw.size() ? 1 : 0);
+			data.push_back(uint8_t(size));
+			data.push_back(uint8_t(size >> 8));
+			data.push_back(uint8_t(~size));
+			data.push_back(uint8_t(~size >> 8));
+			data.insert(data.end(), raw.begin() + offset, raw.begin() + offset + size);
+			offset += size;
+		} while (offset < raw.size());
+
+		uint32_t a = 1, b = 0;
+		for (size_t i = 0; i < raw.size(); i++)
+		{
+			a = (a + raw[i]) % 65521;
+			b = (b + a) % 65521;
+		}
+		Png::PutU32(data, (b << 16) | a);
+
+		Png::WriteChunk(file, "IDAT", data);
+		Png::WriteChunk(file, "IEND", std::vector<uint8_t>());
+
+		return fclose(file) == 0;
+	}
+
+	/// <summary>
+	/// Writes the buffer as PNG if the path ends with ".png", PPM otherwise.
+	/// </summary>
+	inline bool WriteImage(const char* path, const Rgb8::color_t* buffer, const int16_t width, const int16_t height)
+	{
+		const size_t length = strlen(path);
+		if (length >= 4 && strcmp(path + length - 4, ".png") == 0)
+			return WritePng(path, buffer, width, height);
+		else
+			return WritePpm(path, buffer, width, height);
+	}
+
+	/// <summary>
+	/// Replaces the first run of '#' in the pattern with the zero-padded frame number, e.g. "frame_####.png".
+	/// Appends the number before the extension if the pattern has no '#'.
+	/// </summary>
+	inline std::string FramePath(const std::string& pattern, const uint32_t frame)
+	{
+		const size_t start = pattern.find('#');
+		if (start == std::string::npos)
+		{
+			const size_t dot = pattern.rfind('.');
+			const size_t insert = dot == std::string::npos ? pattern.size() : dot;
+
+			return pattern.substr(0, insert) + "_" + std::to_string(frame) + pattern.substr(insert);
+		}
+
+		size_t end = start;
+		while (end < pattern.size() && pattern[end] == '#')
+			end++;
+
+		std::string number = std::to_string(frame);
+		if (number.size() < end - start)
+			number.insert(0, end - start - number.size(), '0');
+
+		return pattern.substr(0, start) + number + pattern.substr(end);
+	}
+}
+#endif
@@ -0,0 +1,57 @@
+/*
+* Minimal Arduino timing shim for building IntegerWorld examples as native host programs (Linux/macOS).
+* Provides micros() and millis(), used by the engine and TaskScheduler.
+* Each thread can freeze its clock at a given time, for deterministic offline rendering.
+*/
+
+#ifndef _INTEGER_WORLD_HOST_PLATFORM_h
+#define _INTEGER_WORLD_HOST_PLATFORM_h
+
+#if !defined(ARDUINO)
+#include <chrono>
+#include <stdint.h>
+
+namespace HostPlatform
+{
+	static const std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+
+	// Per-thread fixed clock, overrides real time when enabled.
+	static thread_local bool ClockFixed = false;
+	static thread_local uint32_t ClockMicros = 0;
+
+	/// <summary>
+	/// Freezes micros() and millis() on the calling thread at the given timestamp.
+	/// </summary>
+	inline void SetFixedClock(const uint32_t timestamp)
+	{
+		ClockMicros = timestamp;
+		ClockFixed = true;
+	}
+
+	/// <summary>
+	/// Restores real time on the calling thread.
+	/// </summary>
+	inline void ClearFixedClock()
+	{
+		ClockFixed = false;
+	}
+}
+
+inline uint32_t micros()
+{
+	if (HostPlatform::ClockFixed)
+		return HostPlatform::ClockMicros;
+
+	return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - HostPlatform::Epoch).count());
+}
+
+inline uint32_t millis()
+{
+	if (HostPlatform::ClockFixed)
+		return HostPlatform::ClockMicros / 1000;
+
+	return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - HostPlatform::Epoch).count());
+}
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+/*
+* Headless frame buffer surface for IntegerWorld host tests and benchmarks.
+* Hashes every presented frame, so a run can be checked to render the same frames as a reference run.
+* No external dependencies.
+*/
+
+#ifndef _INTEGER_WORLD_HOST_SURFACE_h
+#define _INTEGER_WORLD_HOST_SURFACE_h
+
+#include <IntegerWorld.h>
+#include <IntegerWorldOutputs.h>
+
+#include <chrono>
+#include <vector>
+
+namespace HostSurface
+{
+	using namespace IntegerWorld;
+
+	/// <summary>
+	/// FNV-1a hash of a frame buffer.
+	/// </summary>
+	inline uint32_t HashFrame(const Rgb8::color_t* buffer, const uint32_t pixelCount)
+	{
+		uint32_t hash = 2166136261u;
+		for (uint32_t i = 0; i < pixelCount; i++)
+		{
+			hash = (hash ^ buffer[i]) * 16777619u;
+		}
+
+		return hash;
+	}
+
+	/// <summary>
+	/// Heap-backed frame buffer surface that counts presented frames and hashes all of them.
+	/// </summary>
+	class HashingSurface : public FrameBufferOutput::BufferSurface
+	{
+	public:
+		uint32_t FrameCount = 0;
+		std::vector<uint32_t> FrameHashes{};
+
+	public:
+		HashingSurface(std::vector<Rgb8::color_t>& frame, const int16_t width, const int16_t height)
+			: FrameBufferOutput::BufferSurface(frame.data(), width, height)
+		{
+		}
+
+		void FlipSurface() final
+		{
+			FrameHashes.push_back(HashFrame(Buffer, uint32_t(BufferWidth) * BufferHeight));
+			FrameCount++;
+		}
+
+		/// <summary>
+		/// Hash of the last presented frame, 0 before the first frame.
+		/// </summary>
+		uint32_t GetLastHash() const
+		{
+			return FrameHashes.empty() ? 0 : FrameHashes.back();
+		}
+
+		/// <summary>
+		/// True if every presented frame hashes the same as the reference run's frame.
+		/// </summary>
+		bool MatchesHashes(const std::vector<uint32_t>& referenceHashes) const
+		{
+			return FrameHashes == referenceHashes;
+		}
+	};
+
+	/// <summary>
+	/// Runs the scheduler until the surface presents frameCount more frames.
+	/// </summary>
+	/// <param name="surface">Surface with a FrameCount of presented frames.</param>
+	/// <returns>Wall time per frame, in milliseconds.</returns>
+	template<typename SchedulerType, typename SurfaceType>
+	double RenderFrames(SchedulerType& scheduler, SurfaceType& surface, const uint32_t frameCount)
+	{
+		const uint32_t target = surface.FrameCount + frameCount;
+
+		const auto start = std::chrono::steady_clock::now();
+		while (surface.FrameCount < target)
+		{
+			scheduler.execute();
+		}
+
+		return frameCount > 0 ? std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frameCount : 0.0;
+	}
+}
+#endif
@@ -0,0 +1,294 @@
+/*
+* Integer World headless light cluster LOD test.
+* Renders a grid of lit Suzanne meshes far from two tight groups of string lights into an in-memory frame buffer,
+* once lighting with every light and once with the light clusters registered in the light source shader.
+* Clustering is lossy: reports frame time, lights per object and the image brightness error of the clustered run,
+* which must stay within BrightnessTolerancePercent of the per-light run, with no saturated cluster color.
+*
+* Build (Linux):
+*	g++ -std=c++17 -O2 -I<IntegerWorld>/src -I<IntegerSignal>/src -I<TaskScheduler>/src LightClusters.cpp -o LightClusters
+* Usage:
+*	./LightClusters [frames]
+*/
+
+#include "../HostPlatform.h"
+#include "../HostSurface.h"
+
+#define _TASK_OO_CALLBACKS
+#include <TScheduler.hpp>
+
+#include <IntegerWorld.h>
+#include <IntegerWorldTasks.h>
+#include <IntegerWorldOutputs.h>
+#include <IntegerWorldExperimental.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace IntegerWorld;
+using namespace IntegerWorld::SceneShaders::LightSource;
+
+static constexpr int16_t Width = 320;
+static constexpr int16_t Height = 240;
+
+static constexpr uint8_t MeshCount = 16;
+static constexpr uint8_t GroupCount = 2;
+static constexpr uint8_t GroupLightCount = 8;
+static constexpr uint8_t PointLightCount = GroupCount * GroupLightCount;
+static constexpr uint8_t SceneLightCount = PointLightCount + 1;
+static constexpr uint8_t MaxClusterCount = 8;
+static constexpr uint16_t ClusterSize = 400;
+
+static constexpr uint8_t BrightnessTolerancePercent = 3;
+
+using EngineType = EngineRenderTask<MeshCount + 1, 8192, 64>;
+using MeshObjectType = Assets::RenderObjects::SuzanneMeshObject;
+using ClustersType = TemplateLightClusters<SceneLightCount, MaxClusterCount>;
+
+/// <summary>
+/// Heap-backed frame buffer surface that counts presented frames and sums the brightness of all of them.
+/// </summary>
+class BrightnessSurface : public FrameBufferOutput::BufferSurface
+{
+public:
+	uint32_t FrameCount = 0;
+	uint64_t BrightnessSum = 0;
+
+public:
+	BrightnessSurface(std::vector<Rgb8::color_t>& frame)
+		: FrameBufferOutput::BufferSurface(frame.data(), Width, Height)
+	{
+	}
+
+	void FlipSurface() final
+	{
+		for (uint32_t i = 0; i < uint32_t(Width) * Height; i++)
+		{
+			BrightnessSum += uint32_t(Rgb8::Red(Buffer[i])) + Rgb8::Green(Buffer[i]) + Rgb8::Blue(Buffer[i]);
+		}
+		FrameCount++;
+	}
+};
+
+/// <summary>
+/// Light source shader that accumulates the selected light count.
+/// </summary>
+class CountingShader : public Shader
+{
+public:
+	mutable uint32_t SelectedSum = 0;
+	mutable uint32_t SelectionCount = 0;
+
+public:
+	CountingShader() : Shader() {}
+
+	void SelectObjectLights(object_lights_t& lights, const vertex16_t& center, const uint16_t radius) const final
+	{
+		Shader::SelectObjectLights(lights, center, radius);
+
+		SelectedSum += lights.count == OBJECT_LIGHTS_ALL ? SceneLightCount : lights.count;
+		SelectionCount++;
+	}
+};
+
+/// <summary>
+/// Grid of spinning meshes at varying depths, lit by two tight groups of dim point lights and a directional light.
+/// The groups sit behind the meshes, so every mesh is beyond the cluster distance.
+/// Animated by frame number so every run renders the same frames.
+/// </summary>
+class ClustersScene : public IFrameListener
+{
+private:
+	static constexpr int16_t Spacing = VERTEX16_UNIT / 4;
+	static constexpr int16_t Depth = (VERTEX16_UNIT * 3) / 4;
+	static constexpr int16_t GroupSpread = 500;
+
+private:
+	MeshObjectType Meshes[MeshCount]{};
+	light_source_t Lights[SceneLightCount]{};
+
+	RenderObjects::Background::FillObject Background{};
+	RenderObjects::Background::FragmentShaders::FillShader BackgroundShader{};
+	RenderObjects::Mesh::FragmentShaders::TriangleShade::FillShader TriangleShader{};
+
+	CountingShader& LightShader;
+
+	camera_state_t* Camera = nullptr;
+
+	uint32_t Frame = 0;
+
+public:
+	ClustersScene(CountingShader& lightShader)
+		: IFrameListener()
+		, LightShader(lightShader)
+	{
+		for (uint_fast8_t i = 0; i < MeshCount; i++)
+		{
+			MeshObjectType& mesh = Meshes[i];
+			mesh.Translation = { int16_t(-Spacing * 3 / 2 + (i % 4) * Spacing), int16_t(-Spacing * 3 / 4 + (i / 4) * (Spacing / 2)), int16_t(Depth + (i % 3) * (Spacing * 3 / 4)) };
+			mesh.Resize = Scale16::SCALE_1X / 2;
+			mesh.BoundingRadius = Assets::Shapes::Suzanne::BoundingRadius;
+			mesh.SetAlbedo(Rgb8::Color(200, 200, 200));
+			mesh.FragmentShader = &TriangleShader;
+			mesh.SceneShader = &LightShader;
+		}
+
+		// Fixed pseudo-random colors and offsets, so every run lights the same.
+		uint32_t seed = 1;
+		auto next = [&seed](const uint16_t range) -> int16_t
+			{
+				seed = seed * 1103515245u + 12345u;
+				return int16_t((seed >> 16) % range);
+			};
+
+		for (uint_fast8_t i = 0; i < PointLightCount; i++)
+		{
+			const int16_t groupX = (i / GroupLightCount) == 0 ? -(Spacing * 5 / 4) : (Spacing * 5 / 4);
+			// Dim string lights, a whole group sums within the channel range.
+			const Rgb8::color_t color = Rgb8::Color(uint8_t(16 + next(16)), uint8_t(16 + next(16)), uint8_t(16 + next(16)));
+			const vertex16_t position = {
+				int16_t(groupX + next(GroupSpread) - GroupSpread / 2),
+				int16_t(next(GroupSpread * 8 / 5) - GroupSpread * 4 / 5),
+				int16_t(VERTEX16_UNIT + next(GroupSpread) - GroupSpread / 2) };
+			Lights[i] = PointLightSource(color, position, 0, VERTEX16_UNIT + Spacing / 2);
+		}
+		Lights[PointLightCount] = DirectionalLightSource(Rgb8::Color(40, 40, 40), { 0, -VERTEX16_UNIT, VERTEX16_UNIT });
+
+		LightShader.SetLights(Lights, SceneLightCount);
+		LightShader.AmbientLight = Rgb8::Color(30, 30, 30);
+
+		Background.Color = Rgb8::BLACK;
+		Background.FragmentShader = &BackgroundShader;
+	}
+
+	const light_source_t* GetLights() const
+	{
+		return Lights;
+	}
+
+	bool Start(EngineType& engine)
+	{
+		engine.ClearObjects();
+		if (!engine.AddObject(&Background))
+			return false;
+
+		for (auto& mesh : Meshes)
+		{
+			if (!engine.AddObject(&mesh))
+				return false;
+		}
+
+		engine.SetFov((uint32_t(UFRACTION16_1X) * 60) / 100);
+		Camera = engine.GetCameraControls();
+		LightShader.CameraPosition = &Camera->Position;
+		engine.SetFrameListener(this);
+
+		return true;
+	}
+
+	void OnFrameStart() final
+	{
+		Camera->Position = { 0, 0, 0 };
+		Camera->Rotation = { 0, 0, 0 };
+
+		for (uint_fast8_t i = 0; i < MeshCount; i++)
+		{
+			Meshes[i].Rotation = { 100, angle_t(16384 + Frame * 193 + i * 4096), 0 };
+		}
+		Frame++;
+	}
+};
+
+/// <summary>
+/// Count of clusters with a color channel clamped, where the summed light color exceeds the channel range.
+/// </summary>
+static uint8_t CountSaturatedClusters(const ClustersType& clusters, const light_source_t* lights)
+{
+	uint8_t saturated = 0;
+	for (uint_fast8_t c = 0; c < clusters.GetClusterCount(); c++)
+	{
+		const light_cluster_t& cluster = clusters.GetCluster(c);
+
+		uint16_t red = 0, green = 0, blue = 0;
+		for (uint_fast8_t i = cluster.First; i < cluster.First + cluster.Count; i++)
+		{
+			const Rgb8::color_t color = lights[clusters.GetOrderedLight(i)].Color;
+			red += Rgb8::Red(color);
+			green += Rgb8::Green(color);
+			blue += Rgb8::Blue(color);
+		}
+
+		if (MaxValue(red, MaxValue(green, blue)) > Rgb8::COMPONENT_MAX)
+			saturated++;
+	}
+
+	return saturated;
+}
+
+static bool RunClusters(const bool cluster, const uint32_t frames, uint64_t& referenceBrightness)
+{
+	std::vector<Rgb8::color_t> frame(size_t(Width) * Height);
+	BrightnessSurface surface(frame);
+
+	TS::Scheduler scheduler;
+	std::unique_ptr<EngineType> engine(new EngineType(scheduler, surface));
+	CountingShader shader{};
+	std::unique_ptr<ClustersScene> scene(new ClustersScene(shader));
+	std::unique_ptr<ClustersType> clusters(new ClustersType());
+
+	if (cluster)
+	{
+		clusters->Build(scene->GetLights(), SceneLightCount, ClusterSize);
+		shader.SetLightClusters(clusters.get());
+	}
+
+	engine->Start();
+	if (!scene->Start(*engine))
+	{
+		printf("Failed to add objects.\n");
+		return false;
+	}
+
+	const double frameMillis = HostSurface::RenderFrames(scheduler, surface, frames);
+	engine->Stop();
+
+	const double lightsPerObject = shader.SelectionCount > 0 ? double(shader.SelectedSum) / shader.SelectionCount : 0.0;
+
+	bool withinTolerance = true;
+	if (!cluster)
+	{
+		referenceBrightness = surface.BrightnessSum;
+		printf("    all lights: frame %8.3f ms, lights per object %5.2f\n", frameMillis, lightsPerObject);
+	}
+	else
+	{
+		const double errorPercent = referenceBrightness > 0 ?
+			(100.0 * (double(surface.BrightnessSum) - double(referenceBrightness))) / double(referenceBrightness) : 0.0;
+		const uint8_t saturated = CountSaturatedClusters(*clusters, scene->GetLights());
+		withinTolerance = saturated == 0
+			&& errorPercent <= BrightnessTolerancePercent && errorPercent >= -double(BrightnessTolerancePercent);
+		printf("      clusters: frame %8.3f ms, lights per object %5.2f, clusters %u (%u saturated), brightness %+.2f%%, %s\n",
+			frameMillis, lightsPerObject,
+			clusters->GetClusterCount(), saturated,
+			errorPercent,
+			withinTolerance ? "within tolerance" : "OUT OF TOLERANCE");
+	}
+
+	return withinTolerance;
+}
+
+int main(int argc, char** argv)
+{
+	const uint32_t frames = argc > 1 ? uint32_t(MaxValue(1, atoi(argv[1]))) : 32;
+
+	printf("Integer World light cluster test %dx%d, %u meshes, %u lights, %u frames (ms per frame)\n", Width, Height, MeshCount, SceneLightCount, frames);
+
+	uint64_t referenceBrightness = 0;
+
+	bool success = RunClusters(false, frames, referenceBrightness);
+	success &= RunClusters(true, frames, referenceBrightness);
+
+	return success ? 0 : 1;
+}
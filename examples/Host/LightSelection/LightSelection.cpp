@@ -0,0 +1,229 @@
+/*
+* Integer World headless per-object light selection test.
+* Renders a grid of lit Suzanne meshes under many small point and spot lights into an in-memory frame buffer,
+* once lighting every primitive with all scene lights and once with the lights selected per object by the light source shader.
+* Reports frame time and selected lights per object; every frame of the selected run is checked to be identical.
+*
+* Build (Linux):
+*	g++ -std=c++17 -O2 -I<IntegerWorld>/src -I<IntegerSignal>/src -I<TaskScheduler>/src LightSelection.cpp -o LightSelection
+* Usage:
+*	./LightSelection [frames]
+*/
+
+#include "../HostPlatform.h"
+#include "../HostSurface.h"
+
+#define _TASK_OO_CALLBACKS
+#include <TScheduler.hpp>
+
+#include <IntegerWorld.h>
+#include <IntegerWorldTasks.h>
+#include <IntegerWorldOutputs.h>
+#include <IntegerWorldExperimental.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace IntegerWorld;
+using namespace IntegerWorld::SceneShaders::LightSource;
+
+static constexpr int16_t Width = 320;
+static constexpr int16_t Height = 240;
+
+static constexpr uint8_t MeshCount = 16;
+static constexpr uint8_t PointLightCount = 32;
+static constexpr uint8_t SceneLightCount = PointLightCount + 1;
+
+using EngineType = EngineRenderTask<MeshCount + 1, 8192, 64>;
+using MeshObjectType = Assets::RenderObjects::SuzanneMeshObject;
+
+/// <summary>
+/// Light source shader that selects per object as usual, or keeps all lights for every object.
+/// Accumulates the selected light count.
+/// </summary>
+class CountingShader : public Shader
+{
+private:
+	const bool Select;
+
+public:
+	mutable uint32_t SelectedSum = 0;
+	mutable uint32_t SelectionCount = 0;
+
+public:
+	CountingShader(const bool select)
+		: Shader()
+		, Select(select)
+	{
+	}
+
+	void SelectObjectLights(object_lights_t& lights, const vertex16_t& center, const uint16_t radius) const final
+	{
+		if (Select)
+			Shader::SelectObjectLights(lights, center, radius);
+		else
+			lights.count = OBJECT_LIGHTS_ALL;
+
+		SelectedSum += lights.count == OBJECT_LIGHTS_ALL ? SceneLightCount : lights.count;
+		SelectionCount++;
+	}
+};
+
+/// <summary>
+/// Grid of spinning meshes, with a row of point and spot lights drifting in front of each mesh row and a dim directional light.
+/// Animated by frame number so every run renders the same frames.
+/// </summary>
+class LightsScene : public IFrameListener
+{
+private:
+	static constexpr int16_t Spacing = VERTEX16_UNIT / 4;
+	static constexpr int16_t Depth = VERTEX16_UNIT;
+	static constexpr uint16_t LightRangeMin = 100;
+	static constexpr uint16_t LightRangeMax = 700;
+
+private:
+	MeshObjectType Meshes[MeshCount]{};
+	light_source_t Lights[SceneLightCount]{};
+
+	RenderObjects::Background::FillObject Background{};
+	RenderObjects::Background::FragmentShaders::FillShader BackgroundShader{};
+	RenderObjects::Mesh::FragmentShaders::TriangleShade::FillShader TriangleShader{};
+
+	CountingShader& LightShader;
+
+	camera_state_t* Camera = nullptr;
+
+	uint32_t Frame = 0;
+
+public:
+	LightsScene(CountingShader& lightShader)
+		: IFrameListener()
+		, LightShader(lightShader)
+	{
+		static constexpr material_t Materials[] = {
+			{ 0, UFRACTION8_1X, 0, 0, 0, 0 },
+			{ 10, 100, 128, 100, 60, 0 },
+			{ 0, 90, 100, 40, 30, 100 },
+			{ 0, 120, 90, 128, 100, -80 } };
+
+		for (uint_fast8_t i = 0; i < MeshCount; i++)
+		{
+			MeshObjectType& mesh = Meshes[i];
+			mesh.Translation = { int16_t(-Spacing * 3 / 2 + (i % 4) * Spacing), int16_t(-Spacing + (i / 4) * (Spacing * 2 / 3)), Depth };
+			mesh.Resize = Scale16::SCALE_1X / 2;
+			mesh.BoundingRadius = Assets::Shapes::Suzanne::BoundingRadius;
+			mesh.SetAlbedo(Rgb8::Color(200, 180, 160));
+			mesh.SetMaterial(Materials[i % 4]);
+			mesh.FragmentShader = &TriangleShader;
+			mesh.SceneShader = &LightShader;
+		}
+
+		for (uint_fast8_t i = 0; i < PointLightCount; i++)
+		{
+			const Rgb8::color_t color = Rgb8::Color(uint8_t(50 + i * 6), uint8_t(200 - i * 5), 120);
+			if (i % 3 == 2)
+				Lights[i] = SpotLightSource(color, {}, { 0, 0, VERTEX16_UNIT }, LightRangeMin, LightRangeMax, UFRACTION16_1X / 2);
+			else
+				Lights[i] = PointLightSource(color, {}, LightRangeMin, LightRangeMax);
+		}
+		Lights[PointLightCount] = DirectionalLightSource(Rgb8::Color(60, 60, 60), { 0, 0, VERTEX16_UNIT });
+
+		LightShader.SetLights(Lights, SceneLightCount);
+		LightShader.AmbientLight = Rgb8::Color(40, 40, 40);
+
+		Background.Color = Rgb8::BLACK;
+		Background.FragmentShader = &BackgroundShader;
+	}
+
+	bool Start(EngineType& engine)
+	{
+		engine.ClearObjects();
+		if (!engine.AddObject(&Background))
+			return false;
+
+		for (auto& mesh : Meshes)
+		{
+			if (!engine.AddObject(&mesh))
+				return false;
+		}
+
+		engine.SetFov((uint32_t(UFRACTION16_1X) * 60) / 100);
+		Camera = engine.GetCameraControls();
+		LightShader.CameraPosition = &Camera->Position;
+		engine.SetFrameListener(this);
+
+		return true;
+	}
+
+	void OnFrameStart() final
+	{
+		Camera->Position = { 0, 0, 0 };
+		Camera->Rotation = { 0, 0, 0 };
+
+		for (uint_fast8_t i = 0; i < PointLightCount; i++)
+		{
+			const int16_t drift = int16_t(((Frame * 37 + i * 101) % 400) - 200);
+			Lights[i].Position = { int16_t(-Spacing * 7 / 4 + (i % 8) * (Spacing / 2) + drift), int16_t(-Spacing + (i / 8) * (Spacing * 2 / 3)), int16_t(Depth - Spacing / 2) };
+		}
+
+		for (uint_fast8_t i = 0; i < MeshCount; i++)
+		{
+			Meshes[i].Rotation = { 100, angle_t(Frame * 193 + i * 4096), 0 };
+		}
+		Frame++;
+	}
+};
+
+static bool RunLights(const bool select, const uint32_t frames, std::vector<uint32_t>& referenceHashes)
+{
+	std::vector<Rgb8::color_t> frame(size_t(Width) * Height);
+	HostSurface::HashingSurface surface(frame, Width, Height);
+
+	TS::Scheduler scheduler;
+	std::unique_ptr<EngineType> engine(new EngineType(scheduler, surface));
+	CountingShader shader(select);
+	std::unique_ptr<LightsScene> scene(new LightsScene(shader));
+
+	engine->Start();
+	if (!scene->Start(*engine))
+	{
+		printf("Failed to add objects.\n");
+		return false;
+	}
+
+	const double frameMillis = HostSurface::RenderFrames(scheduler, surface, frames);
+	engine->Stop();
+
+	const double lightsPerObject = shader.SelectionCount > 0 ? double(shader.SelectedSum) / shader.SelectionCount : 0.0;
+
+	bool match = true;
+	if (!select)
+	{
+		referenceHashes = surface.FrameHashes;
+		printf("    all lights: frame %8.3f ms, lights per object %5.2f\n", frameMillis, lightsPerObject);
+	}
+	else
+	{
+		match = surface.MatchesHashes(referenceHashes);
+		printf("      selected: frame %8.3f ms, lights per object %5.2f, %s\n", frameMillis, lightsPerObject,
+			match ? "match" : "MISMATCH");
+	}
+
+	return match;
+}
+
+int main(int argc, char** argv)
+{
+	const uint32_t frames = argc > 1 ? uint32_t(MaxValue(1, atoi(argv[1]))) : 32;
+
+	printf("Integer World light selection test %dx%d, %u meshes, %u lights, %u frames (ms per frame)\n", Width, Height, MeshCount, SceneLightCount, frames);
+
+	std::vector<uint32_t> referenceHashes{};
+
+	bool success = RunLights(false, frames, referenceHashes);
+	success &= RunLights(true, frames, referenceHashes);
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+/*
+* Integer World projection accuracy check.
+* Compares ViewportProjector::ProjectReciprocal (reciprocal multiply) against ViewportProjector::ProjectExact (integer division)
+* for every camera-space depth in the int16 range and x/y sampled over the int16 range, for several viewports and fields of view.
+* Fails if any vertex in front of the camera, whose ideal (real valued) projection is inside the guard band (4 viewports around the screen),
+* differs by more than 1 pixel. Outside the guard band the division path itself overflows, so results aren't compared.
+*
+* Build (Linux):
+*	g++ -std=c++17 -O2 -I<IntegerWorld>/src -I<IntegerSignal>/src ProjectionAccuracy.cpp -o ProjectionAccuracy
+* Usage:
+*	./ProjectionAccuracy [xyStep]
+*/
+
+#include <IntegerWorld.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace IntegerWorld;
+
+static constexpr int32_t MaxError = 1;
+static constexpr int32_t GuardBand = 4;
+
+// Same scale as ViewportProjector.
+static constexpr uint8_t DownShift = GetBitShifts(DRAW_DISTANCE_MAX - VERTEX16_UNIT);
+
+struct viewport_t
+{
+	uint16_t Width;
+	uint16_t Height;
+};
+
+static bool CheckViewport(const viewport_t viewport, const ufraction16_t fov, const int32_t step)
+{
+	ViewportProjector projector{};
+	projector.SetDimensions(viewport.Width, viewport.Height);
+	projector.SetFov(fov);
+
+	const double minX = -GuardBand * viewport.Width;
+	const double maxX = (GuardBand + 1) * viewport.Width;
+	const double minY = -GuardBand * viewport.Height;
+	const double maxY = (GuardBand + 1) * viewport.Height;
+
+	const double widthHalf = viewport.Width >> 1;
+	const double heightHalf = viewport.Height >> 1;
+	const double scale = double(projector.GetFocalDistance()) / double(1 << DownShift);
+	const double aspect = double(viewport.Width) / viewport.Height;
+
+	uint64_t samples = 0;
+	uint64_t different = 0;
+	int32_t worstError = 0;
+	int16_t worstX = 0, worstZ = 0;
+
+	for (int32_t z = INT16_MIN; z <= INT16_MAX; z++)
+	{
+		for (int32_t v = INT16_MIN; v <= INT16_MAX; v += step)
+		{
+			vertex16_t fast{ int16_t(v), int16_t(v), int16_t(z) };
+			vertex16_t exact = fast;
+			projector.ProjectReciprocal(fast);
+			projector.ProjectExact(exact);
+
+			// Only vertices in front of the camera, projected into the guard band, are drawn.
+			if (exact.z <= 0)
+				continue;
+
+			const double idealX = widthHalf - ((double(v) * scale * widthHalf) / exact.z);
+			const double idealY = heightHalf - ((double(v) * scale * aspect * heightHalf) / exact.z);
+
+			if (idealX >= minX && idealX <= maxX)
+			{
+				const int32_t error = AbsValue<int32_t>(int32_t(fast.x) - exact.x);
+				samples++;
+				different += error > 0;
+				if (error > worstError) { worstError = error; worstX = int16_t(v); worstZ = int16_t(z); }
+			}
+			if (idealY >= minY && idealY <= maxY)
+			{
+				const int32_t error = AbsValue<int32_t>(int32_t(fast.y) - exact.y);
+				samples++;
+				different += error > 0;
+				if (error > worstError) { worstError = error; worstX = int16_t(v); worstZ = int16_t(z); }
+			}
+		}
+	}
+
+	printf("%5ux%-5u fov %5u: %11llu samples, %9llu differ (%.4f%%), max error %d px (at %d, z %d)\n",
+		viewport.Width, viewport.Height, fov,
+		(unsigned long long)samples, (unsigned long long)different,
+		samples > 0 ? (100.0 * different) / samples : 0.0,
+		worstError, worstX, worstZ);
+
+	return worstError <= MaxError;
+}
+
+static void Benchmark()
+{
+	ViewportProjector projector{};
+	projector.SetDimensions(320, 240);
+	projector.SetFov(UFRACTION16_1X / 2);
+
+	int32_t checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int32_t z = INT16_MIN; z <= INT16_MAX; z += 3)
+		for (int32_t v = -8192; v < 8192; v += 97)
+		{
+			vertex16_t vertex{ int16_t(v), int16_t(-v), int16_t(z) };
+			projector.ProjectReciprocal(vertex);
+			checksum += vertex.x + vertex.y;
+		}
+	const double fast = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	start = std::chrono::steady_clock::now();
+	for (int32_t z = INT16_MIN; z <= INT16_MAX; z += 3)
+		for (int32_t v = -8192; v < 8192; v += 97)
+		{
+			vertex16_t vertex{ int16_t(v), int16_t(-v), int16_t(z) };
+			projector.ProjectExact(vertex);
+			checksum -= vertex.x + vertex.y;
+		}
+	const double exact = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	printf("Host timing: reciprocal %.2f ms, division %.2f ms (checksum %d)\n", fast, exact, checksum);
+}
+
+int main(int argc, char** argv)
+{
+	const int32_t step = argc > 1 ? MaxValue(1, atoi(argv[1])) : 31;
+
+	static constexpr viewport_t Viewports[] = { { 96, 64 }, { 128, 64 }, { 320, 240 }, { 640, 360 }, { 1920, 1080 } };
+	static constexpr ufraction16_t Fovs[] = { 0, UFRACTION16_1X / 4, UFRACTION16_1X / 2, UFRACTION16_1X };
+
+	printf("Integer World projection accuracy, reciprocal vs division, x/y step %d, bound %d px\n", step, MaxError);
+
+	bool success = true;
+	for (const viewport_t& viewport : Viewports)
+		for (const ufraction16_t fov : Fovs)
+			success &= CheckViewport(viewport, fov, step);
+
+	Benchmark();
+
+	printf(success ? "PASS\n" : "FAIL\n");
+
+	return success ? 0 : 1;
+}
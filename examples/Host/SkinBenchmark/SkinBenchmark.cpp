@@ -0,0 +1,223 @@
+/*
+* Integer World skinning benchmark.
+* Times the VertexShade skinning pass of a 500 vertex skinned cylinder (25 rings of 20 vertices, 8 bones)
+* with 1, 2 and 4 bones per vertex, against the unskinned bind pose load as reference.
+* Reports the per-vertex cost of skinning alone, with the bone palette animated every frame.
+*
+* Build (Linux):
+*	g++ -std=c++17 -O2 -I<IntegerWorld>/src -I<IntegerSignal>/src SkinBenchmark.cpp -o SkinBenchmark
+* Usage:
+*	./SkinBenchmark [frames]
+*/
+
+#include <IntegerWorld.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace IntegerWorld;
+
+static constexpr uint16_t RingCount = 25;
+static constexpr uint16_t RingVertexCount = 20;
+static constexpr uint16_t VertexCount = RingCount * RingVertexCount;
+static constexpr uint16_t TriangleCount = (RingCount - 1) * RingVertexCount * 2;
+static constexpr uint8_t BoneCount = 8;
+
+static constexpr int16_t Radius = VERTEX16_UNIT / 4;
+static constexpr int16_t RingSpacing = VERTEX16_UNIT / 16;
+
+using SkinnedObjectType = RenderObjects::Mesh::SkinnedTriangleObject<VertexCount, TriangleCount,
+	PrimitiveSources::Vertex::Dynamic::Source,
+	PrimitiveSources::Triangle::Dynamic::Source,
+	PrimitiveSources::Skin::Dynamic::Source,
+	FrustumCullingEnum::NoCulling,
+	FaceCullingEnum::NoCulling>;
+
+/// <summary>
+/// Exposes the skinned vertices for the checksum.
+/// </summary>
+class BenchmarkObject : public SkinnedObjectType
+{
+public:
+	using SkinnedObjectType::SkinnedObjectType;
+
+	uint32_t GetChecksum() const
+	{
+		uint32_t checksum = 0;
+		for (uint16_t i = 0; i < VertexCount; i++)
+		{
+			checksum = (checksum * 31) + uint16_t(Vertices[i].x) + uint16_t(Vertices[i].y) + uint16_t(Vertices[i].z);
+		}
+		return checksum;
+	}
+};
+
+static void BuildMesh(std::vector<vertex16_t>& vertices, std::vector<triangle_face_t>& triangles)
+{
+	for (uint16_t ring = 0; ring < RingCount; ring++)
+	{
+		for (uint16_t i = 0; i < RingVertexCount; i++)
+		{
+			const angle_t angle = static_cast<angle_t>((uint32_t(i) * ANGLE_RANGE) / RingVertexCount);
+			vertices.push_back({ Fraction(Cosine16(angle), Radius), int16_t(ring * RingSpacing), Fraction(Sine16(angle), Radius) });
+		}
+	}
+
+	for (uint16_t ring = 0; ring + 1 < RingCount; ring++)
+	{
+		for (uint16_t i = 0; i < RingVertexCount; i++)
+		{
+			const uint16_t a = ring * RingVertexCount + i;
+			const uint16_t b = ring * RingVertexCount + ((i + 1) % RingVertexCount);
+			triangles.push_back({ a, uint16_t(a + RingVertexCount), b });
+			triangles.push_back({ b, uint16_t(a + RingVertexCount), uint16_t(b + RingVertexCount) });
+		}
+	}
+}
+
+/// <summary>
+/// Weights each ring to its nearest bones along the cylinder, up to bonesPerVertex.
+/// </summary>
+static void BuildSkin(std::vector<skin_vertex_t>& skins, const uint8_t bonesPerVertex)
+{
+	skins.clear();
+	for (uint16_t ring = 0; ring < RingCount; ring++)
+	{
+		// Ring position in bone units.
+		const uint32_t position = (uint32_t(ring) * (BoneCount - 1) * 256) / (RingCount - 1);
+		const uint8_t first = static_cast<uint8_t>(MinValue<uint32_t>(position >> 8, BoneCount - bonesPerVertex));
+
+		skin_vertex_t skin{};
+		uint8_t remaining = UFRACTION8_1X;
+		for (uint8_t k = 0; k < bonesPerVertex; k++)
+		{
+			skin.bones[k] = first + k;
+			skin.weights[k] = (k + 1 == bonesPerVertex) ? remaining : static_cast<ufraction8_t>(remaining / 2);
+			remaining -= skin.weights[k];
+		}
+
+		for (uint16_t i = 0; i < RingVertexCount; i++)
+		{
+			skins.push_back(skin);
+		}
+	}
+}
+
+/// <summary>
+/// Bends every bone joint by a frame dependent angle, around the joint's ring.
+/// </summary>
+static void AnimateBones(transform16_rotate_translate_t* bones, const uint32_t frame)
+{
+	transform16_rotate_translate_t parent{};
+	CalculateTransformRotation(parent, 0, 0, 0);
+	parent.Translation = { 0, 0, 0 };
+
+	for (uint8_t b = 0; b < BoneCount; b++)
+	{
+		const int16_t pivot = static_cast<int16_t>((int32_t(b) * (RingCount - 1) * RingSpacing) / (BoneCount - 1));
+		const angle_t bend = static_cast<angle_t>(Fraction(Sine16(static_cast<angle_t>(frame * 512 + b * 4096)), int16_t(ANGLE_RANGE / 32)));
+
+		transform16_rotate_t local{};
+		CalculateTransformRotation(local, 0, 0, bend);
+
+		// bone = parent * (pivot + local * (v - pivot)), composed column by column.
+		transform16_rotate_translate_t& bone = bones[b];
+		for (uint8_t r = 0; r < 3; r++)
+		{
+			for (uint8_t c = 0; c < 3; c++)
+			{
+				bone.Matrix[r][c] = static_cast<fraction16_t>(SignedRightShift(
+					(int32_t(parent.Matrix[r][0]) * local.Matrix[0][c])
+					+ (int32_t(parent.Matrix[r][1]) * local.Matrix[1][c])
+					+ (int32_t(parent.Matrix[r][2]) * local.Matrix[2][c]), TRANSFORM16_MATRIX_SHIFTS));
+			}
+		}
+		vertex16_t offset{ 0, pivot, 0 };
+		vertex16_t rotatedPivot = offset;
+		ApplyTransform(static_cast<const transform16_rotate_t&>(bone), rotatedPivot);
+		ApplyTransform(static_cast<const transform16_rotate_t&>(parent), offset);
+		bone.Translation = { int16_t(parent.Translation.x + offset.x - rotatedPivot.x),
+			int16_t(parent.Translation.y + offset.y - rotatedPivot.y),
+			int16_t(parent.Translation.z + offset.z - rotatedPivot.z) };
+
+		parent = bone;
+	}
+}
+
+/// <summary>
+/// Runs ObjectShade and VertexShade for every frame.
+/// </summary>
+/// <returns>Elapsed nanoseconds.</returns>
+static double Run(BenchmarkObject& object, transform16_rotate_translate_t* bones, const uint32_t frames, uint32_t& checksum)
+{
+	const frustum_t frustum{};
+	checksum = 0;
+
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t frame = 0; frame < frames; frame++)
+	{
+		if (bones != nullptr)
+		{
+			AnimateBones(bones, frame);
+		}
+
+		object.ObjectShade(frustum);
+		primitive_index_t index = 0;
+		while (!object.VertexShade(index))
+		{
+			index++;
+		}
+		checksum += object.GetChecksum();
+	}
+
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+	const uint32_t frames = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 20000;
+
+	std::vector<vertex16_t> vertices{};
+	std::vector<triangle_face_t> triangles{};
+	std::vector<skin_vertex_t> skins{};
+	BuildMesh(vertices, triangles);
+	BuildSkin(skins, 1);
+
+	PrimitiveSources::Vertex::Dynamic::Source vertexSource(vertices.data());
+	PrimitiveSources::Triangle::Dynamic::Source triangleSource(triangles.data());
+	PrimitiveSources::Skin::Dynamic::Source skinSource(skins.data());
+
+	transform16_rotate_translate_t bones[BoneCount]{};
+
+	BenchmarkObject object(vertexSource, triangleSource, skinSource);
+
+	printf("Integer World skinning, %u vertices, %u bones, %u frames\n", VertexCount, BoneCount, frames);
+
+	// Reference: bind pose load only, the checksum pass is included in every run.
+	uint32_t checksum = 0;
+	object.Bones = nullptr;
+	const double reference = Run(object, nullptr, frames, checksum);
+	printf("  bind pose:          %8.2f us/frame (reference)\n", reference / frames / 1000.0);
+
+	// Palette animation alone, to subtract from the skinned runs.
+	const auto animateStart = std::chrono::steady_clock::now();
+	for (uint32_t frame = 0; frame < frames; frame++)
+	{
+		AnimateBones(bones, frame);
+	}
+	const double animate = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - animateStart).count();
+
+	object.Bones = bones;
+	for (const uint8_t bonesPerVertex : { uint8_t(1), uint8_t(2), uint8_t(4) })
+	{
+		BuildSkin(skins, bonesPerVertex);
+		const double elapsed = Run(object, bones, frames, checksum);
+		const double skinning = (elapsed - reference - animate) / frames;
+		printf("  %u bone(s)/vertex:  %8.2f us/frame, skinning %6.2f ns/vertex (checksum %08x)\n",
+			bonesPerVertex, elapsed / frames / 1000.0, skinning / VertexCount, checksum);
+	}
+
+	return 0;
+}
@@ -0,0 +1,189 @@
+/*
+* Integer World headless per-object stage benchmark for multi-core hosts.
+* Renders a grid of lit, rotating icosahedra into an in-memory frame buffer and reports
+* frame time with the per-object stages (ObjectShade to ScreenShade) running on 1..N threads.
+* The default stage-by-stage pipeline runs first as reference; the final frame of every threaded run is checked to be identical.
+*
+* Build (Linux):
+*	g++ -std=c++17 -O2 -pthread -I<IntegerWorld>/src -I<IntegerSignal>/src -I<TaskScheduler>/src StageBenchmark.cpp -o StageBenchmark
+* Usage:
+*	./StageBenchmark [objects] [frames] [maxThreads]
+*/
+
+#include "../HostPlatform.h"
+#include "../HostSurface.h"
+
+#define _TASK_OO_CALLBACKS
+#include <TScheduler.hpp>
+
+#include <IntegerWorld.h>
+#include <IntegerWorldTasks.h>
+#include <IntegerWorldOutputs.h>
+#include <IntegerWorldParallel.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace IntegerWorld;
+
+static constexpr int16_t Width = 640;
+static constexpr int16_t Height = 360;
+
+static constexpr uint16_t MaxObjectCount = 1024;
+static constexpr uint16_t MaxDrawCallCount = 8192;
+
+using EngineType = EngineRenderTask<MaxObjectCount, MaxDrawCallCount, 64>;
+using ShapeObjectType = RenderObjects::Mesh::SimpleStaticMeshTriangleObject<Assets::Shapes::Icosahedron::VertexCount, Assets::Shapes::Icosahedron::TriangleCount>;
+
+/// <summary>
+/// Grid of lit icosahedra, rotated by frame number so every run renders the same frames.
+/// </summary>
+class BenchmarkScene : public IFrameListener
+{
+private:
+	static constexpr int16_t Spacing = Assets::Shapes::SHAPE_UNIT / 2;
+	static constexpr int16_t Distance = VERTEX16_UNIT * 2;
+
+private:
+	std::vector<std::unique_ptr<ShapeObjectType>> Shapes{};
+
+	RenderObjects::Background::FillObject Background{};
+	RenderObjects::Background::FragmentShaders::FillShader BackgroundShader{};
+	RenderObjects::Mesh::FragmentShaders::TriangleShade::FillShader TriangleShader{};
+
+	SceneShaders::LightSource::light_source_t Lights[2]{};
+	SceneShaders::LightSource::Shader LightShader{};
+
+	uint32_t Frame = 0;
+
+public:
+	BenchmarkScene(const uint16_t objectCount)
+		: IFrameListener()
+	{
+		const uint16_t columns = MaxValue<uint16_t>(1, uint16_t(sqrt(objectCount * 16 / 9)));
+		const uint16_t rows = (objectCount + columns - 1) / columns;
+
+		for (uint16_t i = 0; i < objectCount; i++)
+		{
+			ShapeObjectType* shape = new ShapeObjectType(Assets::Shapes::Icosahedron::Vertices, Assets::Shapes::Icosahedron::Triangles);
+			shape->Translation.x = int16_t((int32_t(i % columns) * 2 - (columns - 1)) * Spacing);
+			shape->Translation.y = int16_t((int32_t(i / columns) * 2 - (rows - 1)) * Spacing);
+			shape->Translation.z = Distance;
+			shape->SetAlbedo(Rgb8::ColorHsvFraction(UFraction16::GetScalar<uint16_t>(i, objectCount), UFRACTION16_1X, UFRACTION16_1X));
+			shape->SetMaterial(material_t{ 0, UFRACTION8_1X, UFRACTION8_1X / 2, UFRACTION8_1X / 2, 0, 0 });
+			shape->FragmentShader = &TriangleShader;
+			shape->SceneShader = &LightShader;
+			Shapes.emplace_back(shape);
+		}
+
+		Lights[0] = SceneShaders::LightSource::DirectionalLightSource(0xEDE9CB, { -VERTEX16_UNIT, -VERTEX16_UNIT, VERTEX16_UNIT }, UFRACTION16_1X / 4);
+		Lights[1] = SceneShaders::LightSource::PointLightSource(Rgb8::RED, { 0, 0, int16_t(Distance - Spacing * 4) }, 0, VERTEX16_UNIT * 2);
+		LightShader.SetLights(Lights, 2);
+		LightShader.AmbientLight = 0x0B1014;
+
+		Background.Color = Rgb8::BLACK;
+		Background.FragmentShader = &BackgroundShader;
+	}
+
+	bool Start(EngineType& engine)
+	{
+		engine.ClearObjects();
+		if (!engine.AddObject(&Background))
+			return false;
+
+		for (auto& shape : Shapes)
+		{
+			if (!engine.AddObject(shape.get()))
+				return false;
+		}
+
+		engine.SetFov((uint32_t(UFRACTION16_1X) * 30) / 100);
+		LightShader.CameraPosition = &engine.GetCameraControls()->Position;
+		engine.SetFrameListener(this);
+
+		return true;
+	}
+
+	void OnFrameStart() final
+	{
+		for (size_t i = 0; i < Shapes.size(); i++)
+		{
+			Shapes[i]->Rotation.x = angle_t(Frame * 97 + i * 331);
+			Shapes[i]->Rotation.y = angle_t(Frame * 193 + i * 89);
+			Shapes[i]->Rotation.z = angle_t(Frame * 41);
+		}
+		Frame++;
+	}
+};
+
+static bool RunBenchmark(const uint16_t objectCount, const uint32_t frames, const uint8_t threadCount, uint32_t& referenceHash)
+{
+	std::vector<Rgb8::color_t> frame(size_t(Width) * Height);
+	HostSurface::HashingSurface surface(frame, Width, Height);
+
+	TS::Scheduler scheduler;
+	std::unique_ptr<EngineType> engine(new EngineType(scheduler, surface));
+	std::unique_ptr<BenchmarkScene> scene(new BenchmarkScene(objectCount));
+	ThreadStageExecutor executor(MaxValue<uint8_t>(1, threadCount));
+
+	// 0 threads runs the default pipeline, without executor.
+	if (threadCount > 0)
+	{
+		engine->SetStageExecutor(&executor);
+	}
+	engine->Start();
+	if (!scene->Start(*engine))
+	{
+		printf("Failed to add %u objects.\n", objectCount);
+		return false;
+	}
+
+	// Warm up, then measure whole frames.
+	HostSurface::RenderFrames(scheduler, surface, 2);
+	const double frameMillis = HostSurface::RenderFrames(scheduler, surface, frames);
+
+	render_status_struct status{};
+	engine->GetRendererStatus(status);
+	engine->Stop();
+
+	if (threadCount == 0)
+	{
+		referenceHash = surface.GetLastHash();
+		printf(" default:");
+	}
+	else
+	{
+		printf("%3u threads:", executor.GetWorkerCount());
+	}
+
+	printf(" frame %8.3f ms, render %8.3f ms, rasterize %8.3f ms, fragments %5u, %s\n",
+		frameMillis,
+		status.Render / 1000.0, status.Rasterize / 1000.0, status.FragmentsDrawn,
+		surface.GetLastHash() == referenceHash ? "match" : "MISMATCH");
+
+	return surface.GetLastHash() == referenceHash;
+}
+
+int main(int argc, char** argv)
+{
+	const uint16_t objects = argc > 1 ? uint16_t(MinValue(atoi(argv[1]), int(MaxObjectCount - 1))) : 400;
+	const uint32_t frames = argc > 2 ? uint32_t(atoi(argv[2])) : 60;
+	const uint8_t maxThreads = argc > 3 ? uint8_t(atoi(argv[3])) : uint8_t(MaxValue(1u, std::thread::hardware_concurrency()));
+
+	printf("Integer World per-object stage benchmark %dx%d, %u objects, %u frames (ms per frame)\n", Width, Height, objects, frames);
+
+	bool success = true;
+	uint32_t referenceHash = 0;
+	success &= RunBenchmark(objects, frames, 0, referenceHash);
+	for (uint8_t threads = 1; threads <= maxThreads; threads = (threads < maxThreads && threads * 2 > maxThreads) ? maxThreads : threads * 2)
+	{
+		success &= RunBenchmark(objects, frames, threads, referenceHash);
+		if (threads == maxThreads)
+			break;
+	}
+
+	return success ? 0 : 1;
+}
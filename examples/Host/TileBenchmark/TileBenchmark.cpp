@@ -0,0 +1,173 @@
+/*
+* Integer World headless tile rasterizer benchmark for multi-core hosts.
+* Renders the animated demo scene into an in-memory frame buffer and reports
+* rasterization time per frame for serial and tiled rasterization with increasing thread counts,
+* then with the hardware concurrency on 16x16 tiles.
+* Every tiled frame is checked against a serial reference of the same frame, to be bit-identical.
+*
+* Build (Linux):
+*	g++ -std=c++17 -O2 -pthread -I<IntegerWorld>/src -I<IntegerSignal>/src -I<TaskScheduler>/src TileBenchmark.cpp -o TileBenchmark
+* Usage:
+*	./TileBenchmark [width] [height] [frames] [maxThreads]
+*/
+
+#include "../HostPlatform.h"
+
+#define _TASK_OO_CALLBACKS
+#include <TScheduler.hpp>
+
+#include <IntegerWorld.h>
+#include <IntegerWorldTasks.h>
+#include <IntegerWorldOutputs.h>
+#include <IntegerWorldExperimental.h>
+#include <IntegerWorldParallel.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace IntegerWorld;
+
+using EngineType = EngineRenderTask<AnimatedDemoScene::ObjectsCount, AnimatedDemoScene::MaxDrawCallCount>;
+
+/// <summary>
+/// Heap-backed frame buffer surface that counts presented frames.
+/// </summary>
+class BenchmarkSurface : public FrameBufferOutput::BufferSurface
+{
+public:
+	uint32_t FrameCount = 0;
+
+public:
+	BenchmarkSurface(std::vector<Rgb8::color_t>& frame, const int16_t width, const int16_t height)
+		: FrameBufferOutput::BufferSurface(frame.data(), width, height)
+	{
+	}
+
+	void FlipSurface() final
+	{
+		FrameCount++;
+	}
+};
+
+/// <summary>
+/// Rasterizes each frame serially into a reference buffer, then with the tile rasterizer into the surface.
+/// Accumulates the tiled rasterization time and counts mismatching frames.
+/// </summary>
+class VerifyingRasterizer : public IFragmentRasterizer
+{
+private:
+	FrameBufferOutput::BufferSurface& Surface;
+	std::vector<Rgb8::color_t> Reference;
+	FrameBufferOutput::BufferSurface ReferenceSurface;
+	SurfacedWindowRasterizer ReferenceRasterizer;
+	TileRasterizer& Tiles;
+
+public:
+	double SerialMicros = 0;
+	double TiledMicros = 0;
+	uint32_t Mismatches = 0;
+
+public:
+	VerifyingRasterizer(FrameBufferOutput::BufferSurface& surface, TileRasterizer& tiles)
+		: Surface(surface)
+		, Reference(size_t(surface.GetWidth()) * surface.GetHeight())
+		, ReferenceSurface(Reference.data(), surface.GetWidth(), surface.GetHeight())
+		, ReferenceRasterizer(ReferenceSurface)
+		, Tiles(tiles)
+	{
+		ReferenceRasterizer.UpdateDimensions();
+	}
+
+	void RasterizeFragments(IRenderObject* const* objects, const ordered_fragment_t* fragments, const primitive_index_t fragmentCount) final
+	{
+		const size_t pixelCount = Reference.size();
+		memcpy(Reference.data(), Surface.GetBuffer(), pixelCount * sizeof(Rgb8::color_t));
+
+		auto start = std::chrono::steady_clock::now();
+		for (primitive_index_t i = 0; i < fragmentCount; i++)
+		{
+			objects[fragments[i].ObjectIndex]->FragmentShade(ReferenceRasterizer, fragments[i].FragmentIndex);
+		}
+		SerialMicros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+		start = std::chrono::steady_clock::now();
+		Tiles.RasterizeFragments(objects, fragments, fragmentCount);
+		TiledMicros += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+		if (memcmp(Reference.data(), Surface.GetBuffer(), pixelCount * sizeof(Rgb8::color_t)) != 0)
+		{
+			Mismatches++;
+		}
+	}
+};
+
+static bool RunBenchmark(const int16_t width, const int16_t height, const uint32_t frames, const uint8_t threadCount)
+{
+	std::vector<Rgb8::color_t> frame(size_t(width) * height);
+	BenchmarkSurface surface(frame, width, height);
+
+	TS::Scheduler scheduler;
+	EngineType* engine = new EngineType(scheduler, surface);
+	AnimatedDemoScene* scene = new AnimatedDemoScene(scheduler);
+
+	bool success = false;
+	{
+		// 0 threads: hardware concurrency with small square tiles.
+		std::unique_ptr<TileRasterizer> tilesOwner(threadCount == 0 ?
+			new TileRasterizer(surface, 0, 16, 16)
+			: new TileRasterizer(surface, threadCount));
+		TileRasterizer& tiles = *tilesOwner;
+		VerifyingRasterizer verifier(surface, tiles);
+		engine->SetFragmentRasterizer(&verifier);
+
+		engine->Start();
+		if (scene->Start(*engine, width, height))
+		{
+			while (surface.FrameCount < frames)
+			{
+				scheduler.execute();
+			}
+
+			printf("%3u threads, %4u tiles: serial %8.2f ms, tiled %8.2f ms, speedup %5.2fx, mismatches %u\n",
+				tiles.GetWorkerCount(), tiles.GetTileCount(),
+				verifier.SerialMicros / 1000.0 / frames,
+				verifier.TiledMicros / 1000.0 / frames,
+				verifier.SerialMicros / verifier.TiledMicros,
+				verifier.Mismatches);
+
+			success = verifier.Mismatches == 0;
+		}
+		engine->Stop();
+	}
+
+	delete scene;
+	delete engine;
+
+	return success;
+}
+
+int main(int argc, char** argv)
+{
+	const int16_t width = argc > 1 ? int16_t(atoi(argv[1])) : 1920;
+	const int16_t height = argc > 2 ? int16_t(atoi(argv[2])) : 1080;
+	const uint32_t frames = argc > 3 ? uint32_t(atoi(argv[3])) : 30;
+	const uint8_t maxThreads = argc > 4 ? uint8_t(atoi(argv[4])) : uint8_t(MaxValue(1u, std::thread::hardware_concurrency()));
+
+	printf("Integer World tile rasterizer benchmark %dx%d, %u frames (ms per frame)\n", width, height, frames);
+
+	bool success = true;
+	for (uint8_t threads = 1; threads <= maxThreads; threads = (threads < maxThreads && threads * 2 > maxThreads) ? maxThreads : threads * 2)
+	{
+		success &= RunBenchmark(width, height, frames, threads);
+		if (threads == maxThreads)
+			break;
+	}
+	success &= RunBenchmark(width, height, frames, 0);
+
+	return success ? 0 : 1;
+}
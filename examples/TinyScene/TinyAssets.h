@@ -186,7 +186,7 @@ namespace Assets
 		public:
 			GlobalLightSceneShader() : ISceneShader() {}
 
-			Rgb8::color_t GetLitColor(const Rgb8::color_t albedo, const material_t& /*material*/, const vertex16_t& /*position*/, const vertex16_t& normal)
+			Rgb8::color_t GetLitColor(const Rgb8::color_t albedo, const material_t& /*material*/, const vertex16_t& /*position*/, const vertex16_t& normal) const
 			{
 				// Calculate normal gain based on normal x and y components (light is from top-left corner).
 				const int8_t normalGain = SignedRightShift(normal.y, 7) + SignedRightShift(normal.x, 7);
@@ -10,6 +10,8 @@ from obj_converter import (
     read_text,
     write_text,
 )
+from obj_converter.assetpack import AssetPackBuilder
+from obj_converter.parser import read_skin
 
 try:
     from obj_converter.imageinfo import get_image_size
@@ -33,6 +35,14 @@ def _find_texture_for_obj(obj_path: str):
     return None, None
 
 
+def _find_skin_for_obj(obj_path: str):
+    stem, _ = os.path.splitext(obj_path)
+    skin_path = stem + ".skin"
+    if os.path.isfile(skin_path):
+        return read_skin(read_text(skin_path))
+    return None
+
+
 def main() -> int:
     parser = argparse.ArgumentParser(description="Convert .obj files to custom C++ arrays.")
     parser.add_argument("--base-dir", default="", help="Base directory containing Input/ and Output/.")
@@ -43,6 +53,9 @@ def main() -> int:
     parser.add_argument("--no-uv-mips", action="store_true", help="Do not emit UV mip levels.")
     parser.add_argument("--no-force-pow2", action="store_true", help="Use actual texture size (no power-of-two upscaling).")
     parser.add_argument("--no-uv", action="store_true", help="Disable UV emission regardless of texture presence.")
+    parser.add_argument("--compact", action="store_true", help="Emit 8-bit indices and int8 vertices for meshes of up to 256 vertices.")
+    parser.add_argument("--asset-pack", default="", help="Also write every converted mesh to this binary asset pack, one mesh index per output.")
+    parser.add_argument("--morph-dir", default="", help="Directory of .obj frames, in file name order, emitted as morph targets of each converted mesh.")
     args = parser.parse_args()
 
     input_dir = args.input_dir or (os.path.join(args.base_dir, "Input") if args.base_dir else os.path.join(os.getcwd(), "Input"))
@@ -68,6 +81,21 @@ def main() -> int:
             print(f"No configurations match filter: {args.config_filter}")
             return 4
 
+    morph_frames = []
+    if args.morph_dir:
+        if not os.path.isdir(args.morph_dir):
+            print(f"Error: Morph directory not found: {args.morph_dir}")
+            return 5
+        for frame_name, frame_path in iter_obj_files(args.morph_dir):
+            try:
+                morph_frames.append(read_obj(read_text(frame_path))[0])
+                print(f"[MORPH] {frame_name}")
+            except Exception as e:
+                print(f"  Morph frame failure: {frame_name}: {e}")
+
+    asset_pack = AssetPackBuilder() if args.asset_pack else None
+    asset_pack_mesh = 0
+
     for name, path in pairs:
         print(f"[PROCESS] {name}")
         try:
@@ -98,6 +126,14 @@ def main() -> int:
                 print("  Texture: not found -> UVs will be skipped")
             emit_uv = False
 
+        try:
+            skin_weights = _find_skin_for_obj(path)
+        except Exception as e:
+            print(f"  Skin read failure: {e}")
+            skin_weights = None
+        if skin_weights is not None:
+            print(f"  Skin: {len(skin_weights)} vertices (sidecar)")
+
         stem, _ = os.path.splitext(name)
         object_out_dir = os.path.join(output_dir, stem)
         ensure_dir(object_out_dir)
@@ -120,8 +156,15 @@ def main() -> int:
                 texture_width=tex_w,
                 texture_height=tex_h,
                 uv_force_pow2=not args.no_force_pow2,
+                compact_storage=args.compact,
+                asset_pack=asset_pack,
+                asset_pack_mesh=asset_pack_mesh,
+                morph_frames=tuple(morph_frames),
+                skin_weights=skin_weights,
                 # Using converter defaults for: uv_v_flip=True, uv_wrap_mode="auto"
             )
+            if asset_pack is not None:
+                asset_pack_mesh += 1
             out_file = os.path.join(object_out_dir, f"{stem}{cfg['name']}.txt")
             try:
                 write_text(out_file, text)
@@ -129,6 +172,13 @@ def main() -> int:
             except Exception as e:
                 print(f"    Write failure: {e}")
 
+    if asset_pack is not None:
+        try:
+            asset_pack.write(args.asset_pack)
+            print(f"[PACK] {asset_pack_mesh} meshes -> {args.asset_pack}")
+        except Exception as e:
+            print(f"  Pack write failure: {e}")
+
     return 0
 
 
@@ -0,0 +1,85 @@
+"""
+Binary asset pack writer, matching src/Framework/AssetPack.h (version 1, little-endian).
+Layout: header, chunk table, then chunk data at 8 byte aligned offsets.
+"""
+import struct
+from typing import List, Sequence, Tuple
+
+ASSET_PACK_MAGIC = 0x4B505749  # "IWPK"
+ASSET_PACK_VERSION = 1
+ASSET_PACK_ALIGNMENT = 8
+
+# AssetPackChunkEnum values and element formats.
+CHUNK_VERTICES = 1
+CHUNK_VERTICES8 = 2
+CHUNK_TRIANGLES = 3
+CHUNK_TRIANGLES8 = 4
+CHUNK_EDGES = 5
+CHUNK_FACE_NORMALS = 6
+CHUNK_VERTEX_NORMALS = 7
+CHUNK_UVS = 8
+CHUNK_GROUPS = 9
+CHUNK_ALBEDOS = 10
+CHUNK_TEXTURE = 11
+CHUNK_TRIANGLES32 = 12
+
+ELEMENT_FORMATS = {
+    CHUNK_VERTICES: "<hhh",
+    CHUNK_VERTICES8: "<bbb",
+    CHUNK_TRIANGLES: "<HHH",
+    CHUNK_TRIANGLES8: "<BBB",
+    CHUNK_EDGES: "<HH",
+    CHUNK_FACE_NORMALS: "<hhh",
+    CHUNK_VERTEX_NORMALS: "<hhh",
+    CHUNK_UVS: "<BB",
+    CHUNK_GROUPS: "<B",
+    CHUNK_ALBEDOS: "<I",
+    CHUNK_TEXTURE: "<I",
+    CHUNK_TRIANGLES32: "<III",
+}
+
+HEADER_FORMAT = "<IHHII"
+CHUNK_FORMAT = "<BBHIII"
+
+
+def _align(offset: int) -> int:
+    return (offset + ASSET_PACK_ALIGNMENT - 1) & ~(ASSET_PACK_ALIGNMENT - 1)
+
+
+class AssetPackBuilder:
+    """
+    Collects chunks for one pack. Elements are tuples (or ints for single value formats) in the chunk's element layout.
+    Texture parameter: width shift in the low nibble, height shift in the high nibble.
+    """
+
+    def __init__(self) -> None:
+        self.chunks: List[Tuple[int, int, int, int, bytes]] = []
+
+    def add_chunk(self, chunk_type: int, mesh: int, elements: Sequence, parameter: int = 0) -> None:
+        element_format = ELEMENT_FORMATS[chunk_type]
+        data = bytearray()
+        for element in elements:
+            values = element if isinstance(element, (tuple, list)) else (element,)
+            data += struct.pack(element_format, *(int(v) for v in values))
+        self.chunks.append((chunk_type, parameter & 0xFF, mesh & 0xFFFF, len(elements), bytes(data)))
+
+    def to_bytes(self) -> bytes:
+        offset = _align(struct.calcsize(HEADER_FORMAT) + len(self.chunks) * struct.calcsize(CHUNK_FORMAT))
+        table = bytearray()
+        offsets = []
+        for chunk_type, parameter, mesh, count, data in self.chunks:
+            table += struct.pack(CHUNK_FORMAT, chunk_type, parameter, mesh, offset, count, 0)
+            offsets.append(offset)
+            offset = _align(offset + len(data))
+
+        pack = bytearray(offset)
+        header = struct.pack(HEADER_FORMAT, ASSET_PACK_MAGIC, ASSET_PACK_VERSION, len(self.chunks), offset, 0)
+        pack[0:len(header)] = header
+        pack[len(header):len(header) + len(table)] = table
+        for (_, _, _, _, data), chunk_offset in zip(self.chunks, offsets):
+            pack[chunk_offset:chunk_offset + len(data)] = data
+        return bytes(pack)
+
+    def write(self, path: str) -> None:
+        with open(path, "wb") as f:
+            f.write(self.to_bytes())
@@ -1,12 +1,307 @@
 from typing import List, Tuple, Optional, Dict
 import numpy as np
 
+from .assetpack import (
+    AssetPackBuilder, CHUNK_VERTICES, CHUNK_VERTICES8, CHUNK_TRIANGLES, CHUNK_TRIANGLES8, CHUNK_TRIANGLES32,
+    CHUNK_FACE_NORMALS, CHUNK_VERTEX_NORMALS, CHUNK_UVS, CHUNK_GROUPS,
+)
+
 Vertex = Tuple[float, float, float]
 TexCoord = Tuple[float, ...]
 Normal = Tuple[float, float, float]
 IndexTriple = Tuple[int, Optional[int], Optional[int]]
 Face = Tuple[IndexTriple, ...]
 
+MESHLET_NORMAL_SCALE = 8192
+MESHLET_CUTOFF_1X = 32768
+VERTEX8_MIN = -128
+VERTEX8_MAX = 127
+INDEX8_VERTEX_COUNT = 256
+INDEX16_VERTEX_COUNT = 65536
+SKIN_BONES = 4
+SKIN_WEIGHT_1X = 128
+
+
+def build_meshlets(
+    positions: np.ndarray,
+    triangles: List[Tuple[int, int, int]],
+    max_triangles: int = 64,
+    cone_limit: float = 0.7,
+) -> Tuple[List[int], List[Dict[str, object]]]:
+    """
+    Greedy meshlet clustering for whole-cluster culling (meshlet_t).
+      - Grows each meshlet from the first unassigned triangle over triangles sharing a vertex position,
+        preferring normals close to the meshlet's average normal and centroids close to its center.
+        A meshlet is closed early when no neighbour normal is within cone_limit (cosine) of its average normal:
+        narrower cones cull more often, at the cost of more and smaller meshlets.
+      - Bounds: sphere around the vertex AABB center; normal cone from the geometric (emitted winding) normals,
+        with cutoff = sine of the cone half-angle, padded for integer rotation. Wide cones disable cone culling.
+    Returns the new triangle order and one dict per meshlet, with bounds in the units of positions.
+    """
+    tri = np.asarray(triangles, dtype=int).reshape(-1, 3)
+    pts = np.asarray(positions, dtype=float).reshape(-1, 3)
+    triangle_count = len(tri)
+    if triangle_count == 0:
+        return [], []
+
+    face_normals = np.cross(pts[tri[:, 1]] - pts[tri[:, 0]], pts[tri[:, 2]] - pts[tri[:, 0]])
+    lengths = np.linalg.norm(face_normals, axis=1)
+    units = np.zeros_like(face_normals)
+    valid = lengths > 1e-9
+    units[valid] = face_normals[valid] / lengths[valid][:, None]
+    centroids = pts[tri].mean(axis=1)
+
+    # Adjacency by position, so split vertices (e.g. UV seams) still connect triangles.
+    vertex_keys = [tuple(p) for p in pts]
+    vertex_triangles: Dict[Tuple[float, ...], List[int]] = {}
+    for t, (a, b, c) in enumerate(tri):
+        for v in (a, b, c):
+            vertex_triangles.setdefault(vertex_keys[v], []).append(t)
+
+    spread = max(1.0, float(np.max(np.ptp(pts, axis=0)))) * 0.25
+
+    assigned = np.zeros(triangle_count, dtype=bool)
+    order: List[int] = []
+    meshlets: List[Dict[str, object]] = []
+    seed = 0
+    while len(order) < triangle_count:
+        while assigned[seed]:
+            seed += 1
+        cluster = [seed]
+        assigned[seed] = True
+        axis_sum = units[seed].copy()
+        centroid_sum = centroids[seed].copy()
+        candidates = set()
+        for v in tri[seed]:
+            candidates.update(t for t in vertex_triangles[vertex_keys[v]] if not assigned[t])
+
+        while len(cluster) < max_triangles:
+            axis = axis_sum / max(1e-9, float(np.linalg.norm(axis_sum)))
+            center = centroid_sum / len(cluster)
+            if not candidates:
+                # Disconnected part, continue with the nearest unassigned triangle if it's close.
+                remaining = np.flatnonzero(~assigned)
+                if len(remaining) == 0:
+                    break
+                distances = np.linalg.norm(centroids[remaining] - center, axis=1)
+                nearest = int(remaining[int(np.argmin(distances))])
+                if float(np.min(distances)) > spread:
+                    break
+                candidates.add(nearest)
+            # Keep the normal cone narrow enough for cone culling, degenerate triangles always fit.
+            fitting = [t for t in candidates if not valid[t] or float(np.dot(units[t], axis)) >= cone_limit]
+            if not fitting:
+                break
+            best = max(fitting, key=lambda t: (
+                float(np.dot(units[t], axis)) - float(np.linalg.norm(centroids[t] - center)) / spread, -t))
+            candidates.discard(best)
+            cluster.append(best)
+            assigned[best] = True
+            axis_sum += units[best]
+            centroid_sum += centroids[best]
+            for v in tri[best]:
+                candidates.update(t for t in vertex_triangles[vertex_keys[v]] if not assigned[t])
+
+        first = len(order)
+        order.extend(cluster)
+
+        cluster_vertices = pts[np.unique(tri[cluster].reshape(-1))]
+        center = np.round((np.min(cluster_vertices, axis=0) + np.max(cluster_vertices, axis=0)) / 2.0)
+        radius = int(np.ceil(np.max(np.linalg.norm(cluster_vertices - center, axis=1)))) + 1
+
+        cone_axis = (0, 0, MESHLET_NORMAL_SCALE)
+        cutoff = MESHLET_CUTOFF_1X
+        cluster_units = units[cluster][valid[cluster]]
+        if len(cluster_units) > 0:
+            axis_float = np.sum(cluster_units, axis=0)
+            if np.linalg.norm(axis_float) > 1e-9:
+                axis_float /= np.linalg.norm(axis_float)
+                cone_axis = tuple(int(round(x * MESHLET_NORMAL_SCALE)) for x in axis_float)
+                quantized = np.array(cone_axis, dtype=float) / MESHLET_NORMAL_SCALE
+                min_dot = float(np.min(cluster_units @ quantized)) / float(np.linalg.norm(quantized))
+                if min_dot > 0.1:
+                    # Sine of the half-angle, padded for axis quantization and fixed-point rotation.
+                    sine = float(np.sqrt(max(0.0, 1.0 - min_dot * min_dot))) + 1.0 / 256
+                    cutoff = min(MESHLET_CUTOFF_1X, int(np.ceil(sine * MESHLET_CUTOFF_1X)))
+
+        meshlets.append({
+            "center": tuple(int(x) for x in center),
+            "radius": radius,
+            "cone_axis": cone_axis,
+            "cone_cutoff": cutoff,
+            "first_triangle": first,
+            "triangle_count": len(cluster),
+        })
+
+    return order, meshlets
+
+
+def quantize_vertices8(positions: np.ndarray) -> Tuple[int, np.ndarray]:
+    """
+    Smallest left shift that fits the vertices in int8, and the int8 vertices (rounded to nearest).
+    Decoded vertices are the int8 values shifted left, as Vertex::Static::Int8Source reads them.
+    """
+    shift = 0
+    while True:
+        scaled = np.floor(positions / float(1 << shift) + 0.5).astype(int)
+        if scaled.size == 0 or (scaled.min() >= VERTEX8_MIN and scaled.max() <= VERTEX8_MAX) or shift >= 8:
+            return shift, np.clip(scaled, VERTEX8_MIN, VERTEX8_MAX)
+        shift += 1
+
+
+def quantize_skin(influences: List[Tuple[int, float]]) -> Tuple[List[int], List[int]]:
+    """
+    Up to SKIN_BONES heaviest (bone, weight) influences, with weights rounded to sum to SKIN_WEIGHT_1X (largest remainder).
+    Vertices without influences are bound to bone 0.
+    """
+    kept = sorted([(b, w) for b, w in influences if w > 0 and 0 <= b <= 255], key=lambda bw: -bw[1])[:SKIN_BONES]
+    if not kept:
+        kept = [(0, 1.0)]
+    total = sum(w for _, w in kept)
+    scaled = [w * SKIN_WEIGHT_1X / total for _, w in kept]
+    weights = [int(np.floor(s)) for s in scaled]
+    for i in sorted(range(len(kept)), key=lambda i: weights[i] - scaled[i])[:SKIN_WEIGHT_1X - sum(weights)]:
+        weights[i] += 1
+    bones = [b for b, _ in kept]
+    pad = SKIN_BONES - len(kept)
+    return bones + [0] * pad, weights + [0] * pad
+
+
+def decimate_mesh(
+    positions: np.ndarray,
+    triangles: List[Tuple[int, int, int]],
+    target_triangles: int,
+) -> Tuple[np.ndarray, List[Tuple[int, int, int]]]:
+    """
+    Quadric error metric edge-collapse decimation (Garland-Heckbert), for lower levels of detail.
+      - Vertices are welded by position first, so split vertices collapse together.
+      - Each collapse moves an edge to the lowest-error of its end points and midpoint.
+        Collapses that would flip a triangle's normal are skipped. Winding is preserved.
+    Returns compacted positions and triangles, with at most target_triangles triangles when reachable.
+    """
+    import heapq
+
+    pts_in = np.asarray(positions, dtype=float).reshape(-1, 3)
+    weld: Dict[Tuple[float, ...], int] = {}
+    remap = []
+    pts: List[np.ndarray] = []
+    for p in pts_in:
+        key = tuple(p)
+        if key not in weld:
+            weld[key] = len(pts)
+            pts.append(p.copy())
+        remap.append(weld[key])
+
+    faces: List[Optional[List[int]]] = []
+    for a, b, c in triangles:
+        face = [remap[a], remap[b], remap[c]]
+        if len(set(face)) == 3:
+            faces.append(face)
+
+    vertex_faces: List[set] = [set() for _ in pts]
+    for f, face in enumerate(faces):
+        for v in face:
+            vertex_faces[v].add(f)
+
+    def face_normal(face: List[int], moved: int = -1, target: Optional[np.ndarray] = None) -> np.ndarray:
+        a, b, c = (target if v == moved else pts[v] for v in face)
+        return np.cross(b - a, c - a)
+
+    quadrics = [np.zeros((4, 4)) for _ in pts]
+    for face in faces:
+        n = face_normal(face)
+        area = float(np.linalg.norm(n))
+        if area <= 1e-12:
+            continue
+        n = n / area
+        plane = np.append(n, -float(np.dot(n, pts[face[0]])))
+        quadric = np.outer(plane, plane) * area
+        for v in face:
+            quadrics[v] += quadric
+
+    def collapse_target(u: int, v: int) -> Tuple[float, np.ndarray]:
+        q = quadrics[u] + quadrics[v]
+        best = None
+        for candidate in (pts[u], pts[v], (pts[u] + pts[v]) / 2.0):
+            h = np.append(candidate, 1.0)
+            error = float(h @ q @ h)
+            if best is None or error < best[0]:
+                best = (error, candidate)
+        return best
+
+    version = [0] * len(pts)
+    heap: List[Tuple[float, int, int, int, int]] = []
+
+    def push_edges(u: int) -> None:
+        neighbours = set()
+        for f in vertex_faces[u]:
+            neighbours.update(faces[f])
+        neighbours.discard(u)
+        for w in neighbours:
+            error, _ = collapse_target(u, w)
+            heapq.heappush(heap, (error, u, w, version[u], version[w]))
+
+    for u in range(len(pts)):
+        push_edges(u)
+
+    face_count = len(faces)
+    while face_count > target_triangles and heap:
+        _, u, v, version_u, version_v = heapq.heappop(heap)
+        if version[u] != version_u or version[v] != version_v:
+            continue
+        _, target = collapse_target(u, v)
+
+        # Skip collapses that flip a remaining triangle.
+        flips = False
+        for moved in (u, v):
+            for f in vertex_faces[moved]:
+                face = faces[f]
+                if u in face and v in face:
+                    continue
+                before = face_normal(face)
+                after = face_normal(face, moved, target)
+                if float(np.dot(before, after)) < 0.0:
+                    flips = True
+                    break
+            if flips:
+                break
+        if flips:
+            continue
+
+        pts[u] = target
+        quadrics[u] = quadrics[u] + quadrics[v]
+        for f in list(vertex_faces[v]):
+            face = faces[f]
+            vertex_faces[v].discard(f)
+            if u in face:
+                for w in face:
+                    if w != v:
+                        vertex_faces[w].discard(f)
+                faces[f] = None
+                face_count -= 1
+            else:
+                face[face.index(v)] = u
+                vertex_faces[u].add(f)
+        version[u] += 1
+        version[v] += 1
+        push_edges(u)
+
+    used: Dict[int, int] = {}
+    out_positions: List[np.ndarray] = []
+    out_triangles: List[Tuple[int, int, int]] = []
+    for face in faces:
+        if face is None:
+            continue
+        indices = []
+        for v in face:
+            if v not in used:
+                used[v] = len(out_positions)
+                out_positions.append(pts[v])
+            indices.append(used[v])
+        out_triangles.append((indices[0], indices[1], indices[2]))
+
+    return np.array(out_positions, dtype=float).reshape(-1, 3), out_triangles
+
 
 def convert_to_custom_format(
     vertices: List[Vertex],
@@ -29,6 +324,16 @@ def convert_to_custom_format(
     uv_force_pow2: bool = True,
     uv_v_flip: bool = True,
     uv_wrap_mode: str = "auto",
+    emit_meshlets: bool = False,
+    meshlet_max_triangles: int = 64,
+    meshlet_cone_limit: float = 0.7,
+    lod_ratios: Tuple[float, ...] = (),
+    compact_storage: bool = False,
+    vertex8_max_error: float = 2.0,
+    asset_pack: Optional[AssetPackBuilder] = None,
+    asset_pack_mesh: int = 0,
+    morph_frames: Tuple[List[Vertex], ...] = (),
+    skin_weights: Optional[List[List[Tuple[int, float]]]] = None,
 ) -> str:
     """
     Normal orientation and winding:
@@ -36,6 +341,23 @@ def convert_to_custom_format(
       - CCW mode (inverted): geometric normals derived from CCW order (v1, v2, v3), indices emitted CCW.
       Corner vertex normals and averaged face normals are re-oriented to match the chosen geometric normal
       to avoid cancellation and ensure consistent accumulation.
+    Meshlets (emit_meshlets): triangles are reordered into clusters of up to meshlet_max_triangles,
+      all per-triangle outputs follow the new order.
+    Levels of detail (lod_ratios): one decimated vertex and triangle set per triangle count ratio,
+      as VerticesLod<N> and TrianglesLod<N>. Geometry only, other per-triangle outputs are for the full mesh.
+    Compact storage (compact_storage, opt-in): meshes of up to 256 vertices emit triangle8_face_t indices (Triangle::Static::Uint8Source).
+      Their vertices are emitted as vertex8_t with a VertexScaleShift (Vertex::Static::Int8Source) when no vertex moves
+      by more than vertex8_max_error vertex units. Levels of detail use the same formats.
+      Objects must be built with the 8-bit sources, not the vertex16_t/triangle_face_t SimpleStatic objects.
+      vertex8_t can't be scaled by UpSize/DownSize, so the header static_asserts they stay 1; scale with VertexScaleShift instead.
+    Meshes beyond 65536 vertices emit triangle32_face_t indices (Triangle::Static::Uint32Source), for INTEGER_WORLD_INDEX32 builds.
+    Asset pack (asset_pack): the mesh's vertices, triangles, groups, normals and UVs are also added to the pack
+      as chunks of mesh index asset_pack_mesh. Levels of detail and meshlets stay header only.
+    Morph targets (morph_frames): one target per frame, each a vertex list matching the mesh's vertices.
+      Emitted as sparse int8 MorphDeltas with a left shift per target in MorphTargets (Morph::Static::Source),
+      only for vertices that move. BoundingRadius includes every target at full weight. Header only.
+    Skin (skin_weights): per-vertex (bone, weight) lists, see parser.read_skin. The 4 heaviest bones are kept
+      and weights are quantized to sum to UFRACTION8_1X, emitted as Skin (Skin::Static::Source) with BoneCount. Header only.
     """
     vertex_unit = 128
     NORMAL_SCALE = 8192
@@ -92,16 +414,106 @@ def convert_to_custom_format(
     else:
         processed_vertices = np.array(vertices, dtype=float)
 
+    quantized_vertices = np.array(
+        [[round(v[0] * vertex_unit), round(v[1] * vertex_unit), round(v[2] * vertex_unit)] for v in processed_vertices],
+        dtype=float).reshape(-1, 3)
+
+    # Compact storage formats, see docstring.
+    triangles8 = compact_storage and len(quantized_vertices) <= INDEX8_VERTEX_COUNT
+    vertices8 = False
+    vertex8_shift = 0
+    vertex8_error = 0.0
+    if triangles8 and len(quantized_vertices) > 0:
+        vertex8_shift, vertices8_values = quantize_vertices8(quantized_vertices)
+        decoded_vertices = (vertices8_values * (1 << vertex8_shift)).astype(float)
+        vertex8_error = float(np.max(np.abs(decoded_vertices - quantized_vertices)))
+        vertices8 = vertex8_error <= vertex8_max_error
+    vertex_type = "vertex8_t" if vertices8 else "vertex16_t"
+    # Beyond 16-bit indices, the mesh needs an INTEGER_WORLD_INDEX32 build (Triangle::Static::Uint32Source).
+    triangles32 = len(quantized_vertices) > INDEX16_VERTEX_COUNT
+    triangle_type = "triangle8_face_t" if triangles8 else ("triangle32_face_t" if triangles32 else "triangle_face_t")
+
     # Vertices
-    output_lines.append("    static constexpr vertex16_t Vertices[] PROGMEM\n    {")
-    for v in processed_vertices:
-        output_lines.append(
-            f"        {{(UpSize*(int32_t)({round(v[0] * vertex_unit)}))/DownSize , "
-            f"(UpSize*(int32_t)({round(v[1] * vertex_unit)}))/DownSize , "
-            f"(UpSize*(int32_t)({round(v[2] * vertex_unit)}))/DownSize}},"
-        )
+    output_lines.append(f"    static constexpr {vertex_type} Vertices[] PROGMEM\n    {{")
+    if vertices8:
+        for x, y, z in vertices8_values:
+            output_lines.append(f"        {{{x}, {y}, {z}}},")
+        # The emitted mesh is the decoded one.
+        quantized_vertices = decoded_vertices
+    else:
+        for v in quantized_vertices:
+            output_lines.append(
+                f"        {{(UpSize*(int32_t)({int(v[0])}))/DownSize , "
+                f"(UpSize*(int32_t)({int(v[1])}))/DownSize , "
+                f"(UpSize*(int32_t)({int(v[2])}))/DownSize}},"
+            )
     output_lines.append("    };\n")
-    output_lines.append("    constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);\n")
+    output_lines.append(f"    constexpr auto VertexCount = sizeof(Vertices) / sizeof({vertex_type});\n")
+    if vertices8:
+        output_lines.append(f"    static constexpr uint8_t VertexScaleShift = {vertex8_shift};\n")
+        output_lines.append("    static_assert(UpSize == 1 && DownSize == 1, \"vertex8_t vertices aren't scaled by UpSize/DownSize, use VertexScaleShift.\");\n")
+
+    # Morph targets, as deltas from the emitted vertices. Frames are centered as the base mesh.
+    morphed_vertices: List[np.ndarray] = []
+    if morph_frames and len(quantized_vertices) > INDEX16_VERTEX_COUNT:
+        print("  Morph targets skipped: more than 65536 vertices.")
+    elif morph_frames:
+        morph_deltas: List[Tuple[int, int, int, int]] = []
+        morph_targets: List[Tuple[int, int, int]] = []
+        for frame_index, frame in enumerate(morph_frames):
+            if len(frame) != len(quantized_vertices):
+                print(f"  Morph frame {frame_index} skipped: {len(frame)} vertices, mesh has {len(quantized_vertices)}.")
+                morph_targets.append((len(morph_deltas), 0, 0))
+                continue
+            frame_np = np.array(frame, dtype=float)
+            if center_vertices:
+                frame_np = frame_np - center
+            frame_quantized = np.array(
+                [[round(v[0] * vertex_unit), round(v[1] * vertex_unit), round(v[2] * vertex_unit)] for v in frame_np],
+                dtype=float).reshape(-1, 3)
+            shift, deltas8 = quantize_vertices8(frame_quantized - quantized_vertices)
+            moved = [i for i in range(len(deltas8)) if np.any(deltas8[i] != 0)]
+            morph_targets.append((len(morph_deltas), len(moved), shift))
+            for i in moved:
+                morph_deltas.append((i, int(deltas8[i][0]), int(deltas8[i][1]), int(deltas8[i][2])))
+            morphed_vertices.append(quantized_vertices + deltas8 * (1 << shift))
+
+        output_lines.append("    static constexpr morph_delta_t MorphDeltas[] PROGMEM\n    {")
+        for vertex, x, y, z in morph_deltas:
+            output_lines.append(f"        {{{vertex}, {x}, {y}, {z}}},")
+        if not morph_deltas:
+            # No vertex moves, placeholder for a non-empty array.
+            output_lines.append("        {0, 0, 0, 0},")
+        output_lines.append("    };\n")
+        output_lines.append("    static constexpr morph_target_t MorphTargets[] PROGMEM\n    {")
+        for first, count, shift in morph_targets:
+            output_lines.append(f"        {{{first}, {count}, {shift}}},")
+        output_lines.append("    };\n")
+        output_lines.append("    constexpr auto MorphTargetCount = sizeof(MorphTargets) / sizeof(morph_target_t);\n")
+        print(f"  Morph targets: {len(morph_targets)}, {len(morph_deltas)} deltas.")
+
+    # Skin, 4 heaviest bones per vertex with weights summing to SKIN_WEIGHT_1X.
+    if skin_weights is not None and len(skin_weights) != len(quantized_vertices):
+        print(f"  Skin skipped: {len(skin_weights)} vertices, mesh has {len(quantized_vertices)}.")
+    elif skin_weights is not None:
+        skins = [quantize_skin(influences) for influences in skin_weights]
+        bone_count = max([bone + 1 for bones, weights in skins for bone, weight in zip(bones, weights) if weight > 0], default=0)
+        output_lines.append("    static constexpr skin_vertex_t Skin[] PROGMEM\n    {")
+        for bones, weights in skins:
+            output_lines.append(f"        {{{{{bones[0]}, {bones[1]}, {bones[2]}, {bones[3]}}}, "
+                                f"{{{weights[0]}, {weights[1]}, {weights[2]}, {weights[3]}}}}},")
+        output_lines.append("    };\n")
+        output_lines.append(f"    static constexpr uint8_t BoneCount = {bone_count};\n")
+        print(f"  Skin: {bone_count} bones.")
+
+    # Bounding sphere from the quantized vertices, so it contains the emitted mesh.
+    # Centered on the object origin, as used by object frustum culling.
+    if len(quantized_vertices) > 0:
+        bounding_radius = int(np.ceil(np.max(np.linalg.norm(np.vstack([quantized_vertices] + morphed_vertices), axis=1))))
+    else:
+        bounding_radius = 0
+    output_lines.append(
+        f"    static constexpr uint16_t BoundingRadius = (UpSize*(int32_t)({bounding_radius}))/DownSize;\n")
 
     # Triangulation
     triangles_with_materials: List[Tuple[Tuple[IndexTriple, IndexTriple, IndexTriple], Optional[str]]] = []
@@ -116,7 +528,7 @@ def convert_to_custom_format(
             unique_materials[material] = material_index_counter
             material_index_counter += 1
 
-    output_lines.append("    static constexpr triangle_face_t Triangles[] PROGMEM\n    {")
+    output_lines.append(f"    static constexpr {triangle_type} Triangles[] PROGMEM\n    {{")
     processed_triangles: List[Tuple[int, int, int]] = []
     processed_triples_with_materials: List[Tuple[Tuple[IndexTriple, IndexTriple, IndexTriple], Optional[str]]] = []
 
@@ -199,11 +611,61 @@ def convert_to_custom_format(
             else:
                 face_norm_vectors.append(geo_face_normal)
 
+    # Meshlets, from the quantized vertices. Reorders all per-triangle data into meshlet order.
+    meshlets: List[Dict[str, object]] = []
+    if emit_meshlets:
+        meshlet_order, meshlets = build_meshlets(
+            quantized_vertices, processed_triangles, meshlet_max_triangles, meshlet_cone_limit)
+        processed_triangles = [processed_triangles[i] for i in meshlet_order]
+        processed_triples_with_materials = [processed_triples_with_materials[i] for i in meshlet_order]
+        geometric_normals = [geometric_normals[i] for i in meshlet_order]
+        if face_norm_vectors:
+            face_norm_vectors = [face_norm_vectors[i] for i in meshlet_order]
+
     # Emit triangle indices
     for a_idx, b_idx, c_idx in processed_triangles:
         output_lines.append(f"        {{{a_idx}, {b_idx}, {c_idx}}},")
     output_lines.append("    };\n")
-    output_lines.append("    constexpr auto TriangleCount = sizeof(Triangles) / sizeof(triangle_face_t);\n")
+    output_lines.append(f"    constexpr auto TriangleCount = sizeof(Triangles) / sizeof({triangle_type});\n")
+
+    if emit_meshlets:
+        output_lines.append("    static constexpr meshlet_t Meshlets[] PROGMEM\n    {")
+        for meshlet in meshlets:
+            cx, cy, cz = meshlet["center"]
+            ax, ay, az = meshlet["cone_axis"]
+            cutoff = meshlet["cone_cutoff"]
+            output_lines.append(
+                f"        {{{{(UpSize*(int32_t)({cx}))/DownSize , (UpSize*(int32_t)({cy}))/DownSize , (UpSize*(int32_t)({cz}))/DownSize}}, "
+                f"(UpSize*(int32_t)({meshlet['radius']}))/DownSize, "
+                f"{{{format_component(ax)}, {format_component(ay)}, {format_component(az)}}}, "
+                f"{'UFRACTION16_1X' if cutoff >= MESHLET_CUTOFF_1X else cutoff}, "
+                f"{meshlet['first_triangle']}, {meshlet['triangle_count']}}},")
+        output_lines.append("    };\n")
+        output_lines.append("    constexpr auto MeshletCount = sizeof(Meshlets) / sizeof(meshlet_t);\n")
+
+    # Levels of detail, decimated from the quantized vertices.
+    lod_triangle_counts: List[int] = []
+    for level, ratio in enumerate(lod_ratios, start=1):
+        lod_vertices, lod_triangles = decimate_mesh(
+            quantized_vertices, processed_triangles, max(1, int(len(processed_triangles) * ratio)))
+        lod_triangle_counts.append(len(lod_triangles))
+        output_lines.append(f"    static constexpr {vertex_type} VerticesLod{level}[] PROGMEM\n    {{")
+        for v in lod_vertices:
+            if vertices8:
+                x, y, z = (int(np.clip(np.floor(c / float(1 << vertex8_shift) + 0.5), VERTEX8_MIN, VERTEX8_MAX)) for c in v)
+                output_lines.append(f"        {{{x}, {y}, {z}}},")
+            else:
+                output_lines.append(
+                    f"        {{(UpSize*(int32_t)({int(round(v[0]))}))/DownSize , "
+                    f"(UpSize*(int32_t)({int(round(v[1]))}))/DownSize , "
+                    f"(UpSize*(int32_t)({int(round(v[2]))}))/DownSize}},")
+        output_lines.append("    };\n")
+        output_lines.append(f"    constexpr auto VertexCountLod{level} = sizeof(VerticesLod{level}) / sizeof({vertex_type});\n")
+        output_lines.append(f"    static constexpr {triangle_type} TrianglesLod{level}[] PROGMEM\n    {{")
+        for a_idx, b_idx, c_idx in lod_triangles:
+            output_lines.append(f"        {{{a_idx}, {b_idx}, {c_idx}}},")
+        output_lines.append("    };\n")
+        output_lines.append(f"    constexpr auto TriangleCountLod{level} = sizeof(TrianglesLod{level}) / sizeof({triangle_type});\n")
 
     # Material groups
     output_lines.append("    static constexpr uint8_t Group[TriangleCount] PROGMEM\n    {")
@@ -299,7 +761,7 @@ def convert_to_custom_format(
 
         output_lines.append(f"    static constexpr uint16_t UvMasterWidth = {width};\n")
         output_lines.append(f"    static constexpr uint16_t UvMasterHeight = {height};\n")
-        output_lines.append("    static constexpr uint16_t UvCount = TriangleCount * 3;\n")
+        output_lines.append(f"    static constexpr {'uint32_t' if triangles32 else 'uint16_t'} UvCount = TriangleCount * 3;\n")
 
         u_min, u_max = min(u_values), max(u_values)
         v_min, v_max = min(v_values), max(v_values)
@@ -375,16 +837,48 @@ def convert_to_custom_format(
 
     output_lines.append("}\n")
 
+    if asset_pack is not None:
+        if vertices8:
+            asset_pack.add_chunk(CHUNK_VERTICES8, asset_pack_mesh, [tuple(v) for v in vertices8_values], vertex8_shift)
+        else:
+            asset_pack.add_chunk(CHUNK_VERTICES, asset_pack_mesh, [tuple(v) for v in quantized_vertices])
+        asset_pack.add_chunk(CHUNK_TRIANGLES8 if triangles8 else (CHUNK_TRIANGLES32 if triangles32 else CHUNK_TRIANGLES),
+                             asset_pack_mesh, processed_triangles)
+        asset_pack.add_chunk(CHUNK_GROUPS, asset_pack_mesh, material_indices)
+        if emit_vertex_normals:
+            asset_pack.add_chunk(CHUNK_VERTEX_NORMALS, asset_pack_mesh,
+                                 [quantize_normal(vertex_normal_accum[i]) for i in range(len(processed_vertices))])
+        if emit_face_normals:
+            asset_pack.add_chunk(CHUNK_FACE_NORMALS, asset_pack_mesh,
+                                 [quantize_normal(normalize_float(n)) for n in face_norm_vectors])
+        # uv_t holds 8 bit coordinates.
+        if emit_uv and has_texture_dims and width <= 256 and height <= 256:
+            asset_pack.add_chunk(CHUNK_UVS, asset_pack_mesh, master_uvs)
+
     # Emit diagnostics
     winding_label = "CCW" if assume_ccw_winding else "CW"
     print(f"Processed {file_name}: {winding_label} triangles={len(processed_triangles)}; "
           f"vertex_normals={'yes' if emit_vertex_normals else 'no'}, face_normals={'yes' if emit_face_normals else 'no'}")
+    print(f"  Bounds: radius={bounding_radius}.")
+    if triangles8:
+        print(f"  Compact storage: {triangle_type} indices, "
+              + (f"vertex8_t vertices with shift {vertex8_shift} (max error {vertex8_error:g})." if vertices8
+                 else f"vertex16_t vertices (vertex8_t max error {vertex8_error:g} over {vertex8_max_error:g})."))
+    if triangles32:
+        print(f"  {triangle_type} indices: {len(quantized_vertices)} vertices, needs an INTEGER_WORLD_INDEX32 build.")
     if emit_vertex_normals:
         print(f"  VertexNormals: oriented to {winding_label} geometric normals (corner normals re-oriented per triangle).")
     if emit_face_normals and face_norm_vectors:
         print(f"  FaceNormals: {winding_label} geometric or re-oriented averaged.")
     if emit_uv and (texture_width is not None and texture_height is not None):
         print("  UVs emitted.")
+    if lod_triangle_counts:
+        print(f"  Levels of detail: triangles={lod_triangle_counts}.")
+    if asset_pack is not None:
+        print(f"  Asset pack: mesh {asset_pack_mesh}.")
+    if emit_meshlets:
+        cone_count = sum(1 for m in meshlets if m["cone_cutoff"] < MESHLET_CUTOFF_1X)
+        print(f"  Meshlets: {len(meshlets)} of up to {meshlet_max_triangles} triangles, {cone_count} with normal cones.")
 
     if total_count > 0:
         flipped_ratio = flipped_count / total_count
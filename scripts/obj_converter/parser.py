@@ -6,6 +6,7 @@ Normal = Tuple[float, float, float]
 IndexTriple = Tuple[int, Optional[int], Optional[int]]
 Face = Tuple[IndexTriple, ...]
 FacesWithMaterials = List[Tuple[Face, Optional[str]]]
+SkinWeights = List[List[Tuple[int, float]]]
 
 
 def read_obj(data: str) -> Tuple[
@@ -67,6 +68,21 @@ def read_obj(data: str) -> Tuple[
     return vertices, texture_coords, normals, faces_with_materials
 
 
+def read_skin(data: str) -> SkinWeights:
+    """
+    Parses a bone weight sidecar for an OBJ: one line per vertex, in OBJ vertex order,
+    with "bone weight" pairs (e.g. "0 0.75 3 0.25"). Blank lines and # comments are skipped.
+    """
+    skin: SkinWeights = []
+    for raw in data.splitlines():
+        line = raw.split("#", 1)[0].strip()
+        if not line:
+            continue
+        tokens = line.split()
+        skin.append([(int(tokens[i]), float(tokens[i + 1])) for i in range(0, len(tokens) - 1, 2)])
+    return skin
+
+
 def _split_face_token(token: str) -> Tuple[str, Optional[str], Optional[str]]:
     parts = token.split("/")
     if len(parts) == 1:
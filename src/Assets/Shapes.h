@@ -25,6 +25,7 @@ namespace Assets
 				{-SHAPE_UNIT / 2,  SHAPE_UNIT / 2,  SHAPE_UNIT / 2}
 			};
 			static constexpr uint8_t VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
+			static constexpr uint16_t BoundingRadius = (((int32_t)SHAPE_UNIT / 2) * 1732051) / 1000000 + 1;
 
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
@@ -70,6 +71,7 @@ namespace Assets
 				{ 0, 0, -((SHAPE_UNIT * 3) / 4)}
 			};
 			static constexpr uint8_t VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
+			static constexpr uint16_t BoundingRadius = SHAPE_UNIT;
 
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
@@ -114,6 +116,7 @@ namespace Assets
 				{ -Z, -X,  0 }
 			};
 			static constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
+			static constexpr uint16_t BoundingRadius = ((int32_t)SHAPE_UNIT * 1000000) / 1250000 + 1;
 
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
@@ -82,7 +82,7 @@ namespace IntegerWorld
 	/// <typeparam name="MaxObjectCount">Maximum number of renderable objects.</typeparam>
 	/// <typeparam name="MaxOrderedPrimitives">Maximum number of ordered primitives/fragments.</typeparam>
 	/// <typeparam name="BatchSize">Number of items processed per callback iteration.</typeparam>
-	template<uint16_t MaxObjectCount, uint16_t MaxOrderedPrimitives, uint16_t BatchSize = 1>
+	template<uint16_t MaxObjectCount, primitive_index_t MaxOrderedPrimitives, uint16_t BatchSize = 1>
 	class EngineRenderTask : public AbstractObjectRenderTask<MaxObjectCount>
 	{
 	private:
@@ -102,6 +102,7 @@ namespace IntegerWorld
 			Disabled,			// Engine is disabled.
 			EngineStart,		// Initial state, prepares the surface.
 			CycleStart,			// Prepares for a new frame and notifies frame listeners of frame start.
+			ObjectStages,		// All per-object stages, dispatched to the stage executor.
 			ObjectShade,		// Object-level shading.
 			VertexShade,		// Vertex shading stage.
 			WorldTransform,		// World transform stage.
@@ -129,7 +130,7 @@ namespace IntegerWorld
 		StateEnum State = StateEnum::Disabled; // Current pipeline state.
 
 		uint16_t ObjectIndex = 0; // Index of the current object being processed.
-		uint16_t ItemIndex = 0;   // Index of the current item within the object.
+		primitive_index_t ItemIndex = 0;   // Index of the current item within the object.
 
 	private:
 		uint32_t MeasureStart = 0; // Used for performance timing.
@@ -150,8 +151,60 @@ namespace IntegerWorld
 	private:
 		SurfacedWindowRasterizer Rasterizer; // Handles rasterization to the output surface.
 
+		IFragmentRasterizer* FragmentRasterizer = nullptr; // Optional whole-frame rasterization backend.
+
+		IStageExecutor* StageExecutor = nullptr; // Optional executor for per-object stages.
+
+		IObjectCuller* ObjectCuller = nullptr; // Optional per-frame visibility culling.
+
+		// Objects that run this frame's stages, either all Objects or the culler's visible list.
+		IRenderObject* const* FrameObjects = Objects;
+		uint16_t FrameObjectCount = 0;
+
 		OrderedFragmentManager<MaxOrderedPrimitives> FragmentManager; // Manages fragment collection and sorting.
 
+	private:
+		/// <summary>
+		/// Runs ObjectShade through ScreenShade for a single object, to completion.
+		/// </summary>
+		struct object_stages_job_t : IStageJob
+		{
+			EngineRenderTask& Engine;
+
+			object_stages_job_t(EngineRenderTask& engine) : IStageJob(), Engine(engine) {}
+
+			void Run(const uint16_t index, const uint8_t /*workerIndex*/) final
+			{
+				IRenderObject* object = Engine.FrameObjects[index];
+
+				object->ObjectShade(Engine.CameraFrustum);
+
+				primitive_index_t item = 0;
+				while (!object->VertexShade(item))
+					item++;
+
+				item = 0;
+				while (!object->WorldTransform(item))
+					item++;
+
+				item = 0;
+				while (!object->WorldShade(Engine.CameraFrustum, item))
+					item++;
+
+				item = 0;
+				while (!object->CameraTransform(Engine.CameraTransform, item))
+					item++;
+
+				item = 0;
+				while (!object->ScreenProject(Engine.ViewProjector, item))
+					item++;
+
+				item = 0;
+				while (!object->ScreenShade(item))
+					item++;
+			}
+		} ObjectStagesJob{ *this };
+
 	public:
 		/// <summary>
 		/// Constructor. Initializes the render task with a scheduler and output surface.
@@ -215,6 +268,37 @@ namespace IntegerWorld
 			SetEnabled(false);
 		}
 
+		/// <summary>
+		/// Sets an optional backend that rasterizes all sorted fragments in a single step.
+		/// The backend must draw to the same surface as the engine. Pass nullptr to restore per-fragment rasterization.
+		/// </summary>
+		/// <param name="fragmentRasterizer">Backend to use, or nullptr.</param>
+		void SetFragmentRasterizer(IFragmentRasterizer* fragmentRasterizer)
+		{
+			FragmentRasterizer = fragmentRasterizer;
+		}
+
+		/// <summary>
+		/// Sets an optional executor that runs the per-object stages (ObjectShade to ScreenShade), one object per item.
+		/// Each object runs all its stages on a single worker; all objects are joined before FragmentCollect.
+		/// Pass nullptr to restore the default stage-by-stage batched pipeline.
+		/// </summary>
+		/// <param name="stageExecutor">Executor to use, or nullptr.</param>
+		void SetStageExecutor(IStageExecutor* stageExecutor)
+		{
+			StageExecutor = stageExecutor;
+		}
+
+		/// <summary>
+		/// Sets an optional culler that selects the visible objects once per frame, before ObjectShade.
+		/// Only visible objects run the frame's stages. Pass nullptr to run all objects.
+		/// </summary>
+		/// <param name="objectCuller">Culler to use, or nullptr.</param>
+		void SetObjectCuller(IObjectCuller* objectCuller)
+		{
+			ObjectCuller = objectCuller;
+		}
+
 		/// <summary>
 		/// Returns a pointer to the camera controls for external manipulation.
 		/// </summary>
@@ -275,13 +359,32 @@ namespace IntegerWorld
 
 					// Set the focal distance from the projector.
 					CameraTransform.FocalDistance = ViewProjector.GetFocalDistance();
-					State = StateEnum::ObjectShade;
 #if defined(INTEGER_WORLD_FRUSTUM_DEBUG)
 					if (!FrustumLock)
 						ViewProjector.GetFrustum(CameraControls, CameraFrustum);
 #else
 					ViewProjector.GetFrustum(CameraControls, CameraFrustum);
 #endif
+
+					// Select the objects that run this frame's stages.
+					if (ObjectCuller != nullptr)
+					{
+						FrameObjectCount = ObjectCuller->CullObjects(Objects, ObjectCount, CameraFrustum, FrameObjects);
+					}
+					else
+					{
+						FrameObjects = Objects;
+						FrameObjectCount = ObjectCount;
+					}
+				}
+				else
+				{
+					FrameObjectCount = 0;
+				}
+
+				if (FrameObjectCount > 0)
+				{
+					State = StageExecutor != nullptr ? StateEnum::ObjectStages : StateEnum::ObjectShade;
 				}
 				else
 				{
@@ -292,15 +395,28 @@ namespace IntegerWorld
 				Status.FramePreparation += micros() - MeasureStart;
 #else
 				Status.Render += micros() - MeasureStart;
+#endif
+				break;
+			case StateEnum::ObjectStages:
+				// Run all per-object stages on the executor and join.
+				MeasureStart = micros();
+				StageExecutor->Execute(ObjectStagesJob, FrameObjectCount);
+				ObjectIndex = 0;
+				ItemIndex = 0;
+				State = StateEnum::FragmentCollect;
+#if defined(INTEGER_WORLD_PERFORMANCE_DEBUG)
+				Status.ObjectShade += micros() - MeasureStart;
+#else
+				Status.Render += micros() - MeasureStart;
 #endif
 				break;
 			case StateEnum::ObjectShade:
 				MeasureStart = micros();
 				for (uint_fast16_t i = 0; i < BatchSize; i++)
 				{
-					Objects[ObjectIndex]->ObjectShade(CameraFrustum);
+					FrameObjects[ObjectIndex]->ObjectShade(CameraFrustum);
 					ObjectIndex++;
-					if (ObjectIndex >= ObjectCount)
+					if (ObjectIndex >= FrameObjectCount)
 					{
 						ItemIndex = 0;
 						ObjectIndex = 0;
@@ -319,11 +435,11 @@ namespace IntegerWorld
 				MeasureStart = micros();
 				for (uint_fast16_t i = 0; i < BatchSize; i++)
 				{
-					if (Objects[ObjectIndex]->VertexShade(ItemIndex))
+					if (FrameObjects[ObjectIndex]->VertexShade(ItemIndex))
 					{
 						ItemIndex = 0;
 						ObjectIndex++;
-						if (ObjectIndex >= ObjectCount)
+						if (ObjectIndex >= FrameObjectCount)
 						{
 							ItemIndex = 0;
 							ObjectIndex = 0;
@@ -347,11 +463,11 @@ namespace IntegerWorld
 				MeasureStart = micros();
 				for (uint_fast16_t i = 0; i < BatchSize; i++)
 				{
-					if (Objects[ObjectIndex]->WorldTransform(ItemIndex))
+					if (FrameObjects[ObjectIndex]->WorldTransform(ItemIndex))
 					{
 						ItemIndex = 0;
 						ObjectIndex++;
-						if (ObjectIndex >= ObjectCount)
+						if (ObjectIndex >= FrameObjectCount)
 						{
 							ItemIndex = 0;
 							ObjectIndex = 0;
@@ -375,11 +491,11 @@ namespace IntegerWorld
 				MeasureStart = micros();
 				for (uint_fast16_t i = 0; i < BatchSize; i++)
 				{
-					if (Objects[ObjectIndex]->WorldShade(CameraFrustum, ItemIndex))
+					if (FrameObjects[ObjectIndex]->WorldShade(CameraFrustum, ItemIndex))
 					{
 						ItemIndex = 0;
 						ObjectIndex++;
-						if (ObjectIndex >= ObjectCount)
+						if (ObjectIndex >= FrameObjectCount)
 						{
 							ItemIndex = 0;
 							ObjectIndex = 0;
@@ -403,11 +519,11 @@ namespace IntegerWorld
 				MeasureStart = micros();
 				for (uint_fast16_t i = 0; i < BatchSize; i++)
 				{
-					if (Objects[ObjectIndex]->CameraTransform(CameraTransform, ItemIndex))
+					if (FrameObjects[ObjectIndex]->CameraTransform(CameraTransform, ItemIndex))
 					{
 						ItemIndex = 0;
 						ObjectIndex++;
-						if (ObjectIndex >= ObjectCount)
+						if (ObjectIndex >= FrameObjectCount)
 						{
 							ItemIndex = 0;
 							ObjectIndex = 0;
@@ -431,11 +547,11 @@ namespace IntegerWorld
 				MeasureStart = micros();
 				for (uint_fast16_t i = 0; i < BatchSize; i++)
 				{
-					if (Objects[ObjectIndex]->ScreenProject(ViewProjector, ItemIndex))
+					if (FrameObjects[ObjectIndex]->ScreenProject(ViewProjector, ItemIndex))
 					{
 						ItemIndex = 0;
 						ObjectIndex++;
-						if (ObjectIndex >= ObjectCount)
+						if (ObjectIndex >= FrameObjectCount)
 						{
 							ItemIndex = 0;
 							ObjectIndex = 0;
@@ -459,11 +575,11 @@ namespace IntegerWorld
 				MeasureStart = micros();
 				for (uint_fast16_t i = 0; i < BatchSize; i++)
 				{
-					if (Objects[ObjectIndex]->ScreenShade(ItemIndex))
+					if (FrameObjects[ObjectIndex]->ScreenShade(ItemIndex))
 					{
 						ItemIndex = 0;
 						ObjectIndex++;
-						if (ObjectIndex >= ObjectCount)
+						if (ObjectIndex >= FrameObjectCount)
 						{
 							ItemIndex = 0;
 							ObjectIndex = 0;
@@ -486,9 +602,9 @@ namespace IntegerWorld
 				// Collect fragments from each object for rasterization.
 				MeasureStart = micros();
 				FragmentManager.PrepareForObject(ObjectIndex);
-				Objects[ObjectIndex]->FragmentCollect((FragmentCollector&)FragmentManager);
+				FrameObjects[ObjectIndex]->FragmentCollect((FragmentCollector&)FragmentManager);
 				ObjectIndex++;
-				if (ObjectIndex >= ObjectCount)
+				if (ObjectIndex >= FrameObjectCount)
 				{
 					State = StateEnum::FragmentSort;
 				}
@@ -535,9 +651,16 @@ namespace IntegerWorld
 			case StateEnum::Rasterize:
 				// Rasterize all sorted fragments to the output surface.
 				MeasureStart = micros();
-				if (ItemIndex < FragmentManager.Count())
+				if (FragmentRasterizer != nullptr
+					&& ItemIndex < FragmentManager.Count())
+				{
+					FragmentRasterizer->RasterizeFragments(FrameObjects, OrderedPrimitives, FragmentManager.Count());
+					ItemIndex = FragmentManager.Count();
+					Status.Rasterize += micros() - MeasureStart;
+				}
+				else if (ItemIndex < FragmentManager.Count())
 				{
-					Objects[OrderedPrimitives[ItemIndex].ObjectIndex]->FragmentShade(Rasterizer,
+					FrameObjects[OrderedPrimitives[ItemIndex].ObjectIndex]->FragmentShade(Rasterizer,
 						OrderedPrimitives[ItemIndex].FragmentIndex);
 					ItemIndex++;
 					Status.Rasterize += micros() - MeasureStart;
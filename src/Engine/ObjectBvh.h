@@ -0,0 +1,368 @@
+#ifndef _INTEGER_WORLD_OBJECT_BVH_h
+#define _INTEGER_WORLD_OBJECT_BVH_h
+
+#include "../Framework/Interface.h"
+
+namespace IntegerWorld
+{
+	/// <summary>
+	/// IObjectCuller with a bounding volume hierarchy over object bounding spheres (see IRenderObject::GetBoundingSphere).
+	/// - Rebuilt when the object count changes or every RebuildPeriod frames, refit to the moving objects on every other frame.
+	/// - Walked once per frame against the frustum: subtrees outside are skipped, subtrees fully inside are accepted without further tests.
+	/// - Visible objects keep their engine order, so the rendered frame is the same as without the culler.
+	/// Objects without bounds are always visible.
+	/// </summary>
+	/// <typeparam name="MaxObjectCount">Maximum number of objects, same as the engine's.</typeparam>
+	/// <typeparam name="LeafSize">Maximum objects per leaf node.</typeparam>
+	template<uint16_t MaxObjectCount, uint8_t LeafSize = 4>
+	class ObjectBvh : public IObjectCuller
+	{
+	private:
+		static constexpr uint16_t MaxNodeCount = (MaxObjectCount * 2) - 1;
+
+		// Median splits keep the tree balanced, at about log2(MaxObjectCount / LeafSize) levels.
+		static constexpr uint8_t MaxDepth = 32;
+
+		/// <summary>
+		/// Node bounds, as an axis aligned box.
+		/// Left child follows its parent, the right child is at Right.
+		/// Leaves have Count objects, starting at Start in Order.
+		/// </summary>
+		struct node_t
+		{
+			vertex16_t Min;
+			vertex16_t Max;
+			uint16_t Start;
+			uint16_t Count;
+			uint16_t Right;
+		};
+
+	private:
+		node_t Nodes[MaxNodeCount]{};
+
+		// Object indexes, grouped by leaf.
+		uint16_t Order[MaxObjectCount]{};
+
+		// Per-object bounds for the current frame.
+		vertex16_t Centers[MaxObjectCount]{};
+		uint16_t Radiuses[MaxObjectCount]{};
+
+		// Visible flag per object index.
+		uint8_t VisibleFlags[(MaxObjectCount + 7) / 8]{};
+
+		IRenderObject* Visible[MaxObjectCount]{};
+
+		uint16_t NodeCount = 0;
+		uint16_t BuiltObjectCount = 0;
+		uint8_t FramesSinceBuild = 0;
+
+	public:
+		/// <summary>
+		/// Frames between full rebuilds, the tree is refit in between.
+		/// Refit keeps bounds exact but the tree loses quality as objects move apart, 0 rebuilds every frame.
+		/// </summary>
+		uint8_t RebuildPeriod = 30;
+
+	public:
+		ObjectBvh() : IObjectCuller() {}
+
+		/// <summary>
+		/// Forces a rebuild on the next frame, e.g. after replacing objects without changing their count.
+		/// </summary>
+		void Invalidate()
+		{
+			BuiltObjectCount = 0;
+		}
+
+		uint16_t GetNodeCount() const
+		{
+			return NodeCount;
+		}
+
+		uint16_t CullObjects(IRenderObject* const* objects, const uint16_t objectCount, const frustum_t& frustum, IRenderObject* const*& visibleObjects) final
+		{
+			visibleObjects = Visible;
+
+			const uint16_t count = MinValue(objectCount, MaxObjectCount);
+			if (count == 0)
+				return 0;
+
+			for (uint_fast16_t i = 0; i < count; i++)
+			{
+				if (!objects[i]->GetBoundingSphere(Centers[i], Radiuses[i]))
+				{
+					// Unbounded, covers the whole range so it's never culled.
+					Centers[i] = { 0, 0, 0 };
+					Radiuses[i] = UINT16_MAX;
+				}
+			}
+
+			if (count != BuiltObjectCount
+				|| FramesSinceBuild >= RebuildPeriod)
+			{
+				Build(count);
+			}
+			else
+			{
+				Refit();
+				FramesSinceBuild++;
+			}
+
+			for (uint_fast16_t i = 0; i < sizeof(VisibleFlags); i++)
+			{
+				VisibleFlags[i] = 0;
+			}
+			Walk(frustum);
+
+			// Compact in object order.
+			uint16_t visibleCount = 0;
+			for (uint_fast16_t i = 0; i < count; i += 8)
+			{
+				const uint8_t flags = VisibleFlags[i / 8];
+				if (flags != 0)
+				{
+					for (uint_fast8_t j = 0; j < 8; j++)
+					{
+						if (flags & (1 << j))
+						{
+							Visible[visibleCount++] = objects[i + j];
+						}
+					}
+				}
+			}
+
+			return visibleCount;
+		}
+
+	private:
+		void Build(const uint16_t count)
+		{
+			for (uint_fast16_t i = 0; i < count; i++)
+			{
+				Order[i] = i;
+			}
+
+			NodeCount = 0;
+			BuildNode(0, count, 0);
+
+			BuiltObjectCount = count;
+			FramesSinceBuild = 0;
+		}
+
+		/// <summary>
+		/// Builds the subtree for Order[start, start + count), splitting at the median of the longest axis.
+		/// </summary>
+		/// <returns>Node index.</returns>
+		uint16_t BuildNode(const uint16_t start, const uint16_t count, const uint8_t depth)
+		{
+			const uint16_t nodeIndex = NodeCount++;
+			node_t& node = Nodes[nodeIndex];
+
+			GetObjectsBounds(start, count, node.Min, node.Max);
+
+			if (count <= LeafSize
+				|| depth >= MaxDepth - 1)
+			{
+				node.Start = start;
+				node.Count = count;
+				node.Right = 0;
+
+				return nodeIndex;
+			}
+
+			// Split on the axis with the largest center spread.
+			vertex16_t centerMin = Centers[Order[start]];
+			vertex16_t centerMax = centerMin;
+			for (uint_fast16_t i = start + 1; i < uint_fast16_t(start + count); i++)
+			{
+				const vertex16_t& center = Centers[Order[i]];
+				centerMin = { MinValue(centerMin.x, center.x), MinValue(centerMin.y, center.y), MinValue(centerMin.z, center.z) };
+				centerMax = { MaxValue(centerMax.x, center.x), MaxValue(centerMax.y, center.y), MaxValue(centerMax.z, center.z) };
+			}
+
+			const int32_t spreadX = int32_t(centerMax.x) - centerMin.x;
+			const int32_t spreadY = int32_t(centerMax.y) - centerMin.y;
+			const int32_t spreadZ = int32_t(centerMax.z) - centerMin.z;
+			uint8_t axis = 0;
+			if (spreadY > spreadX && spreadY >= spreadZ)
+				axis = 1;
+			else if (spreadZ > spreadX && spreadZ > spreadY)
+				axis = 2;
+
+			const uint16_t half = count / 2;
+			SelectNth(start, start + count - 1, start + half, axis);
+
+			node.Start = 0;
+			node.Count = 0;
+			BuildNode(start, half, depth + 1);
+
+			const uint16_t right = BuildNode(start + half, count - half, depth + 1);
+			Nodes[nodeIndex].Right = right;
+
+			return nodeIndex;
+		}
+
+		/// <summary>
+		/// Updates node bounds bottom-up for the current object bounds, keeping the tree layout.
+		/// Children always have higher indexes than their parent.
+		/// </summary>
+		void Refit()
+		{
+			for (int_fast32_t i = int_fast32_t(NodeCount) - 1; i >= 0; i--)
+			{
+				node_t& node = Nodes[i];
+				if (node.Count > 0)
+				{
+					GetObjectsBounds(node.Start, node.Count, node.Min, node.Max);
+				}
+				else
+				{
+					const node_t& left = Nodes[i + 1];
+					const node_t& right = Nodes[node.Right];
+					node.Min = { MinValue(left.Min.x, right.Min.x), MinValue(left.Min.y, right.Min.y), MinValue(left.Min.z, right.Min.z) };
+					node.Max = { MaxValue(left.Max.x, right.Max.x), MaxValue(left.Max.y, right.Max.y), MaxValue(left.Max.z, right.Max.z) };
+				}
+			}
+		}
+
+		void Walk(const frustum_t& frustum)
+		{
+			uint16_t stack[MaxDepth];
+			uint8_t stackSize = 0;
+			stack[stackSize++] = 0;
+
+			while (stackSize > 0)
+			{
+				const uint16_t nodeIndex = stack[--stackSize];
+				const node_t& node = Nodes[nodeIndex];
+
+				// Test the box through its bounding sphere.
+				const vertex16_t center{
+					static_cast<int16_t>((int32_t(node.Min.x) + node.Max.x) / 2),
+					static_cast<int16_t>((int32_t(node.Min.y) + node.Max.y) / 2),
+					static_cast<int16_t>((int32_t(node.Min.z) + node.Max.z) / 2) };
+				const uint32_t halfX = (uint32_t(int32_t(node.Max.x) - node.Min.x) + 1) / 2;
+				const uint32_t halfY = (uint32_t(int32_t(node.Max.y) - node.Min.y) + 1) / 2;
+				const uint32_t halfZ = (uint32_t(int32_t(node.Max.z) - node.Min.z) + 1) / 2;
+				const uint16_t radius = static_cast<uint16_t>(MinValue<uint32_t>(UINT16_MAX,
+					uint32_t(IntegerSignal::SquareRoot32((halfX * halfX) + (halfY * halfY) + (halfZ * halfZ))) + 1));
+
+				if (!frustum.IsSphereInside(center, radius))
+					continue;
+
+				if (frustum.IsSphereFullyInside(center, radius))
+				{
+					MarkSubtree(nodeIndex);
+				}
+				else if (node.Count > 0)
+				{
+					for (uint_fast16_t i = node.Start; i < uint_fast16_t(node.Start + node.Count); i++)
+					{
+						const uint16_t objectIndex = Order[i];
+						if (frustum.IsSphereInside(Centers[objectIndex], Radiuses[objectIndex]))
+						{
+							VisibleFlags[objectIndex / 8] |= 1 << (objectIndex % 8);
+						}
+					}
+				}
+				else
+				{
+					stack[stackSize++] = node.Right;
+					stack[stackSize++] = nodeIndex + 1;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Marks all objects in a subtree as visible.
+		/// Subtrees are contiguous in Order, from the leftmost to the rightmost leaf.
+		/// </summary>
+		void MarkSubtree(const uint16_t nodeIndex)
+		{
+			uint16_t first = nodeIndex;
+			while (Nodes[first].Count == 0)
+				first = first + 1;
+
+			uint16_t last = nodeIndex;
+			while (Nodes[last].Count == 0)
+				last = Nodes[last].Right;
+
+			for (uint_fast16_t i = Nodes[first].Start; i < uint_fast16_t(Nodes[last].Start + Nodes[last].Count); i++)
+			{
+				const uint16_t objectIndex = Order[i];
+				VisibleFlags[objectIndex / 8] |= 1 << (objectIndex % 8);
+			}
+		}
+
+		void GetObjectsBounds(const uint16_t start, const uint16_t count, vertex16_t& boundsMin, vertex16_t& boundsMax) const
+		{
+			int32_t minX = INT32_MAX, minY = INT32_MAX, minZ = INT32_MAX;
+			int32_t maxX = INT32_MIN, maxY = INT32_MIN, maxZ = INT32_MIN;
+			for (uint_fast16_t i = start; i < uint_fast16_t(start + count); i++)
+			{
+				const uint16_t objectIndex = Order[i];
+				const vertex16_t& center = Centers[objectIndex];
+				const int32_t radius = Radiuses[objectIndex];
+
+				minX = MinValue(minX, center.x - radius);
+				minY = MinValue(minY, center.y - radius);
+				minZ = MinValue(minZ, center.z - radius);
+				maxX = MaxValue(maxX, center.x + radius);
+				maxY = MaxValue(maxY, center.y + radius);
+				maxZ = MaxValue(maxZ, center.z + radius);
+			}
+
+			boundsMin = { LimitVertex(minX), LimitVertex(minY), LimitVertex(minZ) };
+			boundsMax = { LimitVertex(maxX), LimitVertex(maxY), LimitVertex(maxZ) };
+		}
+
+		/// <summary>
+		/// Partially sorts Order[left, right] so that Order[nth] has the nth center on the axis,
+		/// with lower centers before it and higher after (quickselect).
+		/// </summary>
+		void SelectNth(uint16_t left, uint16_t right, const uint16_t nth, const uint8_t axis)
+		{
+			while (left < right)
+			{
+				const int16_t pivot = GetAxis(Centers[Order[(uint32_t(left) + right) / 2]], axis);
+
+				int32_t i = left;
+				int32_t j = right;
+				while (i <= j)
+				{
+					while (GetAxis(Centers[Order[i]], axis) < pivot)
+						i++;
+					while (GetAxis(Centers[Order[j]], axis) > pivot)
+						j--;
+
+					if (i <= j)
+					{
+						const uint16_t swap = Order[i];
+						Order[i] = Order[j];
+						Order[j] = swap;
+						i++;
+						j--;
+					}
+				}
+
+				if (int32_t(nth) <= j)
+					right = static_cast<uint16_t>(j);
+				else if (int32_t(nth) >= i)
+					left = static_cast<uint16_t>(i);
+				else
+					break;
+			}
+		}
+
+		static int16_t GetAxis(const vertex16_t& vertex, const uint8_t axis)
+		{
+			return axis == 0 ? vertex.x : (axis == 1 ? vertex.y : vertex.z);
+		}
+
+		static int16_t LimitVertex(const int32_t value)
+		{
+			return static_cast<int16_t>(LimitValue<int32_t>(value, INT16_MIN, INT16_MAX));
+		}
+	};
+}
+#endif
@@ -0,0 +1,30 @@
+#ifndef _INTEGER_WORLD_STAGE_EXECUTOR_h
+#define _INTEGER_WORLD_STAGE_EXECUTOR_h
+
+#include "../Framework/Interface.h"
+
+namespace IntegerWorld
+{
+	/// <summary>
+	/// Default IStageExecutor: runs all items in order on the calling thread.
+	/// </summary>
+	class SerialStageExecutor final : public IStageExecutor
+	{
+	public:
+		SerialStageExecutor() : IStageExecutor() {}
+
+		void Execute(IStageJob& job, const uint16_t count) final
+		{
+			for (uint_fast16_t i = 0; i < count; i++)
+			{
+				job.Run(i, 0);
+			}
+		}
+
+		uint8_t GetWorkerCount() const final
+		{
+			return 1;
+		}
+	};
+}
+#endif
@@ -0,0 +1,149 @@
+#ifndef _INTEGER_WORLD_THREAD_STAGE_EXECUTOR_h
+#define _INTEGER_WORLD_THREAD_STAGE_EXECUTOR_h
+
+#include "../Framework/Interface.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace IntegerWorld
+{
+	/// <summary>
+	/// Host-only IStageExecutor backed by a persistent std::thread pool.
+	/// - Items are claimed from a shared atomic counter, so idle workers pick up remaining items from busy ones.
+	/// - The calling thread takes part as worker 0.
+	/// - Execute() blocks until all items are done; it is not reentrant.
+	/// </summary>
+	class ThreadStageExecutor : public IStageExecutor
+	{
+	private:
+		std::vector<std::thread> Threads{};
+
+		std::mutex Mutex{};
+		std::condition_variable StartCondition{};
+		std::condition_variable DoneCondition{};
+
+		std::atomic<uint32_t> NextItem{ 0 };
+
+		// Current job, published under Mutex.
+		IStageJob* Job = nullptr;
+		uint16_t JobCount = 0;
+		uint32_t JobGeneration = 0;
+		uint8_t WorkersPending = 0;
+		bool Exit = false;
+
+		const uint8_t WorkerCount;
+
+	public:
+		/// <summary>
+		/// Starts the worker threads.
+		/// </summary>
+		/// <param name="workerCount">Total worker count, including the calling thread. 0 uses the hardware concurrency.</param>
+		ThreadStageExecutor(const uint8_t workerCount = 0)
+			: IStageExecutor()
+			, WorkerCount(GetWorkerCount(workerCount))
+		{
+			for (uint_fast8_t i = 1; i < WorkerCount; i++)
+			{
+				Threads.emplace_back(&ThreadStageExecutor::WorkerLoop, this, uint8_t(i));
+			}
+		}
+
+		~ThreadStageExecutor()
+		{
+			{
+				std::lock_guard<std::mutex> lock(Mutex);
+				Exit = true;
+			}
+			StartCondition.notify_all();
+
+			for (auto& thread : Threads)
+			{
+				thread.join();
+			}
+		}
+
+		uint8_t GetWorkerCount() const final
+		{
+			return WorkerCount;
+		}
+
+		void Execute(IStageJob& job, const uint16_t count) final
+		{
+			if (Threads.empty() || count <= 1)
+			{
+				for (uint_fast16_t i = 0; i < count; i++)
+				{
+					job.Run(i, 0);
+				}
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(Mutex);
+				Job = &job;
+				JobCount = count;
+				WorkersPending = static_cast<uint8_t>(Threads.size());
+				NextItem.store(0);
+				JobGeneration++;
+			}
+			StartCondition.notify_all();
+
+			RunItems(job, count, 0);
+
+			std::unique_lock<std::mutex> lock(Mutex);
+			DoneCondition.wait(lock, [this] { return WorkersPending == 0; });
+		}
+
+	private:
+		void WorkerLoop(const uint8_t workerIndex)
+		{
+			uint32_t generation = 0;
+			while (true)
+			{
+				IStageJob* job;
+				uint16_t count;
+				{
+					std::unique_lock<std::mutex> lock(Mutex);
+					StartCondition.wait(lock, [this, generation] { return Exit || JobGeneration != generation; });
+					if (Exit)
+						return;
+
+					generation = JobGeneration;
+					job = Job;
+					count = JobCount;
+				}
+
+				RunItems(*job, count, workerIndex);
+
+				{
+					std::lock_guard<std::mutex> lock(Mutex);
+					WorkersPending--;
+				}
+				DoneCondition.notify_one();
+			}
+		}
+
+		void RunItems(IStageJob& job, const uint16_t count, const uint8_t workerIndex)
+		{
+			for (uint32_t item = NextItem.fetch_add(1); item < count; item = NextItem.fetch_add(1))
+			{
+				job.Run(static_cast<uint16_t>(item), workerIndex);
+			}
+		}
+
+		static uint8_t GetWorkerCount(const uint8_t workerCount)
+		{
+			if (workerCount > 0)
+				return workerCount;
+
+			const unsigned int hardwareCount = std::thread::hardware_concurrency();
+
+			return static_cast<uint8_t>(LimitValue<unsigned int>(hardwareCount, 1, UINT8_MAX));
+		}
+	};
+}
+#endif
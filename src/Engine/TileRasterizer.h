@@ -0,0 +1,171 @@
+#ifndef _INTEGER_WORLD_TILE_RASTERIZER_h
+#define _INTEGER_WORLD_TILE_RASTERIZER_h
+
+#include "../Framework/Interface.h"
+#include "../OutputSurfaces/FrameBufferSurface.h"
+#include "ThreadStageExecutor.h"
+
+#include <memory>
+#include <vector>
+
+namespace IntegerWorld
+{
+	/// <summary>
+	/// Host-only parallel rasterization backend for EngineRenderTask.
+	/// - Splits the frame buffer into tiles and rasterizes them on a pool of threads.
+	/// - Runs on its own ThreadStageExecutor, or on a shared IStageExecutor (e.g. the one set on EngineRenderTask).
+	/// - Every tile replays the full z-ordered fragment list, scissored to the tile.
+	///   Tiles are disjoint and each pixel sees the same draw order, so output is bit-identical to the serial path.
+	/// Requires render objects and fragment shaders with reentrant FragmentShade (see IRenderObject).
+	/// </summary>
+	class TileRasterizer : public IFragmentRasterizer, private IStageJob
+	{
+	private:
+		/// <summary>
+		/// Per-worker view of the shared frame buffer.
+		/// </summary>
+		struct tile_worker_t
+		{
+			FrameBufferOutput::BufferSurface Surface;
+			SurfacedWindowRasterizer Rasterizer;
+
+			tile_worker_t(Rgb8::color_t* buffer, const int16_t width, const int16_t height)
+				: Surface(buffer, width, height)
+				, Rasterizer(Surface)
+			{
+				Rasterizer.UpdateDimensions();
+			}
+		};
+
+	private:
+		// Set when the rasterizer runs on its own thread pool.
+		std::unique_ptr<IStageExecutor> OwnedExecutor;
+		IStageExecutor& Executor;
+
+		std::vector<std::unique_ptr<tile_worker_t>> Workers{};
+
+		// Current frame, valid during RasterizeFragments.
+		IRenderObject* const* FrameObjects = nullptr;
+		const ordered_fragment_t* FrameFragments = nullptr;
+		primitive_index_t FrameFragmentCount = 0;
+
+		const int16_t FrameWidth;
+		const int16_t FrameHeight;
+		const int16_t TileWidth;
+		const int16_t TileHeight;
+		const uint16_t TileColumns;
+		const uint16_t TileCount;
+
+	public:
+		/// <summary>
+		/// Creates the tile layout and starts the worker threads.
+		/// </summary>
+		/// <param name="surface">Frame buffer surface the engine renders to.</param>
+		/// <param name="threadCount">Total worker count, including the calling thread. 0 uses the hardware concurrency.</param>
+		/// <param name="tileWidth">Tile width in pixels. 0 uses full-width tiles.</param>
+		/// <param name="tileHeight">Tile height in pixels. 0 picks a height that gives a few tiles per worker.</param>
+		TileRasterizer(FrameBufferOutput::BufferSurface& surface,
+			const uint8_t threadCount = 0,
+			const int16_t tileWidth = 0,
+			const int16_t tileHeight = 0)
+			: TileRasterizer(surface, owned_executor_tag_t{}, new ThreadStageExecutor(threadCount), tileWidth, tileHeight)
+		{
+		}
+
+		/// <summary>
+		/// Creates the tile layout on a shared executor, one scissored rasterizer per executor worker.
+		/// </summary>
+		/// <param name="surface">Frame buffer surface the engine renders to.</param>
+		/// <param name="executor">Executor to run tiles on, must outlive the rasterizer.</param>
+		/// <param name="tileWidth">Tile width in pixels. 0 uses full-width tiles.</param>
+		/// <param name="tileHeight">Tile height in pixels. 0 picks a height that gives a few tiles per worker.</param>
+		TileRasterizer(FrameBufferOutput::BufferSurface& surface,
+			IStageExecutor& executor,
+			const int16_t tileWidth = 0,
+			const int16_t tileHeight = 0)
+			: TileRasterizer(surface, executor, nullptr, tileWidth, tileHeight)
+		{
+		}
+
+		uint8_t GetWorkerCount() const
+		{
+			return static_cast<uint8_t>(Workers.size());
+		}
+
+		uint16_t GetTileCount() const
+		{
+			return TileCount;
+		}
+
+		void RasterizeFragments(IRenderObject* const* objects, const ordered_fragment_t* fragments, const primitive_index_t fragmentCount) final
+		{
+			FrameObjects = objects;
+			FrameFragments = fragments;
+			FrameFragmentCount = fragmentCount;
+
+			Executor.Execute(*this, TileCount);
+		}
+
+	private:
+		// Selects the owned executor constructor, so a literal 0 thread count can't convert to a null executor pointer.
+		struct owned_executor_tag_t {};
+
+		TileRasterizer(FrameBufferOutput::BufferSurface& surface,
+			owned_executor_tag_t,
+			IStageExecutor* ownedExecutor,
+			const int16_t tileWidth,
+			const int16_t tileHeight)
+			: TileRasterizer(surface, *ownedExecutor, ownedExecutor, tileWidth, tileHeight)
+		{
+		}
+
+		TileRasterizer(FrameBufferOutput::BufferSurface& surface,
+			IStageExecutor& executor,
+			IStageExecutor* ownedExecutor,
+			const int16_t tileWidth,
+			const int16_t tileHeight)
+			: IFragmentRasterizer()
+			, IStageJob()
+			, OwnedExecutor(ownedExecutor)
+			, Executor(executor)
+			, FrameWidth(surface.GetWidth())
+			, FrameHeight(surface.GetHeight())
+			, TileWidth(tileWidth > 0 ? MinValue<int16_t>(tileWidth, surface.GetWidth()) : surface.GetWidth())
+			, TileHeight(tileHeight > 0 ? MinValue<int16_t>(tileHeight, surface.GetHeight()) : GetDefaultTileHeight(surface.GetHeight(), executor.GetWorkerCount()))
+			, TileColumns((FrameWidth + TileWidth - 1) / TileWidth)
+			, TileCount(TileColumns * ((FrameHeight + TileHeight - 1) / TileHeight))
+		{
+			for (uint_fast8_t i = 0; i < executor.GetWorkerCount(); i++)
+			{
+				Workers.emplace_back(new tile_worker_t(surface.GetBuffer(), FrameWidth, FrameHeight));
+			}
+		}
+
+		void Run(const uint16_t tile, const uint8_t workerIndex) final
+		{
+			tile_worker_t& worker = *Workers[workerIndex];
+
+			const int16_t x = (tile % TileColumns) * TileWidth;
+			const int16_t y = (tile / TileColumns) * TileHeight;
+
+			worker.Surface.SetScissor(x, y, TileWidth, TileHeight);
+			worker.Rasterizer.SetScissor(x, y, TileWidth, TileHeight);
+
+			for (primitive_index_t i = 0; i < FrameFragmentCount; i++)
+			{
+				FrameObjects[FrameFragments[i].ObjectIndex]->FragmentShade(worker.Rasterizer, FrameFragments[i].FragmentIndex);
+			}
+		}
+
+		static int16_t GetDefaultTileHeight(const int16_t height, const uint8_t workerCount)
+		{
+			// A few tiles per worker to balance uneven scenes, without replaying the fragment list too often.
+			static constexpr uint8_t TilesPerWorker = 4;
+
+			const int32_t tileCount = int32_t(MaxValue<uint8_t>(1, workerCount)) * TilesPerWorker;
+
+			return static_cast<int16_t>(MaxValue<int32_t>(1, (height + tileCount - 1) / tileCount));
+		}
+	};
+}
+#endif
@@ -218,6 +218,16 @@ public:
 		ObjectFloor.Translation.y = (-DistanceUnit * 3) / 5;
 		ObjectFloor.Translation.z = BaseDistance;
 
+		// Set object bounds for frustum culling.
+		ObjectSphere.BoundingRadius = Assets::Shapes::Sphere::BoundingRadius;
+		ObjectStar.BoundingRadius = Assets::Shapes::Star::BoundingRadius;
+		ObjectCube.BoundingRadius = Assets::Shapes::Cube::BoundingRadius;
+
+		// Static meshes, unlit modes use the fused vertex path.
+		ObjectSphere.FusedVertices = true;
+		ObjectStar.FusedVertices = true;
+		ObjectCube.FusedVertices = true;
+
 		// Configure object dynamic materials.
 		ObjectSphere.SetMaterial(material_t{ 0, UFRACTION8_1X, 0, UFRACTION8_1X / 3, 0, FRACTION8_NEGATIVE_1X / 2 });
 		ObjectStar.SetMaterial(material_t{ 0, UFRACTION8_1X / 16, UFRACTION8_1X, UFRACTION8_1X, UFRACTION8_1X, FRACTION8_1X / 8 });
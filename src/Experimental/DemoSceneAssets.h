@@ -41,6 +41,7 @@ namespace Assets
 				{ (int16_t)((int32_t)-85 * scaleFactor), (int16_t)((int32_t)-62 * scaleFactor), (int16_t)((int32_t)26 * scaleFactor) }
 			};
 			constexpr uint16_t VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
+			constexpr uint16_t BoundingRadius = 109 * scaleFactor;
 
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
@@ -257,6 +258,7 @@ namespace Assets
 			};
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
+			constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(1281)) / DownSize;
 
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
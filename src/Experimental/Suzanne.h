@@ -2925,836 +2925,880 @@ namespace Assets
 
 			constexpr auto VertexCount = sizeof(Vertices) / sizeof(vertex16_t);
 
+			static constexpr uint16_t BoundingRadius = (UpSize * (int32_t)(206)) / DownSize;
+
 			static constexpr triangle_face_t Triangles[] PROGMEM
 			{
 				{ 0, 1, 2 },
 				{ 3, 4, 5 },
-				{ 6, 7, 8 },
-				{ 9, 10, 11 },
 				{ 12, 13, 14 },
 				{ 15, 16, 17 },
+				{ 180, 181, 182 },
+				{ 183, 184, 185 },
+				{ 168, 169, 170 },
+				{ 171, 172, 173 },
+				{ 39, 40, 41 },
+				{ 36, 37, 38 },
+				{ 147, 148, 149 },
+				{ 144, 145, 146 },
+				{ 6, 7, 8 },
+				{ 9, 10, 11 },
 				{ 18, 19, 20 },
 				{ 21, 22, 23 },
+				{ 186, 187, 188 },
+				{ 189, 190, 191 },
+				{ 174, 175, 176 },
+				{ 177, 178, 179 },
+				{ 45, 46, 47 },
+				{ 42, 43, 44 },
+				{ 153, 154, 155 },
+				{ 150, 151, 152 },
 				{ 24, 25, 26 },
 				{ 27, 28, 29 },
+				{ 63, 64, 65 },
+				{ 60, 61, 62 },
+				{ 1158, 1159, 1160 },
+				{ 615, 616, 617 },
+				{ 51, 52, 53 },
+				{ 1161, 1162, 1163 },
+				{ 48, 49, 50 },
+				{ 1173, 1174, 1175 },
+				{ 1170, 1171, 1172 },
+				{ 396, 397, 398 },
+				{ 600, 601, 602 },
+				{ 411, 412, 413 },
+				{ 399, 400, 401 },
+				{ 408, 409, 410 },
+				{ 603, 604, 605 },
+				{ 1185, 1186, 1187 },
+				{ 1182, 1183, 1184 },
+				{ 591, 592, 593 },
+				{ 588, 589, 590 },
+				{ 423, 424, 425 },
+				{ 1197, 1198, 1199 },
+				{ 576, 577, 578 },
+				{ 1194, 1195, 1196 },
+				{ 420, 421, 422 },
+				{ 564, 565, 566 },
+				{ 1317, 1318, 1319 },
+				{ 1305, 1306, 1307 },
+				{ 1314, 1315, 1316 },
+				{ 1209, 1210, 1211 },
+				{ 579, 580, 581 },
+				{ 1329, 1330, 1331 },
+				{ 552, 553, 554 },
+				{ 555, 556, 557 },
+				{ 1206, 1207, 1208 },
+				{ 447, 448, 449 },
+				{ 432, 433, 434 },
+				{ 435, 436, 437 },
+				{ 1221, 1222, 1223 },
+				{ 567, 568, 569 },
+				{ 1290, 1291, 1292 },
+				{ 1281, 1282, 1283 },
+				{ 1278, 1279, 1280 },
+				{ 1266, 1267, 1268 },
+				{ 1269, 1270, 1271 },
+				{ 1389, 1390, 1391 },
+				{ 543, 544, 545 },
+				{ 528, 529, 530 },
+				{ 1302, 1303, 1304 },
+				{ 540, 541, 542 },
+				{ 1293, 1294, 1295 },
+				{ 516, 517, 518 },
+				{ 531, 532, 533 },
+				{ 639, 640, 641 },
+				{ 1386, 1387, 1388 },
+				{ 624, 625, 626 },
+				{ 648, 649, 650 },
+				{ 651, 652, 653 },
+				{ 660, 661, 662 },
+				{ 84, 85, 86 },
+				{ 1137, 1138, 1139 },
+				{ 663, 664, 665 },
+				{ 87, 88, 89 },
 				{ 30, 31, 32 },
 				{ 33, 34, 35 },
-				{ 36, 37, 38 },
-				{ 39, 40, 41 },
-				{ 42, 43, 44 },
-				{ 45, 46, 47 },
-				{ 48, 49, 50 },
-				{ 51, 52, 53 },
-				{ 54, 55, 56 },
-				{ 57, 58, 59 },
-				{ 60, 61, 62 },
-				{ 63, 64, 65 },
-				{ 66, 67, 68 },
 				{ 69, 70, 71 },
+				{ 66, 67, 68 },
+				{ 1164, 1165, 1166 },
+				{ 621, 622, 623 },
+				{ 57, 58, 59 },
+				{ 1167, 1168, 1169 },
+				{ 54, 55, 56 },
+				{ 1179, 1180, 1181 },
+				{ 1176, 1177, 1178 },
+				{ 402, 403, 404 },
+				{ 606, 607, 608 },
+				{ 417, 418, 419 },
+				{ 405, 406, 407 },
+				{ 414, 415, 416 },
+				{ 609, 610, 611 },
+				{ 1191, 1192, 1193 },
+				{ 1188, 1189, 1190 },
+				{ 597, 598, 599 },
+				{ 594, 595, 596 },
+				{ 429, 430, 431 },
+				{ 1203, 1204, 1205 },
+				{ 582, 583, 584 },
+				{ 1200, 1201, 1202 },
+				{ 426, 427, 428 },
+				{ 570, 571, 572 },
+				{ 1323, 1324, 1325 },
+				{ 1311, 1312, 1313 },
+				{ 1320, 1321, 1322 },
+				{ 1215, 1216, 1217 },
+				{ 585, 586, 587 },
+				{ 1335, 1336, 1337 },
+				{ 558, 559, 560 },
+				{ 561, 562, 563 },
+				{ 1212, 1213, 1214 },
+				{ 453, 454, 455 },
+				{ 438, 439, 440 },
+				{ 441, 442, 443 },
+				{ 1227, 1228, 1229 },
+				{ 573, 574, 575 },
+				{ 1296, 1297, 1298 },
+				{ 1287, 1288, 1289 },
+				{ 1284, 1285, 1286 },
+				{ 1272, 1273, 1274 },
+				{ 1275, 1276, 1277 },
+				{ 1395, 1396, 1397 },
+				{ 549, 550, 551 },
+				{ 534, 535, 536 },
+				{ 1308, 1309, 1310 },
+				{ 546, 547, 548 },
+				{ 1299, 1300, 1301 },
+				{ 522, 523, 524 },
+				{ 537, 538, 539 },
+				{ 645, 646, 647 },
+				{ 1392, 1393, 1394 },
+				{ 630, 631, 632 },
+				{ 654, 655, 656 },
+				{ 657, 658, 659 },
+				{ 666, 667, 668 },
+				{ 90, 91, 92 },
+				{ 1143, 1144, 1145 },
+				{ 669, 670, 671 },
+				{ 93, 94, 95 },
 				{ 72, 73, 74 },
 				{ 75, 76, 77 },
+				{ 1146, 1147, 1148 },
+				{ 1110, 1111, 1112 },
+				{ 1149, 1150, 1151 },
+				{ 1113, 1114, 1115 },
+				{ 1122, 1123, 1124 },
+				{ 1125, 1126, 1127 },
+				{ 99, 100, 101 },
+				{ 96, 97, 98 },
+				{ 1134, 1135, 1136 },
+				{ 111, 112, 113 },
+				{ 108, 109, 110 },
+				{ 1254, 1255, 1256 },
+				{ 1257, 1258, 1259 },
+				{ 135, 136, 137 },
+				{ 132, 133, 134 },
+				{ 627, 628, 629 },
+				{ 915, 916, 917 },
+				{ 1242, 1243, 1244 },
+				{ 1245, 1246, 1247 },
+				{ 807, 808, 809 },
+				{ 633, 634, 635 },
+				{ 618, 619, 620 },
+				{ 843, 844, 845 },
+				{ 891, 892, 893 },
+				{ 897, 898, 899 },
+				{ 888, 889, 890 },
+				{ 894, 895, 896 },
+				{ 870, 871, 872 },
+				{ 906, 907, 908 },
+				{ 873, 874, 875 },
+				{ 861, 862, 863 },
+				{ 858, 859, 860 },
+				{ 900, 901, 902 },
+				{ 885, 886, 887 },
+				{ 837, 838, 839 },
+				{ 834, 835, 836 },
+				{ 903, 904, 905 },
+				{ 1230, 1231, 1232 },
 				{ 78, 79, 80 },
 				{ 81, 82, 83 },
-				{ 84, 85, 86 },
-				{ 87, 88, 89 },
-				{ 90, 91, 92 },
-				{ 93, 94, 95 },
-				{ 96, 97, 98 },
-				{ 99, 100, 101 },
-				{ 102, 103, 104 },
+				{ 1152, 1153, 1154 },
+				{ 1116, 1117, 1118 },
+				{ 1155, 1156, 1157 },
+				{ 1119, 1120, 1121 },
+				{ 1128, 1129, 1130 },
+				{ 1131, 1132, 1133 },
 				{ 105, 106, 107 },
-				{ 108, 109, 110 },
-				{ 111, 112, 113 },
-				{ 114, 115, 116 },
+				{ 102, 103, 104 },
+				{ 1140, 1141, 1142 },
 				{ 117, 118, 119 },
+				{ 114, 115, 116 },
+				{ 1260, 1261, 1262 },
+				{ 1263, 1264, 1265 },
+				{ 141, 142, 143 },
+				{ 138, 139, 140 },
+				{ 1248, 1249, 1250 },
+				{ 1251, 1252, 1253 },
 				{ 120, 121, 122 },
 				{ 123, 124, 125 },
+				{ 159, 160, 161 },
+				{ 156, 157, 158 },
+				{ 1233, 1234, 1235 },
+				{ 1218, 1219, 1220 },
 				{ 126, 127, 128 },
 				{ 129, 130, 131 },
-				{ 132, 133, 134 },
-				{ 135, 136, 137 },
-				{ 138, 139, 140 },
-				{ 141, 142, 143 },
-				{ 144, 145, 146 },
-				{ 147, 148, 149 },
-				{ 150, 151, 152 },
-				{ 153, 154, 155 },
-				{ 156, 157, 158 },
-				{ 159, 160, 161 },
-				{ 162, 163, 164 },
 				{ 165, 166, 167 },
-				{ 168, 169, 170 },
-				{ 171, 172, 173 },
-				{ 174, 175, 176 },
-				{ 177, 178, 179 },
-				{ 180, 181, 182 },
-				{ 183, 184, 185 },
-				{ 186, 187, 188 },
-				{ 189, 190, 191 },
+				{ 162, 163, 164 },
+				{ 1236, 1237, 1238 },
+				{ 1239, 1240, 1241 },
+				{ 1224, 1225, 1226 },
 				{ 192, 193, 194 },
 				{ 195, 196, 197 },
+				{ 276, 277, 278 },
+				{ 279, 280, 281 },
 				{ 198, 199, 200 },
 				{ 201, 202, 203 },
+				{ 282, 283, 284 },
+				{ 285, 286, 287 },
 				{ 204, 205, 206 },
 				{ 207, 208, 209 },
+				{ 219, 220, 221 },
+				{ 216, 217, 218 },
 				{ 210, 211, 212 },
 				{ 213, 214, 215 },
-				{ 216, 217, 218 },
-				{ 219, 220, 221 },
-				{ 222, 223, 224 },
 				{ 225, 226, 227 },
+				{ 222, 223, 224 },
 				{ 228, 229, 230 },
 				{ 231, 232, 233 },
-				{ 234, 235, 236 },
-				{ 237, 238, 239 },
-				{ 240, 241, 242 },
 				{ 243, 244, 245 },
-				{ 246, 247, 248 },
+				{ 240, 241, 242 },
+				{ 234, 235, 236 },
+				{ 237, 238, 239 },
 				{ 249, 250, 251 },
+				{ 246, 247, 248 },
 				{ 252, 253, 254 },
 				{ 255, 256, 257 },
+				{ 267, 268, 269 },
+				{ 264, 265, 266 },
 				{ 258, 259, 260 },
 				{ 261, 262, 263 },
-				{ 264, 265, 266 },
-				{ 267, 268, 269 },
-				{ 270, 271, 272 },
 				{ 273, 274, 275 },
-				{ 276, 277, 278 },
-				{ 279, 280, 281 },
-				{ 282, 283, 284 },
-				{ 285, 286, 287 },
+				{ 270, 271, 272 },
 				{ 288, 289, 290 },
-				{ 291, 292, 293 },
+				{ 330, 331, 332 },
 				{ 294, 295, 296 },
-				{ 297, 298, 299 },
+				{ 324, 325, 326 },
+				{ 318, 319, 320 },
 				{ 300, 301, 302 },
-				{ 303, 304, 305 },
-				{ 306, 307, 308 },
-				{ 309, 310, 311 },
 				{ 312, 313, 314 },
-				{ 315, 316, 317 },
-				{ 318, 319, 320 },
-				{ 321, 322, 323 },
-				{ 324, 325, 326 },
-				{ 327, 328, 329 },
-				{ 330, 331, 332 },
+				{ 306, 307, 308 },
+				{ 1365, 1366, 1367 },
+				{ 1362, 1363, 1364 },
+				{ 1353, 1354, 1355 },
+				{ 1374, 1375, 1376 },
+				{ 1377, 1378, 1379 },
+				{ 1413, 1414, 1415 },
+				{ 1410, 1411, 1412 },
+				{ 1398, 1399, 1400 },
+				{ 1401, 1402, 1403 },
+				{ 1350, 1351, 1352 },
+				{ 1338, 1339, 1340 },
+				{ 1341, 1342, 1343 },
+				{ 291, 292, 293 },
 				{ 333, 334, 335 },
+				{ 297, 298, 299 },
+				{ 327, 328, 329 },
+				{ 321, 322, 323 },
+				{ 303, 304, 305 },
+				{ 315, 316, 317 },
+				{ 309, 310, 311 },
+				{ 1371, 1372, 1373 },
+				{ 1368, 1369, 1370 },
+				{ 1359, 1360, 1361 },
+				{ 1380, 1381, 1382 },
+				{ 1383, 1384, 1385 },
+				{ 1419, 1420, 1421 },
+				{ 1416, 1417, 1418 },
+				{ 1404, 1405, 1406 },
+				{ 1407, 1408, 1409 },
+				{ 1356, 1357, 1358 },
+				{ 1344, 1345, 1346 },
+				{ 1347, 1348, 1349 },
 				{ 336, 337, 338 },
 				{ 339, 340, 341 },
-				{ 342, 343, 344 },
+				{ 675, 676, 677 },
+				{ 672, 673, 674 },
+				{ 678, 679, 680 },
+				{ 684, 685, 686 },
+				{ 687, 688, 689 },
+				{ 681, 682, 683 },
 				{ 345, 346, 347 },
+				{ 342, 343, 344 },
+				{ 690, 691, 692 },
+				{ 693, 694, 695 },
+				{ 1020, 1021, 1022 },
+				{ 1035, 1036, 1037 },
+				{ 1041, 1042, 1043 },
+				{ 1026, 1027, 1028 },
+				{ 1011, 1012, 1013 },
+				{ 999, 1000, 1001 },
+				{ 1005, 1006, 1007 },
+				{ 1017, 1018, 1019 },
+				{ 1008, 1009, 1010 },
+				{ 1014, 1015, 1016 },
+				{ 1023, 1024, 1025 },
+				{ 699, 700, 701 },
+				{ 1029, 1030, 1031 },
+				{ 705, 706, 707 },
+				{ 756, 757, 758 },
+				{ 759, 760, 761 },
+				{ 765, 766, 767 },
+				{ 762, 763, 764 },
+				{ 1032, 1033, 1034 },
+				{ 1038, 1039, 1040 },
+				{ 696, 697, 698 },
+				{ 702, 703, 704 },
+				{ 723, 724, 725 },
+				{ 747, 748, 749 },
+				{ 753, 754, 755 },
+				{ 720, 721, 722 },
+				{ 729, 730, 731 },
+				{ 726, 727, 728 },
+				{ 744, 745, 746 },
+				{ 750, 751, 752 },
+				{ 711, 712, 713 },
+				{ 717, 718, 719 },
+				{ 708, 709, 710 },
+				{ 714, 715, 716 },
+				{ 735, 736, 737 },
+				{ 741, 742, 743 },
+				{ 948, 949, 950 },
+				{ 732, 733, 734 },
+				{ 738, 739, 740 },
+				{ 954, 955, 956 },
+				{ 951, 952, 953 },
+				{ 957, 958, 959 },
+				{ 936, 937, 938 },
+				{ 942, 943, 944 },
+				{ 360, 361, 362 },
+				{ 366, 367, 368 },
+				{ 363, 364, 365 },
+				{ 369, 370, 371 },
 				{ 348, 349, 350 },
 				{ 351, 352, 353 },
+				{ 1578, 1579, 1580 },
+				{ 1581, 1582, 1583 },
+				{ 1569, 1570, 1571 },
+				{ 1566, 1567, 1568 },
+				{ 1572, 1573, 1574 },
+				{ 1575, 1576, 1577 },
+				{ 1584, 1585, 1586 },
+				{ 1587, 1588, 1589 },
 				{ 354, 355, 356 },
 				{ 357, 358, 359 },
-				{ 360, 361, 362 },
-				{ 363, 364, 365 },
-				{ 366, 367, 368 },
-				{ 369, 370, 371 },
 				{ 372, 373, 374 },
 				{ 375, 376, 377 },
+				{ 387, 388, 389 },
+				{ 384, 385, 386 },
+				{ 963, 964, 965 },
+				{ 960, 961, 962 },
+				{ 975, 976, 977 },
+				{ 972, 973, 974 },
+				{ 939, 940, 941 },
+				{ 987, 988, 989 },
+				{ 924, 925, 926 },
+				{ 984, 985, 986 },
+				{ 1677, 1678, 1679 },
+				{ 1689, 1690, 1691 },
+				{ 1665, 1666, 1667 },
+				{ 1686, 1687, 1688 },
+				{ 1662, 1663, 1664 },
+				{ 1674, 1675, 1676 },
+				{ 1653, 1654, 1655 },
+				{ 1761, 1762, 1763 },
+				{ 783, 784, 785 },
+				{ 867, 868, 869 },
+				{ 864, 865, 866 },
+				{ 780, 781, 782 },
+				{ 1650, 1651, 1652 },
+				{ 1605, 1606, 1607 },
+				{ 1602, 1603, 1604 },
+				{ 1593, 1594, 1595 },
 				{ 378, 379, 380 },
 				{ 381, 382, 383 },
-				{ 384, 385, 386 },
-				{ 387, 388, 389 },
-				{ 390, 391, 392 },
 				{ 393, 394, 395 },
-				{ 396, 397, 398 },
-				{ 399, 400, 401 },
-				{ 402, 403, 404 },
-				{ 405, 406, 407 },
-				{ 408, 409, 410 },
-				{ 411, 412, 413 },
-				{ 414, 415, 416 },
-				{ 417, 418, 419 },
-				{ 420, 421, 422 },
-				{ 423, 424, 425 },
-				{ 426, 427, 428 },
-				{ 429, 430, 431 },
-				{ 432, 433, 434 },
-				{ 435, 436, 437 },
-				{ 438, 439, 440 },
-				{ 441, 442, 443 },
+				{ 390, 391, 392 },
+				{ 969, 970, 971 },
+				{ 966, 967, 968 },
+				{ 981, 982, 983 },
+				{ 978, 979, 980 },
+				{ 945, 946, 947 },
+				{ 993, 994, 995 },
+				{ 930, 931, 932 },
+				{ 990, 991, 992 },
+				{ 1683, 1684, 1685 },
+				{ 1695, 1696, 1697 },
+				{ 1671, 1672, 1673 },
+				{ 1692, 1693, 1694 },
+				{ 1668, 1669, 1670 },
+				{ 1680, 1681, 1682 },
+				{ 1659, 1660, 1661 },
+				{ 1767, 1768, 1769 },
+				{ 789, 790, 791 },
+				{ 1656, 1657, 1658 },
+				{ 786, 787, 788 },
+				{ 1611, 1612, 1613 },
+				{ 1608, 1609, 1610 },
+				{ 1647, 1648, 1649 },
+				{ 777, 778, 779 },
+				{ 1599, 1600, 1601 },
 				{ 444, 445, 446 },
-				{ 447, 448, 449 },
-				{ 450, 451, 452 },
-				{ 453, 454, 455 },
-				{ 456, 457, 458 },
 				{ 459, 460, 461 },
-				{ 462, 463, 464 },
-				{ 465, 466, 467 },
-				{ 468, 469, 470 },
+				{ 456, 457, 458 },
 				{ 471, 472, 473 },
-				{ 474, 475, 476 },
-				{ 477, 478, 479 },
-				{ 480, 481, 482 },
+				{ 468, 469, 470 },
 				{ 483, 484, 485 },
-				{ 486, 487, 488 },
+				{ 480, 481, 482 },
+				{ 450, 451, 452 },
+				{ 465, 466, 467 },
+				{ 462, 463, 464 },
+				{ 477, 478, 479 },
+				{ 474, 475, 476 },
 				{ 489, 490, 491 },
+				{ 486, 487, 488 },
 				{ 492, 493, 494 },
 				{ 495, 496, 497 },
+				{ 507, 508, 509 },
+				{ 504, 505, 506 },
 				{ 498, 499, 500 },
 				{ 501, 502, 503 },
-				{ 504, 505, 506 },
-				{ 507, 508, 509 },
-				{ 510, 511, 512 },
 				{ 513, 514, 515 },
-				{ 516, 517, 518 },
+				{ 510, 511, 512 },
 				{ 519, 520, 521 },
-				{ 522, 523, 524 },
+				{ 636, 637, 638 },
 				{ 525, 526, 527 },
-				{ 528, 529, 530 },
-				{ 531, 532, 533 },
-				{ 534, 535, 536 },
-				{ 537, 538, 539 },
-				{ 540, 541, 542 },
-				{ 543, 544, 545 },
-				{ 546, 547, 548 },
-				{ 549, 550, 551 },
-				{ 552, 553, 554 },
-				{ 555, 556, 557 },
-				{ 558, 559, 560 },
-				{ 561, 562, 563 },
-				{ 564, 565, 566 },
-				{ 567, 568, 569 },
-				{ 570, 571, 572 },
-				{ 573, 574, 575 },
-				{ 576, 577, 578 },
-				{ 579, 580, 581 },
-				{ 582, 583, 584 },
-				{ 585, 586, 587 },
-				{ 588, 589, 590 },
-				{ 591, 592, 593 },
-				{ 594, 595, 596 },
-				{ 597, 598, 599 },
-				{ 600, 601, 602 },
-				{ 603, 604, 605 },
-				{ 606, 607, 608 },
-				{ 609, 610, 611 },
-				{ 612, 613, 614 },
-				{ 615, 616, 617 },
-				{ 618, 619, 620 },
-				{ 621, 622, 623 },
-				{ 624, 625, 626 },
-				{ 627, 628, 629 },
-				{ 630, 631, 632 },
-				{ 633, 634, 635 },
-				{ 636, 637, 638 },
-				{ 639, 640, 641 },
 				{ 642, 643, 644 },
-				{ 645, 646, 647 },
-				{ 648, 649, 650 },
-				{ 651, 652, 653 },
-				{ 654, 655, 656 },
-				{ 657, 658, 659 },
-				{ 660, 661, 662 },
-				{ 663, 664, 665 },
-				{ 666, 667, 668 },
-				{ 669, 670, 671 },
-				{ 672, 673, 674 },
-				{ 675, 676, 677 },
-				{ 678, 679, 680 },
-				{ 681, 682, 683 },
-				{ 684, 685, 686 },
-				{ 687, 688, 689 },
-				{ 690, 691, 692 },
-				{ 693, 694, 695 },
-				{ 696, 697, 698 },
-				{ 699, 700, 701 },
-				{ 702, 703, 704 },
-				{ 705, 706, 707 },
-				{ 708, 709, 710 },
-				{ 711, 712, 713 },
-				{ 714, 715, 716 },
-				{ 717, 718, 719 },
-				{ 720, 721, 722 },
-				{ 723, 724, 725 },
-				{ 726, 727, 728 },
-				{ 729, 730, 731 },
-				{ 732, 733, 734 },
-				{ 735, 736, 737 },
-				{ 738, 739, 740 },
-				{ 741, 742, 743 },
-				{ 744, 745, 746 },
-				{ 747, 748, 749 },
-				{ 750, 751, 752 },
-				{ 753, 754, 755 },
-				{ 756, 757, 758 },
-				{ 759, 760, 761 },
-				{ 762, 763, 764 },
-				{ 765, 766, 767 },
+				{ 612, 613, 614 },
 				{ 768, 769, 770 },
 				{ 771, 772, 773 },
+				{ 876, 877, 878 },
+				{ 816, 817, 818 },
+				{ 819, 820, 821 },
+				{ 879, 880, 881 },
+				{ 828, 829, 830 },
+				{ 831, 832, 833 },
 				{ 774, 775, 776 },
-				{ 777, 778, 779 },
-				{ 780, 781, 782 },
-				{ 783, 784, 785 },
-				{ 786, 787, 788 },
-				{ 789, 790, 791 },
+				{ 882, 883, 884 },
+				{ 822, 823, 824 },
+				{ 825, 826, 827 },
 				{ 792, 793, 794 },
 				{ 795, 796, 797 },
 				{ 798, 799, 800 },
 				{ 801, 802, 803 },
 				{ 804, 805, 806 },
-				{ 807, 808, 809 },
-				{ 810, 811, 812 },
-				{ 813, 814, 815 },
-				{ 816, 817, 818 },
-				{ 819, 820, 821 },
-				{ 822, 823, 824 },
-				{ 825, 826, 827 },
-				{ 828, 829, 830 },
-				{ 831, 832, 833 },
-				{ 834, 835, 836 },
-				{ 837, 838, 839 },
 				{ 840, 841, 842 },
-				{ 843, 844, 845 },
+				{ 810, 811, 812 },
 				{ 846, 847, 848 },
 				{ 849, 850, 851 },
+				{ 813, 814, 815 },
+				{ 921, 922, 923 },
 				{ 852, 853, 854 },
 				{ 855, 856, 857 },
-				{ 858, 859, 860 },
-				{ 861, 862, 863 },
-				{ 864, 865, 866 },
-				{ 867, 868, 869 },
-				{ 870, 871, 872 },
-				{ 873, 874, 875 },
-				{ 876, 877, 878 },
-				{ 879, 880, 881 },
-				{ 882, 883, 884 },
-				{ 885, 886, 887 },
-				{ 888, 889, 890 },
-				{ 891, 892, 893 },
-				{ 894, 895, 896 },
-				{ 897, 898, 899 },
-				{ 900, 901, 902 },
-				{ 903, 904, 905 },
-				{ 906, 907, 908 },
 				{ 909, 910, 911 },
-				{ 912, 913, 914 },
-				{ 915, 916, 917 },
 				{ 918, 919, 920 },
-				{ 921, 922, 923 },
-				{ 924, 925, 926 },
-				{ 927, 928, 929 },
-				{ 930, 931, 932 },
 				{ 933, 934, 935 },
-				{ 936, 937, 938 },
-				{ 939, 940, 941 },
-				{ 942, 943, 944 },
-				{ 945, 946, 947 },
-				{ 948, 949, 950 },
-				{ 951, 952, 953 },
-				{ 954, 955, 956 },
-				{ 957, 958, 959 },
-				{ 960, 961, 962 },
-				{ 963, 964, 965 },
-				{ 966, 967, 968 },
-				{ 969, 970, 971 },
-				{ 972, 973, 974 },
-				{ 975, 976, 977 },
-				{ 978, 979, 980 },
-				{ 981, 982, 983 },
-				{ 984, 985, 986 },
-				{ 987, 988, 989 },
-				{ 990, 991, 992 },
-				{ 993, 994, 995 },
+				{ 912, 913, 914 },
+				{ 927, 928, 929 },
 				{ 996, 997, 998 },
-				{ 999, 1000, 1001 },
+				{ 1080, 1081, 1082 },
+				{ 1083, 1084, 1085 },
+				{ 1086, 1087, 1088 },
+				{ 1089, 1090, 1091 },
 				{ 1002, 1003, 1004 },
-				{ 1005, 1006, 1007 },
-				{ 1008, 1009, 1010 },
-				{ 1011, 1012, 1013 },
-				{ 1014, 1015, 1016 },
-				{ 1017, 1018, 1019 },
-				{ 1020, 1021, 1022 },
-				{ 1023, 1024, 1025 },
-				{ 1026, 1027, 1028 },
-				{ 1029, 1030, 1031 },
-				{ 1032, 1033, 1034 },
-				{ 1035, 1036, 1037 },
-				{ 1038, 1039, 1040 },
-				{ 1041, 1042, 1043 },
 				{ 1044, 1045, 1046 },
 				{ 1047, 1048, 1049 },
-				{ 1050, 1051, 1052 },
 				{ 1053, 1054, 1055 },
-				{ 1056, 1057, 1058 },
+				{ 1050, 1051, 1052 },
 				{ 1059, 1060, 1061 },
+				{ 1056, 1057, 1058 },
 				{ 1062, 1063, 1064 },
 				{ 1065, 1066, 1067 },
 				{ 1068, 1069, 1070 },
 				{ 1071, 1072, 1073 },
 				{ 1074, 1075, 1076 },
 				{ 1077, 1078, 1079 },
-				{ 1080, 1081, 1082 },
-				{ 1083, 1084, 1085 },
-				{ 1086, 1087, 1088 },
-				{ 1089, 1090, 1091 },
 				{ 1092, 1093, 1094 },
-				{ 1095, 1096, 1097 },
 				{ 1098, 1099, 1100 },
+				{ 1095, 1096, 1097 },
 				{ 1101, 1102, 1103 },
 				{ 1104, 1105, 1106 },
 				{ 1107, 1108, 1109 },
-				{ 1110, 1111, 1112 },
-				{ 1113, 1114, 1115 },
-				{ 1116, 1117, 1118 },
-				{ 1119, 1120, 1121 },
-				{ 1122, 1123, 1124 },
-				{ 1125, 1126, 1127 },
-				{ 1128, 1129, 1130 },
-				{ 1131, 1132, 1133 },
-				{ 1134, 1135, 1136 },
-				{ 1137, 1138, 1139 },
-				{ 1140, 1141, 1142 },
-				{ 1143, 1144, 1145 },
-				{ 1146, 1147, 1148 },
-				{ 1149, 1150, 1151 },
-				{ 1152, 1153, 1154 },
-				{ 1155, 1156, 1157 },
-				{ 1158, 1159, 1160 },
-				{ 1161, 1162, 1163 },
-				{ 1164, 1165, 1166 },
-				{ 1167, 1168, 1169 },
-				{ 1170, 1171, 1172 },
-				{ 1173, 1174, 1175 },
-				{ 1176, 1177, 1178 },
-				{ 1179, 1180, 1181 },
-				{ 1182, 1183, 1184 },
-				{ 1185, 1186, 1187 },
-				{ 1188, 1189, 1190 },
-				{ 1191, 1192, 1193 },
-				{ 1194, 1195, 1196 },
-				{ 1197, 1198, 1199 },
-				{ 1200, 1201, 1202 },
-				{ 1203, 1204, 1205 },
-				{ 1206, 1207, 1208 },
-				{ 1209, 1210, 1211 },
-				{ 1212, 1213, 1214 },
-				{ 1215, 1216, 1217 },
-				{ 1218, 1219, 1220 },
-				{ 1221, 1222, 1223 },
-				{ 1224, 1225, 1226 },
-				{ 1227, 1228, 1229 },
-				{ 1230, 1231, 1232 },
-				{ 1233, 1234, 1235 },
-				{ 1236, 1237, 1238 },
-				{ 1239, 1240, 1241 },
-				{ 1242, 1243, 1244 },
-				{ 1245, 1246, 1247 },
-				{ 1248, 1249, 1250 },
-				{ 1251, 1252, 1253 },
-				{ 1254, 1255, 1256 },
-				{ 1257, 1258, 1259 },
-				{ 1260, 1261, 1262 },
-				{ 1263, 1264, 1265 },
-				{ 1266, 1267, 1268 },
-				{ 1269, 1270, 1271 },
-				{ 1272, 1273, 1274 },
-				{ 1275, 1276, 1277 },
-				{ 1278, 1279, 1280 },
-				{ 1281, 1282, 1283 },
-				{ 1284, 1285, 1286 },
-				{ 1287, 1288, 1289 },
-				{ 1290, 1291, 1292 },
-				{ 1293, 1294, 1295 },
-				{ 1296, 1297, 1298 },
-				{ 1299, 1300, 1301 },
-				{ 1302, 1303, 1304 },
-				{ 1305, 1306, 1307 },
-				{ 1308, 1309, 1310 },
-				{ 1311, 1312, 1313 },
-				{ 1314, 1315, 1316 },
-				{ 1317, 1318, 1319 },
-				{ 1320, 1321, 1322 },
-				{ 1323, 1324, 1325 },
 				{ 1326, 1327, 1328 },
-				{ 1329, 1330, 1331 },
 				{ 1332, 1333, 1334 },
-				{ 1335, 1336, 1337 },
-				{ 1338, 1339, 1340 },
-				{ 1341, 1342, 1343 },
-				{ 1344, 1345, 1346 },
-				{ 1347, 1348, 1349 },
-				{ 1350, 1351, 1352 },
-				{ 1353, 1354, 1355 },
-				{ 1356, 1357, 1358 },
-				{ 1359, 1360, 1361 },
-				{ 1362, 1363, 1364 },
-				{ 1365, 1366, 1367 },
-				{ 1368, 1369, 1370 },
-				{ 1371, 1372, 1373 },
-				{ 1374, 1375, 1376 },
-				{ 1377, 1378, 1379 },
-				{ 1380, 1381, 1382 },
-				{ 1383, 1384, 1385 },
-				{ 1386, 1387, 1388 },
-				{ 1389, 1390, 1391 },
-				{ 1392, 1393, 1394 },
-				{ 1395, 1396, 1397 },
-				{ 1398, 1399, 1400 },
-				{ 1401, 1402, 1403 },
-				{ 1404, 1405, 1406 },
-				{ 1407, 1408, 1409 },
-				{ 1410, 1411, 1412 },
-				{ 1413, 1414, 1415 },
-				{ 1416, 1417, 1418 },
-				{ 1419, 1420, 1421 },
 				{ 1422, 1423, 1424 },
 				{ 1425, 1426, 1427 },
+				{ 1437, 1438, 1439 },
+				{ 1434, 1435, 1436 },
+				{ 1449, 1450, 1451 },
+				{ 1446, 1447, 1448 },
+				{ 1974, 1975, 1976 },
+				{ 1941, 1942, 1943 },
 				{ 1428, 1429, 1430 },
 				{ 1431, 1432, 1433 },
-				{ 1434, 1435, 1436 },
-				{ 1437, 1438, 1439 },
-				{ 1440, 1441, 1442 },
 				{ 1443, 1444, 1445 },
-				{ 1446, 1447, 1448 },
-				{ 1449, 1450, 1451 },
-				{ 1452, 1453, 1454 },
+				{ 1440, 1441, 1442 },
 				{ 1455, 1456, 1457 },
+				{ 1452, 1453, 1454 },
+				{ 1980, 1981, 1982 },
+				{ 1947, 1948, 1949 },
 				{ 1458, 1459, 1460 },
 				{ 1461, 1462, 1463 },
+				{ 1473, 1474, 1475 },
+				{ 1470, 1471, 1472 },
+				{ 1938, 1939, 1940 },
+				{ 1485, 1486, 1487 },
+				{ 1482, 1483, 1484 },
+				{ 1830, 1831, 1832 },
+				{ 1833, 1834, 1835 },
+				{ 1995, 1996, 1997 },
 				{ 1464, 1465, 1466 },
 				{ 1467, 1468, 1469 },
-				{ 1470, 1471, 1472 },
-				{ 1473, 1474, 1475 },
-				{ 1476, 1477, 1478 },
 				{ 1479, 1480, 1481 },
-				{ 1482, 1483, 1484 },
-				{ 1485, 1486, 1487 },
-				{ 1488, 1489, 1490 },
+				{ 1476, 1477, 1478 },
+				{ 1944, 1945, 1946 },
 				{ 1491, 1492, 1493 },
+				{ 1488, 1489, 1490 },
+				{ 1836, 1837, 1838 },
+				{ 1839, 1840, 1841 },
+				{ 2001, 2002, 2003 },
 				{ 1494, 1495, 1496 },
 				{ 1497, 1498, 1499 },
 				{ 1500, 1501, 1502 },
 				{ 1503, 1504, 1505 },
 				{ 1506, 1507, 1508 },
 				{ 1509, 1510, 1511 },
+				{ 1521, 1522, 1523 },
+				{ 1518, 1519, 1520 },
+				{ 2064, 2065, 2066 },
+				{ 1701, 1702, 1703 },
+				{ 1698, 1699, 1700 },
+				{ 2079, 2080, 2081 },
+				{ 2067, 2068, 2069 },
+				{ 1770, 1771, 1772 },
+				{ 2052, 2053, 2054 },
+				{ 2088, 2089, 2090 },
+				{ 2043, 2044, 2045 },
+				{ 1758, 1759, 1760 },
+				{ 2055, 2056, 2057 },
+				{ 2298, 2299, 2300 },
+				{ 2040, 2041, 2042 },
+				{ 1746, 1747, 1748 },
+				{ 1641, 1642, 1643 },
+				{ 1749, 1750, 1751 },
+				{ 1737, 1738, 1739 },
+				{ 1734, 1735, 1736 },
+				{ 1533, 1534, 1535 },
+				{ 2124, 2125, 2126 },
+				{ 2139, 2140, 2141 },
+				{ 2322, 2323, 2324 },
+				{ 1773, 1774, 1775 },
+				{ 2895, 2896, 2897 },
+				{ 2430, 2431, 2432 },
+				{ 2385, 2386, 2387 },
+				{ 2136, 2137, 2138 },
+				{ 2325, 2326, 2327 },
+				{ 2472, 2473, 2474 },
+				{ 2433, 2434, 2435 },
+				{ 2127, 2128, 2129 },
+				{ 2475, 2476, 2477 },
+				{ 2766, 2767, 2768 },
+				{ 2361, 2362, 2363 },
+				{ 2508, 2509, 2510 },
+				{ 2511, 2512, 2513 },
+				{ 2418, 2419, 2420 },
+				{ 2460, 2461, 2462 },
+				{ 2463, 2464, 2465 },
+				{ 2448, 2449, 2450 },
+				{ 2451, 2452, 2453 },
+				{ 2769, 2770, 2771 },
+				{ 2778, 2779, 2780 },
+				{ 2532, 2533, 2534 },
+				{ 1992, 1993, 1994 },
+				{ 2409, 2410, 2411 },
+				{ 2535, 2536, 2537 },
+				{ 1722, 1723, 1724 },
+				{ 2286, 2287, 2288 },
+				{ 2289, 2290, 2291 },
+				{ 2394, 2395, 2396 },
+				{ 2781, 2782, 2783 },
+				{ 2544, 2545, 2546 },
+				{ 1725, 1726, 1727 },
+				{ 2547, 2548, 2549 },
+				{ 2274, 2275, 2276 },
+				{ 2277, 2278, 2279 },
+				{ 2790, 2791, 2792 },
+				{ 2793, 2794, 2795 },
+				{ 2382, 2383, 2384 },
 				{ 1512, 1513, 1514 },
 				{ 1515, 1516, 1517 },
-				{ 1518, 1519, 1520 },
-				{ 1521, 1522, 1523 },
-				{ 1524, 1525, 1526 },
 				{ 1527, 1528, 1529 },
+				{ 1524, 1525, 1526 },
+				{ 2070, 2071, 2072 },
+				{ 1707, 1708, 1709 },
+				{ 1704, 1705, 1706 },
+				{ 2085, 2086, 2087 },
+				{ 2073, 2074, 2075 },
+				{ 1776, 1777, 1778 },
+				{ 2058, 2059, 2060 },
+				{ 2091, 2092, 2093 },
+				{ 2049, 2050, 2051 },
+				{ 1764, 1765, 1766 },
+				{ 2061, 2062, 2063 },
+				{ 2304, 2305, 2306 },
+				{ 2046, 2047, 2048 },
+				{ 1752, 1753, 1754 },
+				{ 1755, 1756, 1757 },
+				{ 1743, 1744, 1745 },
+				{ 1740, 1741, 1742 },
+				{ 1539, 1540, 1541 },
+				{ 2130, 2131, 2132 },
+				{ 2145, 2146, 2147 },
+				{ 2328, 2329, 2330 },
+				{ 2901, 2902, 2903 },
+				{ 1779, 1780, 1781 },
+				{ 2436, 2437, 2438 },
+				{ 2391, 2392, 2393 },
+				{ 2142, 2143, 2144 },
+				{ 2133, 2134, 2135 },
+				{ 2478, 2479, 2480 },
+				{ 2331, 2332, 2333 },
+				{ 2439, 2440, 2441 },
+				{ 2481, 2482, 2483 },
+				{ 2772, 2773, 2774 },
+				{ 2367, 2368, 2369 },
+				{ 2514, 2515, 2516 },
+				{ 2517, 2518, 2519 },
+				{ 2424, 2425, 2426 },
+				{ 2466, 2467, 2468 },
+				{ 2469, 2470, 2471 },
+				{ 2454, 2455, 2456 },
+				{ 2457, 2458, 2459 },
+				{ 2775, 2776, 2777 },
+				{ 2784, 2785, 2786 },
+				{ 2538, 2539, 2540 },
+				{ 1728, 1729, 1730 },
+				{ 2541, 2542, 2543 },
+				{ 2415, 2416, 2417 },
+				{ 1998, 1999, 2000 },
+				{ 2292, 2293, 2294 },
+				{ 2295, 2296, 2297 },
+				{ 2400, 2401, 2402 },
+				{ 2787, 2788, 2789 },
+				{ 2550, 2551, 2552 },
+				{ 2553, 2554, 2555 },
+				{ 2280, 2281, 2282 },
+				{ 1731, 1732, 1733 },
+				{ 2283, 2284, 2285 },
+				{ 2796, 2797, 2798 },
+				{ 2799, 2800, 2801 },
 				{ 1530, 1531, 1532 },
-				{ 1533, 1534, 1535 },
 				{ 1536, 1537, 1538 },
-				{ 1539, 1540, 1541 },
 				{ 1542, 1543, 1544 },
-				{ 1545, 1546, 1547 },
 				{ 1548, 1549, 1550 },
+				{ 1545, 1546, 1547 },
 				{ 1551, 1552, 1553 },
-				{ 1554, 1555, 1556 },
-				{ 1557, 1558, 1559 },
-				{ 1560, 1561, 1562 },
-				{ 1563, 1564, 1565 },
-				{ 1566, 1567, 1568 },
-				{ 1569, 1570, 1571 },
-				{ 1572, 1573, 1574 },
-				{ 1575, 1576, 1577 },
-				{ 1578, 1579, 1580 },
-				{ 1581, 1582, 1583 },
-				{ 1584, 1585, 1586 },
-				{ 1587, 1588, 1589 },
-				{ 1590, 1591, 1592 },
-				{ 1593, 1594, 1595 },
-				{ 1596, 1597, 1598 },
-				{ 1599, 1600, 1601 },
-				{ 1602, 1603, 1604 },
-				{ 1605, 1606, 1607 },
-				{ 1608, 1609, 1610 },
-				{ 1611, 1612, 1613 },
 				{ 1614, 1615, 1616 },
-				{ 1617, 1618, 1619 },
 				{ 1620, 1621, 1622 },
-				{ 1623, 1624, 1625 },
-				{ 1626, 1627, 1628 },
+				{ 1617, 1618, 1619 },
+				{ 1638, 1639, 1640 },
 				{ 1629, 1630, 1631 },
-				{ 1632, 1633, 1634 },
+				{ 1557, 1558, 1559 },
+				{ 1554, 1555, 1556 },
+				{ 1563, 1564, 1565 },
+				{ 1560, 1561, 1562 },
 				{ 1635, 1636, 1637 },
-				{ 1638, 1639, 1640 },
-				{ 1641, 1642, 1643 },
+				{ 1626, 1627, 1628 },
+				{ 1623, 1624, 1625 },
+				{ 1632, 1633, 1634 },
 				{ 1644, 1645, 1646 },
-				{ 1647, 1648, 1649 },
-				{ 1650, 1651, 1652 },
-				{ 1653, 1654, 1655 },
-				{ 1656, 1657, 1658 },
-				{ 1659, 1660, 1661 },
-				{ 1662, 1663, 1664 },
-				{ 1665, 1666, 1667 },
-				{ 1668, 1669, 1670 },
-				{ 1671, 1672, 1673 },
-				{ 1674, 1675, 1676 },
-				{ 1677, 1678, 1679 },
-				{ 1680, 1681, 1682 },
-				{ 1683, 1684, 1685 },
-				{ 1686, 1687, 1688 },
-				{ 1689, 1690, 1691 },
-				{ 1692, 1693, 1694 },
-				{ 1695, 1696, 1697 },
-				{ 1698, 1699, 1700 },
-				{ 1701, 1702, 1703 },
-				{ 1704, 1705, 1706 },
-				{ 1707, 1708, 1709 },
+				{ 1590, 1591, 1592 },
+				{ 1596, 1597, 1598 },
 				{ 1710, 1711, 1712 },
 				{ 1713, 1714, 1715 },
-				{ 1716, 1717, 1718 },
-				{ 1719, 1720, 1721 },
-				{ 1722, 1723, 1724 },
-				{ 1725, 1726, 1727 },
-				{ 1728, 1729, 1730 },
-				{ 1731, 1732, 1733 },
-				{ 1734, 1735, 1736 },
-				{ 1737, 1738, 1739 },
-				{ 1740, 1741, 1742 },
-				{ 1743, 1744, 1745 },
-				{ 1746, 1747, 1748 },
-				{ 1749, 1750, 1751 },
-				{ 1752, 1753, 1754 },
-				{ 1755, 1756, 1757 },
-				{ 1758, 1759, 1760 },
-				{ 1761, 1762, 1763 },
-				{ 1764, 1765, 1766 },
-				{ 1767, 1768, 1769 },
-				{ 1770, 1771, 1772 },
-				{ 1773, 1774, 1775 },
-				{ 1776, 1777, 1778 },
-				{ 1779, 1780, 1781 },
+				{ 2148, 2149, 2150 },
+				{ 2115, 2116, 2117 },
+				{ 2112, 2113, 2114 },
+				{ 2100, 2101, 2102 },
+				{ 2103, 2104, 2105 },
 				{ 1782, 1783, 1784 },
 				{ 1785, 1786, 1787 },
-				{ 1788, 1789, 1790 },
-				{ 1791, 1792, 1793 },
-				{ 1794, 1795, 1796 },
+				{ 2883, 2884, 2885 },
+				{ 2880, 2881, 2882 },
+				{ 1893, 1894, 1895 },
+				{ 1878, 1879, 1880 },
+				{ 1881, 1882, 1883 },
+				{ 1716, 1717, 1718 },
+				{ 1719, 1720, 1721 },
+				{ 2151, 2152, 2153 },
+				{ 2121, 2122, 2123 },
+				{ 2118, 2119, 2120 },
+				{ 2106, 2107, 2108 },
+				{ 2109, 2110, 2111 },
+				{ 1788, 1789, 1790 },
+				{ 1791, 1792, 1793 },
+				{ 2889, 2890, 2891 },
+				{ 2886, 2887, 2888 },
+				{ 1899, 1900, 1901 },
+				{ 1884, 1885, 1886 },
+				{ 1887, 1888, 1889 },
+				{ 1794, 1795, 1796 },
 				{ 1797, 1798, 1799 },
-				{ 1800, 1801, 1802 },
-				{ 1803, 1804, 1805 },
 				{ 1806, 1807, 1808 },
 				{ 1809, 1810, 1811 },
-				{ 1812, 1813, 1814 },
+				{ 1803, 1804, 1805 },
 				{ 1815, 1816, 1817 },
+				{ 1812, 1813, 1814 },
+				{ 1800, 1801, 1802 },
+				{ 1902, 1903, 1904 },
+				{ 1914, 1915, 1916 },
+				{ 1917, 1918, 1919 },
+				{ 1905, 1906, 1907 },
+				{ 1857, 1858, 1859 },
+				{ 1854, 1855, 1856 },
+				{ 1869, 1870, 1871 },
+				{ 1866, 1867, 1868 },
+				{ 1842, 1843, 1844 },
+				{ 1845, 1846, 1847 },
+				{ 1953, 1954, 1955 },
+				{ 1929, 1930, 1931 },
+				{ 1926, 1927, 1928 },
+				{ 1950, 1951, 1952 },
+				{ 1977, 1978, 1979 },
 				{ 1818, 1819, 1820 },
+				{ 1890, 1891, 1892 },
 				{ 1821, 1822, 1823 },
-				{ 1824, 1825, 1826 },
 				{ 1827, 1828, 1829 },
-				{ 1830, 1831, 1832 },
-				{ 1833, 1834, 1835 },
-				{ 1836, 1837, 1838 },
-				{ 1839, 1840, 1841 },
-				{ 1842, 1843, 1844 },
-				{ 1845, 1846, 1847 },
+				{ 1824, 1825, 1826 },
+				{ 1896, 1897, 1898 },
 				{ 1848, 1849, 1850 },
 				{ 1851, 1852, 1853 },
-				{ 1854, 1855, 1856 },
-				{ 1857, 1858, 1859 },
 				{ 1860, 1861, 1862 },
+				{ 1935, 1936, 1937 },
+				{ 1932, 1933, 1934 },
+				{ 1920, 1921, 1922 },
 				{ 1863, 1864, 1865 },
-				{ 1866, 1867, 1868 },
-				{ 1869, 1870, 1871 },
+				{ 1923, 1924, 1925 },
+				{ 2025, 2026, 2027 },
+				{ 2013, 2014, 2015 },
+				{ 2010, 2011, 2012 },
 				{ 1872, 1873, 1874 },
+				{ 2022, 2023, 2024 },
+				{ 2427, 2428, 2429 },
 				{ 1875, 1876, 1877 },
-				{ 1878, 1879, 1880 },
-				{ 1881, 1882, 1883 },
-				{ 1884, 1885, 1886 },
-				{ 1887, 1888, 1889 },
-				{ 1890, 1891, 1892 },
-				{ 1893, 1894, 1895 },
-				{ 1896, 1897, 1898 },
-				{ 1899, 1900, 1901 },
-				{ 1902, 1903, 1904 },
-				{ 1905, 1906, 1907 },
+				{ 2037, 2038, 2039 },
 				{ 1908, 1909, 1910 },
 				{ 1911, 1912, 1913 },
-				{ 1914, 1915, 1916 },
-				{ 1917, 1918, 1919 },
-				{ 1920, 1921, 1922 },
-				{ 1923, 1924, 1925 },
-				{ 1926, 1927, 1928 },
-				{ 1929, 1930, 1931 },
-				{ 1932, 1933, 1934 },
-				{ 1935, 1936, 1937 },
-				{ 1938, 1939, 1940 },
-				{ 1941, 1942, 1943 },
-				{ 1944, 1945, 1946 },
-				{ 1947, 1948, 1949 },
-				{ 1950, 1951, 1952 },
-				{ 1953, 1954, 1955 },
+				{ 2034, 2035, 2036 },
 				{ 1956, 1957, 1958 },
+				{ 1983, 1984, 1985 },
 				{ 1959, 1960, 1961 },
+				{ 1986, 1987, 1988 },
+				{ 1989, 1990, 1991 },
 				{ 1962, 1963, 1964 },
 				{ 1965, 1966, 1967 },
 				{ 1968, 1969, 1970 },
 				{ 1971, 1972, 1973 },
-				{ 1974, 1975, 1976 },
-				{ 1977, 1978, 1979 },
-				{ 1980, 1981, 1982 },
-				{ 1983, 1984, 1985 },
-				{ 1986, 1987, 1988 },
-				{ 1989, 1990, 1991 },
-				{ 1992, 1993, 1994 },
-				{ 1995, 1996, 1997 },
-				{ 1998, 1999, 2000 },
-				{ 2001, 2002, 2003 },
 				{ 2004, 2005, 2006 },
-				{ 2007, 2008, 2009 },
-				{ 2010, 2011, 2012 },
-				{ 2013, 2014, 2015 },
-				{ 2016, 2017, 2018 },
 				{ 2019, 2020, 2021 },
-				{ 2022, 2023, 2024 },
-				{ 2025, 2026, 2027 },
-				{ 2028, 2029, 2030 },
+				{ 2016, 2017, 2018 },
+				{ 2421, 2422, 2423 },
 				{ 2031, 2032, 2033 },
-				{ 2034, 2035, 2036 },
-				{ 2037, 2038, 2039 },
-				{ 2040, 2041, 2042 },
-				{ 2043, 2044, 2045 },
-				{ 2046, 2047, 2048 },
-				{ 2049, 2050, 2051 },
-				{ 2052, 2053, 2054 },
-				{ 2055, 2056, 2057 },
-				{ 2058, 2059, 2060 },
-				{ 2061, 2062, 2063 },
-				{ 2064, 2065, 2066 },
-				{ 2067, 2068, 2069 },
-				{ 2070, 2071, 2072 },
-				{ 2073, 2074, 2075 },
+				{ 2028, 2029, 2030 },
+				{ 2007, 2008, 2009 },
 				{ 2076, 2077, 2078 },
-				{ 2079, 2080, 2081 },
-				{ 2082, 2083, 2084 },
-				{ 2085, 2086, 2087 },
-				{ 2088, 2089, 2090 },
-				{ 2091, 2092, 2093 },
 				{ 2094, 2095, 2096 },
 				{ 2097, 2098, 2099 },
-				{ 2100, 2101, 2102 },
-				{ 2103, 2104, 2105 },
-				{ 2106, 2107, 2108 },
-				{ 2109, 2110, 2111 },
-				{ 2112, 2113, 2114 },
-				{ 2115, 2116, 2117 },
-				{ 2118, 2119, 2120 },
-				{ 2121, 2122, 2123 },
-				{ 2124, 2125, 2126 },
-				{ 2127, 2128, 2129 },
-				{ 2130, 2131, 2132 },
-				{ 2133, 2134, 2135 },
-				{ 2136, 2137, 2138 },
-				{ 2139, 2140, 2141 },
-				{ 2142, 2143, 2144 },
-				{ 2145, 2146, 2147 },
-				{ 2148, 2149, 2150 },
-				{ 2151, 2152, 2153 },
+				{ 2082, 2083, 2084 },
 				{ 2154, 2155, 2156 },
 				{ 2157, 2158, 2159 },
-				{ 2160, 2161, 2162 },
-				{ 2163, 2164, 2165 },
 				{ 2166, 2167, 2168 },
 				{ 2169, 2170, 2171 },
-				{ 2172, 2173, 2174 },
-				{ 2175, 2176, 2177 },
 				{ 2178, 2179, 2180 },
 				{ 2181, 2182, 2183 },
-				{ 2184, 2185, 2186 },
-				{ 2187, 2188, 2189 },
 				{ 2190, 2191, 2192 },
 				{ 2193, 2194, 2195 },
-				{ 2196, 2197, 2198 },
-				{ 2199, 2200, 2201 },
 				{ 2202, 2203, 2204 },
+				{ 2337, 2338, 2339 },
+				{ 2334, 2335, 2336 },
+				{ 2406, 2407, 2408 },
+				{ 2397, 2398, 2399 },
 				{ 2205, 2206, 2207 },
-				{ 2208, 2209, 2210 },
-				{ 2211, 2212, 2213 },
 				{ 2214, 2215, 2216 },
+				{ 2229, 2230, 2231 },
 				{ 2217, 2218, 2219 },
+				{ 2313, 2314, 2315 },
+				{ 2358, 2359, 2360 },
+				{ 2373, 2374, 2375 },
+				{ 2370, 2371, 2372 },
+				{ 2310, 2311, 2312 },
+				{ 2160, 2161, 2162 },
+				{ 2163, 2164, 2165 },
+				{ 2172, 2173, 2174 },
+				{ 2175, 2176, 2177 },
+				{ 2184, 2185, 2186 },
+				{ 2187, 2188, 2189 },
+				{ 2196, 2197, 2198 },
+				{ 2199, 2200, 2201 },
+				{ 2208, 2209, 2210 },
+				{ 2343, 2344, 2345 },
+				{ 2340, 2341, 2342 },
+				{ 2412, 2413, 2414 },
+				{ 2403, 2404, 2405 },
+				{ 2211, 2212, 2213 },
 				{ 2220, 2221, 2222 },
+				{ 2388, 2389, 2390 },
+				{ 2364, 2365, 2366 },
+				{ 2379, 2380, 2381 },
+				{ 2235, 2236, 2237 },
+				{ 2376, 2377, 2378 },
 				{ 2223, 2224, 2225 },
+				{ 2319, 2320, 2321 },
+				{ 2316, 2317, 2318 },
 				{ 2226, 2227, 2228 },
-				{ 2229, 2230, 2231 },
-				{ 2232, 2233, 2234 },
-				{ 2235, 2236, 2237 },
-				{ 2238, 2239, 2240 },
+				{ 2595, 2596, 2597 },
+				{ 2520, 2521, 2522 },
+				{ 2523, 2524, 2525 },
+				{ 2592, 2593, 2594 },
+				{ 2346, 2347, 2348 },
+				{ 2700, 2701, 2702 },
+				{ 2349, 2350, 2351 },
 				{ 2241, 2242, 2243 },
-				{ 2244, 2245, 2246 },
+				{ 2238, 2239, 2240 },
+				{ 2583, 2584, 2585 },
+				{ 2232, 2233, 2234 },
+				{ 2601, 2602, 2603 },
+				{ 2526, 2527, 2528 },
+				{ 2529, 2530, 2531 },
+				{ 2598, 2599, 2600 },
+				{ 2352, 2353, 2354 },
+				{ 2706, 2707, 2708 },
+				{ 2355, 2356, 2357 },
 				{ 2247, 2248, 2249 },
+				{ 2244, 2245, 2246 },
+				{ 2589, 2590, 2591 },
 				{ 2250, 2251, 2252 },
 				{ 2253, 2254, 2255 },
+				{ 2265, 2266, 2267 },
+				{ 2262, 2263, 2264 },
 				{ 2256, 2257, 2258 },
 				{ 2259, 2260, 2261 },
-				{ 2262, 2263, 2264 },
-				{ 2265, 2266, 2267 },
-				{ 2268, 2269, 2270 },
 				{ 2271, 2272, 2273 },
-				{ 2274, 2275, 2276 },
-				{ 2277, 2278, 2279 },
-				{ 2280, 2281, 2282 },
-				{ 2283, 2284, 2285 },
-				{ 2286, 2287, 2288 },
-				{ 2289, 2290, 2291 },
-				{ 2292, 2293, 2294 },
-				{ 2295, 2296, 2297 },
-				{ 2298, 2299, 2300 },
+				{ 2268, 2269, 2270 },
 				{ 2301, 2302, 2303 },
-				{ 2304, 2305, 2306 },
+				{ 2442, 2443, 2444 },
 				{ 2307, 2308, 2309 },
-				{ 2310, 2311, 2312 },
-				{ 2313, 2314, 2315 },
-				{ 2316, 2317, 2318 },
-				{ 2319, 2320, 2321 },
-				{ 2322, 2323, 2324 },
-				{ 2325, 2326, 2327 },
-				{ 2328, 2329, 2330 },
-				{ 2331, 2332, 2333 },
-				{ 2334, 2335, 2336 },
-				{ 2337, 2338, 2339 },
-				{ 2340, 2341, 2342 },
-				{ 2343, 2344, 2345 },
-				{ 2346, 2347, 2348 },
-				{ 2349, 2350, 2351 },
-				{ 2352, 2353, 2354 },
-				{ 2355, 2356, 2357 },
-				{ 2358, 2359, 2360 },
-				{ 2361, 2362, 2363 },
-				{ 2364, 2365, 2366 },
-				{ 2367, 2368, 2369 },
-				{ 2370, 2371, 2372 },
-				{ 2373, 2374, 2375 },
-				{ 2376, 2377, 2378 },
-				{ 2379, 2380, 2381 },
-				{ 2382, 2383, 2384 },
-				{ 2385, 2386, 2387 },
-				{ 2388, 2389, 2390 },
-				{ 2391, 2392, 2393 },
-				{ 2394, 2395, 2396 },
-				{ 2397, 2398, 2399 },
-				{ 2400, 2401, 2402 },
-				{ 2403, 2404, 2405 },
-				{ 2406, 2407, 2408 },
-				{ 2409, 2410, 2411 },
-				{ 2412, 2413, 2414 },
-				{ 2415, 2416, 2417 },
-				{ 2418, 2419, 2420 },
-				{ 2421, 2422, 2423 },
-				{ 2424, 2425, 2426 },
-				{ 2427, 2428, 2429 },
-				{ 2430, 2431, 2432 },
-				{ 2433, 2434, 2435 },
-				{ 2436, 2437, 2438 },
-				{ 2439, 2440, 2441 },
-				{ 2442, 2443, 2444 },
 				{ 2445, 2446, 2447 },
-				{ 2448, 2449, 2450 },
-				{ 2451, 2452, 2453 },
-				{ 2454, 2455, 2456 },
-				{ 2457, 2458, 2459 },
-				{ 2460, 2461, 2462 },
-				{ 2463, 2464, 2465 },
-				{ 2466, 2467, 2468 },
-				{ 2469, 2470, 2471 },
-				{ 2472, 2473, 2474 },
-				{ 2475, 2476, 2477 },
-				{ 2478, 2479, 2480 },
-				{ 2481, 2482, 2483 },
 				{ 2484, 2485, 2486 },
 				{ 2487, 2488, 2489 },
 				{ 2490, 2491, 2492 },
@@ -3763,141 +3807,1263 @@ namespace Assets
 				{ 2499, 2500, 2501 },
 				{ 2502, 2503, 2504 },
 				{ 2505, 2506, 2507 },
-				{ 2508, 2509, 2510 },
-				{ 2511, 2512, 2513 },
-				{ 2514, 2515, 2516 },
-				{ 2517, 2518, 2519 },
-				{ 2520, 2521, 2522 },
-				{ 2523, 2524, 2525 },
-				{ 2526, 2527, 2528 },
-				{ 2529, 2530, 2531 },
-				{ 2532, 2533, 2534 },
-				{ 2535, 2536, 2537 },
-				{ 2538, 2539, 2540 },
-				{ 2541, 2542, 2543 },
-				{ 2544, 2545, 2546 },
-				{ 2547, 2548, 2549 },
-				{ 2550, 2551, 2552 },
-				{ 2553, 2554, 2555 },
 				{ 2556, 2557, 2558 },
 				{ 2559, 2560, 2561 },
 				{ 2562, 2563, 2564 },
 				{ 2565, 2566, 2567 },
 				{ 2568, 2569, 2570 },
 				{ 2571, 2572, 2573 },
+				{ 2580, 2581, 2582 },
 				{ 2574, 2575, 2576 },
 				{ 2577, 2578, 2579 },
-				{ 2580, 2581, 2582 },
-				{ 2583, 2584, 2585 },
 				{ 2586, 2587, 2588 },
-				{ 2589, 2590, 2591 },
-				{ 2592, 2593, 2594 },
-				{ 2595, 2596, 2597 },
-				{ 2598, 2599, 2600 },
-				{ 2601, 2602, 2603 },
 				{ 2604, 2605, 2606 },
 				{ 2607, 2608, 2609 },
-				{ 2610, 2611, 2612 },
-				{ 2613, 2614, 2615 },
+				{ 2688, 2689, 2690 },
+				{ 2691, 2692, 2693 },
+				{ 2676, 2677, 2678 },
+				{ 2679, 2680, 2681 },
 				{ 2616, 2617, 2618 },
 				{ 2619, 2620, 2621 },
-				{ 2622, 2623, 2624 },
-				{ 2625, 2626, 2627 },
+				{ 2664, 2665, 2666 },
 				{ 2628, 2629, 2630 },
 				{ 2631, 2632, 2633 },
-				{ 2634, 2635, 2636 },
-				{ 2637, 2638, 2639 },
+				{ 2667, 2668, 2669 },
 				{ 2640, 2641, 2642 },
+				{ 2712, 2713, 2714 },
 				{ 2643, 2644, 2645 },
-				{ 2646, 2647, 2648 },
-				{ 2649, 2650, 2651 },
+				{ 2724, 2725, 2726 },
+				{ 2727, 2728, 2729 },
 				{ 2652, 2653, 2654 },
+				{ 2715, 2716, 2717 },
+				{ 2739, 2740, 2741 },
 				{ 2655, 2656, 2657 },
-				{ 2658, 2659, 2660 },
-				{ 2661, 2662, 2663 },
-				{ 2664, 2665, 2666 },
-				{ 2667, 2668, 2669 },
-				{ 2670, 2671, 2672 },
-				{ 2673, 2674, 2675 },
-				{ 2676, 2677, 2678 },
-				{ 2679, 2680, 2681 },
-				{ 2682, 2683, 2684 },
-				{ 2685, 2686, 2687 },
-				{ 2688, 2689, 2690 },
-				{ 2691, 2692, 2693 },
+				{ 2748, 2749, 2750 },
+				{ 2751, 2752, 2753 },
+				{ 2760, 2761, 2762 },
+				{ 2703, 2704, 2705 },
+				{ 2610, 2611, 2612 },
+				{ 2613, 2614, 2615 },
 				{ 2694, 2695, 2696 },
 				{ 2697, 2698, 2699 },
-				{ 2700, 2701, 2702 },
-				{ 2703, 2704, 2705 },
-				{ 2706, 2707, 2708 },
-				{ 2709, 2710, 2711 },
-				{ 2712, 2713, 2714 },
-				{ 2715, 2716, 2717 },
+				{ 2682, 2683, 2684 },
+				{ 2685, 2686, 2687 },
+				{ 2622, 2623, 2624 },
+				{ 2625, 2626, 2627 },
+				{ 2670, 2671, 2672 },
+				{ 2634, 2635, 2636 },
+				{ 2637, 2638, 2639 },
+				{ 2673, 2674, 2675 },
+				{ 2646, 2647, 2648 },
 				{ 2718, 2719, 2720 },
-				{ 2721, 2722, 2723 },
-				{ 2724, 2725, 2726 },
-				{ 2727, 2728, 2729 },
+				{ 2649, 2650, 2651 },
 				{ 2730, 2731, 2732 },
 				{ 2733, 2734, 2735 },
-				{ 2736, 2737, 2738 },
-				{ 2739, 2740, 2741 },
-				{ 2742, 2743, 2744 },
+				{ 2658, 2659, 2660 },
+				{ 2721, 2722, 2723 },
 				{ 2745, 2746, 2747 },
-				{ 2748, 2749, 2750 },
-				{ 2751, 2752, 2753 },
+				{ 2661, 2662, 2663 },
 				{ 2754, 2755, 2756 },
 				{ 2757, 2758, 2759 },
-				{ 2760, 2761, 2762 },
 				{ 2763, 2764, 2765 },
-				{ 2766, 2767, 2768 },
-				{ 2769, 2770, 2771 },
-				{ 2772, 2773, 2774 },
-				{ 2775, 2776, 2777 },
-				{ 2778, 2779, 2780 },
-				{ 2781, 2782, 2783 },
-				{ 2784, 2785, 2786 },
-				{ 2787, 2788, 2789 },
-				{ 2790, 2791, 2792 },
-				{ 2793, 2794, 2795 },
-				{ 2796, 2797, 2798 },
-				{ 2799, 2800, 2801 },
+				{ 2709, 2710, 2711 },
+				{ 2736, 2737, 2738 },
+				{ 2742, 2743, 2744 },
 				{ 2802, 2803, 2804 },
 				{ 2805, 2806, 2807 },
 				{ 2808, 2809, 2810 },
 				{ 2811, 2812, 2813 },
 				{ 2814, 2815, 2816 },
 				{ 2817, 2818, 2819 },
-				{ 2820, 2821, 2822 },
-				{ 2823, 2824, 2825 },
 				{ 2826, 2827, 2828 },
 				{ 2829, 2830, 2831 },
+				{ 2868, 2869, 2870 },
+				{ 2871, 2872, 2873 },
+				{ 2820, 2821, 2822 },
+				{ 2823, 2824, 2825 },
 				{ 2832, 2833, 2834 },
 				{ 2835, 2836, 2837 },
+				{ 2874, 2875, 2876 },
+				{ 2877, 2878, 2879 },
 				{ 2838, 2839, 2840 },
 				{ 2841, 2842, 2843 },
+				{ 2853, 2854, 2855 },
+				{ 2850, 2851, 2852 },
 				{ 2844, 2845, 2846 },
 				{ 2847, 2848, 2849 },
-				{ 2850, 2851, 2852 },
-				{ 2853, 2854, 2855 },
-				{ 2856, 2857, 2858 },
 				{ 2859, 2860, 2861 },
+				{ 2856, 2857, 2858 },
 				{ 2862, 2863, 2864 },
 				{ 2865, 2866, 2867 },
-				{ 2868, 2869, 2870 },
-				{ 2871, 2872, 2873 },
-				{ 2874, 2875, 2876 },
-				{ 2877, 2878, 2879 },
-				{ 2880, 2881, 2882 },
-				{ 2883, 2884, 2885 },
-				{ 2886, 2887, 2888 },
-				{ 2889, 2890, 2891 },
 				{ 2892, 2893, 2894 },
-				{ 2895, 2896, 2897 },
 				{ 2898, 2899, 2900 },
-				{ 2901, 2902, 2903 },
 			};
 
 			constexpr auto TriangleCount = sizeof(Triangles) / sizeof(triangle_face_t);
+
+			static constexpr meshlet_t Meshlets[] PROGMEM
+			{
+				{ {(UpSize * (int32_t)(62)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(23)) / DownSize}, (UpSize * (int32_t)(34)) / DownSize, { 5629, -5952, 39 }, 20773, 0, 12 },
+				{ {(UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(23)) / DownSize}, (UpSize * (int32_t)(34)) / DownSize, { -5629, -5952, 39 }, 20773, 12, 12 },
+				{ {(UpSize * (int32_t)(55)) / DownSize , (UpSize * (int32_t)(-43)) / DownSize , (UpSize * (int32_t)(21)) / DownSize}, (UpSize * (int32_t)(65)) / DownSize, { 1752, -7082, -3726 }, 23789, 24, 64 },
+				{ {(UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(-43)) / DownSize , (UpSize * (int32_t)(21)) / DownSize}, (UpSize * (int32_t)(65)) / DownSize, { -1752, -7082, -3726 }, 23789, 88, 64 },
+				{ {(UpSize * (int32_t)(2)) / DownSize , (UpSize * (int32_t)(-54)) / DownSize , (UpSize * (int32_t)(2)) / DownSize}, (UpSize * (int32_t)(72)) / DownSize, { -2830, -7643, 829 }, 24667, 152, 40 },
+				{ {(UpSize * (int32_t)(-28)) / DownSize , (UpSize * (int32_t)(-52)) / DownSize , (UpSize * (int32_t)(26)) / DownSize}, (UpSize * (int32_t)(32)) / DownSize, { 3489, -7389, 588 }, 22691, 192, 19 },
+				{ {(UpSize * (int32_t)(48)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(49)) / DownSize}, (UpSize * (int32_t)(32)) / DownSize, { 1345, -4546, 6681 }, 13980, 211, 6 },
+				{ {(UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(49)) / DownSize}, (UpSize * (int32_t)(32)) / DownSize, { -1590, -5051, 6251 }, 16271, 217, 7 },
+				{ {(UpSize * (int32_t)(58)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(24)) / DownSize}, (UpSize * (int32_t)(14)) / DownSize, { 7016, 4227, -121 }, 12154, 224, 4 },
+				{ {(UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(24)) / DownSize}, (UpSize * (int32_t)(14)) / DownSize, { -7016, 4227, -121 }, 12154, 228, 4 },
+				{ {(UpSize * (int32_t)(46)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(37)) / DownSize}, (UpSize * (int32_t)(14)) / DownSize, { -925, 4263, 6934 }, 10915, 232, 4 },
+				{ {(UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(37)) / DownSize}, (UpSize * (int32_t)(14)) / DownSize, { 925, 4263, 6934 }, 10915, 236, 4 },
+				{ {(UpSize * (int32_t)(32)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(24)) / DownSize}, (UpSize * (int32_t)(14)) / DownSize, { -7134, 4026, -114 }, 12311, 240, 4 },
+				{ {(UpSize * (int32_t)(-32)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(24)) / DownSize}, (UpSize * (int32_t)(14)) / DownSize, { 7134, 4026, -114 }, 12311, 244, 4 },
+				{ {(UpSize * (int32_t)(46)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(10)) / DownSize}, (UpSize * (int32_t)(14)) / DownSize, { -935, 4280, -6922 }, 11272, 248, 4 },
+				{ {(UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(10)) / DownSize}, (UpSize * (int32_t)(14)) / DownSize, { 935, 4280, -6922 }, 11272, 252, 4 },
+				{ {(UpSize * (int32_t)(48)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(20)) / DownSize}, (UpSize * (int32_t)(29)) / DownSize, { 2782, -7429, 2046 }, 21223, 256, 20 },
+				{ {(UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(20)) / DownSize}, (UpSize * (int32_t)(29)) / DownSize, { -2782, -7429, 2046 }, 21223, 276, 20 },
+				{ {(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-42)) / DownSize , (UpSize * (int32_t)(-86)) / DownSize}, (UpSize * (int32_t)(63)) / DownSize, { 0, -7940, -2017 }, 24624, 296, 60 },
+				{ {(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize , (UpSize * (int32_t)(-130)) / DownSize}, (UpSize * (int32_t)(46)) / DownSize, { 0, -239, -8189 }, 16649, 356, 12 },
+				{ {(UpSize * (int32_t)(30)) / DownSize , (UpSize * (int32_t)(-24)) / DownSize , (UpSize * (int32_t)(-73)) / DownSize}, (UpSize * (int32_t)(69)) / DownSize, { 7838, -1370, 1950 }, 18608, 368, 28 },
+				{ {(UpSize * (int32_t)(-29)) / DownSize , (UpSize * (int32_t)(-22)) / DownSize , (UpSize * (int32_t)(-73)) / DownSize}, (UpSize * (int32_t)(70)) / DownSize, { -8002, -980, 1453 }, 22319, 396, 28 },
+				{ {(UpSize * (int32_t)(65)) / DownSize , (UpSize * (int32_t)(-52)) / DownSize , (UpSize * (int32_t)(67)) / DownSize}, (UpSize * (int32_t)(53)) / DownSize, { 3085, -5392, 5340 }, 14110, 424, 7 },
+				{ {(UpSize * (int32_t)(-65)) / DownSize , (UpSize * (int32_t)(-52)) / DownSize , (UpSize * (int32_t)(67)) / DownSize}, (UpSize * (int32_t)(53)) / DownSize, { -3085, -5392, 5340 }, 14110, 431, 7 },
+				{ {(UpSize * (int32_t)(13)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(60)) / DownSize}, (UpSize * (int32_t)(28)) / DownSize, { -5459, -4924, 3614 }, 6417, 438, 4 },
+				{ {(UpSize * (int32_t)(-13)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(60)) / DownSize}, (UpSize * (int32_t)(28)) / DownSize, { 5459, -4924, 3614 }, 6417, 442, 4 },
+				{ {(UpSize * (int32_t)(13)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(54)) / DownSize}, (UpSize * (int32_t)(23)) / DownSize, { 4519, -5042, -4612 }, 7066, 446, 2 },
+				{ {(UpSize * (int32_t)(-13)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(54)) / DownSize}, (UpSize * (int32_t)(23)) / DownSize, { -4519, -5042, -4612 }, 7066, 448, 2 },
+				{ {(UpSize * (int32_t)(34)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(-8)) / DownSize}, (UpSize * (int32_t)(25)) / DownSize, { 3510, -7300, 1224 }, 131, 450, 1 },
+				{ {(UpSize * (int32_t)(8)) / DownSize , (UpSize * (int32_t)(-60)) / DownSize , (UpSize * (int32_t)(-44)) / DownSize}, (UpSize * (int32_t)(13)) / DownSize, { 4274, -3347, -6136 }, 19305, 451, 8 },
+				{ {(UpSize * (int32_t)(-8)) / DownSize , (UpSize * (int32_t)(-60)) / DownSize , (UpSize * (int32_t)(-44)) / DownSize}, (UpSize * (int32_t)(13)) / DownSize, { -4313, -1326, -6838 }, 14483, 459, 4 },
+				{ {(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize}, (UpSize * (int32_t)(16)) / DownSize, { 0, 3438, 7436 }, 3601, 463, 4 },
+				{ {(UpSize * (int32_t)(3)) / DownSize , (UpSize * (int32_t)(-61)) / DownSize , (UpSize * (int32_t)(-29)) / DownSize}, (UpSize * (int32_t)(9)) / DownSize, { -6421, -1047, 4978 }, 8061, 467, 2 },
+				{ {(UpSize * (int32_t)(-8)) / DownSize , (UpSize * (int32_t)(-60)) / DownSize , (UpSize * (int32_t)(-18)) / DownSize}, (UpSize * (int32_t)(21)) / DownSize, { 6117, -4252, 3407 }, 19488, 469, 5 },
+				{ {(UpSize * (int32_t)(10)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize}, (UpSize * (int32_t)(7)) / DownSize, { 906, -4910, 6495 }, 1414, 474, 2 },
+				{ {(UpSize * (int32_t)(-2)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(-30)) / DownSize}, (UpSize * (int32_t)(24)) / DownSize, { 1511, -5329, -6036 }, 13898, 476, 4 },
+				{ {(UpSize * (int32_t)(17)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(-30)) / DownSize}, (UpSize * (int32_t)(14)) / DownSize, { -4730, -4730, -4730 }, 128, 480, 1 },
+				{ {(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-49)) / DownSize , (UpSize * (int32_t)(-104)) / DownSize}, (UpSize * (int32_t)(17)) / DownSize, { 0, -1911, -7966 }, 13747, 481, 6 },
+				{ {(UpSize * (int32_t)(3)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(-116)) / DownSize}, (UpSize * (int32_t)(12)) / DownSize, { -2017, -2018, 7679 }, 17918, 487, 6 },
+				{ {(UpSize * (int32_t)(-9)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(-116)) / DownSize}, (UpSize * (int32_t)(8)) / DownSize, { 5631, -1175, 5833 }, 2777, 493, 2 },
+				{ {(UpSize * (int32_t)(12)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(-108)) / DownSize}, (UpSize * (int32_t)(9)) / DownSize, { -VERTEX16_UNIT, 0, 0 }, 128, 495, 2 },
+				{ {(UpSize * (int32_t)(-12)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(-108)) / DownSize}, (UpSize * (int32_t)(9)) / DownSize, { VERTEX16_UNIT, 0, 0 }, 128, 497, 2 },
+				{ {(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-43)) / DownSize , (UpSize * (int32_t)(-111)) / DownSize}, (UpSize * (int32_t)(16)) / DownSize, { 0, -7778, -2572 }, 4743, 499, 6 },
+				{ {(UpSize * (int32_t)(73)) / DownSize , (UpSize * (int32_t)(-47)) / DownSize , (UpSize * (int32_t)(23)) / DownSize}, (UpSize * (int32_t)(8)) / DownSize, { -3598, -7353, -313 }, 130, 505, 1 },
+				{ {(UpSize * (int32_t)(-73)) / DownSize , (UpSize * (int32_t)(-47)) / DownSize , (UpSize * (int32_t)(23)) / DownSize}, (UpSize * (int32_t)(8)) / DownSize, { 3598, -7353, -313 }, 130, 506, 1 },
+				{ {(UpSize * (int32_t)(40)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize , (UpSize * (int32_t)(66)) / DownSize}, (UpSize * (int32_t)(55)) / DownSize, { -3773, 2887, 6674 }, 19971, 507, 8 },
+				{ {(UpSize * (int32_t)(-40)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize , (UpSize * (int32_t)(66)) / DownSize}, (UpSize * (int32_t)(55)) / DownSize, { 3773, 2887, 6674 }, 19971, 515, 8 },
+				{ {(UpSize * (int32_t)(76)) / DownSize , (UpSize * (int32_t)(-10)) / DownSize , (UpSize * (int32_t)(56)) / DownSize}, (UpSize * (int32_t)(67)) / DownSize, { 3510, 2052, 7112 }, 7079, 523, 10 },
+				{ {(UpSize * (int32_t)(-76)) / DownSize , (UpSize * (int32_t)(-10)) / DownSize , (UpSize * (int32_t)(56)) / DownSize}, (UpSize * (int32_t)(67)) / DownSize, { -3510, 2052, 7112 }, 7079, 533, 10 },
+				{ {(UpSize * (int32_t)(104)) / DownSize , (UpSize * (int32_t)(-22)) / DownSize , (UpSize * (int32_t)(29)) / DownSize}, (UpSize * (int32_t)(25)) / DownSize, { 6974, 4141, 1154 }, 3807, 543, 2 },
+				{ {(UpSize * (int32_t)(-104)) / DownSize , (UpSize * (int32_t)(-22)) / DownSize , (UpSize * (int32_t)(29)) / DownSize}, (UpSize * (int32_t)(25)) / DownSize, { -6974, 4141, 1154 }, 3807, 545, 2 },
+				{ {(UpSize * (int32_t)(88)) / DownSize , (UpSize * (int32_t)(47)) / DownSize , (UpSize * (int32_t)(-16)) / DownSize}, (UpSize * (int32_t)(121)) / DownSize, { 5246, -296, -6285 }, 25272, 547, 64 },
+				{ {(UpSize * (int32_t)(-88)) / DownSize , (UpSize * (int32_t)(47)) / DownSize , (UpSize * (int32_t)(-16)) / DownSize}, (UpSize * (int32_t)(121)) / DownSize, { -5160, -233, -6358 }, 24969, 611, 62 },
+				{ {(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-6)) / DownSize , (UpSize * (int32_t)(-93)) / DownSize}, (UpSize * (int32_t)(55)) / DownSize, { 0, 8063, -1450 }, 16396, 673, 20 },
+				{ {(UpSize * (int32_t)(44)) / DownSize , (UpSize * (int32_t)(-20)) / DownSize , (UpSize * (int32_t)(-126)) / DownSize}, (UpSize * (int32_t)(11)) / DownSize, { 6677, 1151, -4605 }, 130, 693, 1 },
+				{ {(UpSize * (int32_t)(-44)) / DownSize , (UpSize * (int32_t)(-20)) / DownSize , (UpSize * (int32_t)(-126)) / DownSize}, (UpSize * (int32_t)(11)) / DownSize, { -6677, 1151, -4605 }, 130, 694, 1 },
+				{ {(UpSize * (int32_t)(55)) / DownSize , (UpSize * (int32_t)(116)) / DownSize , (UpSize * (int32_t)(23)) / DownSize}, (UpSize * (int32_t)(81)) / DownSize, { 4345, 6765, -1571 }, 15342, 695, 14 },
+				{ {(UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(116)) / DownSize , (UpSize * (int32_t)(23)) / DownSize}, (UpSize * (int32_t)(81)) / DownSize, { -4345, 6765, -1571 }, 15342, 709, 14 },
+				{ {(UpSize * (int32_t)(22)) / DownSize , (UpSize * (int32_t)(36)) / DownSize , (UpSize * (int32_t)(81)) / DownSize}, (UpSize * (int32_t)(100)) / DownSize, { 3263, -1996, 7244 }, 21636, 723, 23 },
+				{ {(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(119)) / DownSize , (UpSize * (int32_t)(78)) / DownSize}, (UpSize * (int32_t)(86)) / DownSize, { 0, 6394, 5121 }, 12970, 746, 6 },
+				{ {(UpSize * (int32_t)(-84)) / DownSize , (UpSize * (int32_t)(41)) / DownSize , (UpSize * (int32_t)(66)) / DownSize}, (UpSize * (int32_t)(71)) / DownSize, { -6756, -1108, 4498 }, 27369, 752, 19 },
+				{ {(UpSize * (int32_t)(-22)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize , (UpSize * (int32_t)(76)) / DownSize}, (UpSize * (int32_t)(51)) / DownSize, { -1275, -7281, 3530 }, 13266, 771, 5 },
+				{ {(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-35)) / DownSize , (UpSize * (int32_t)(66)) / DownSize}, (UpSize * (int32_t)(64)) / DownSize, { 0, 8143, 895 }, 6092, 776, 4 },
+				{ {(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(46)) / DownSize , (UpSize * (int32_t)(46)) / DownSize}, (UpSize * (int32_t)(55)) / DownSize, { 8071, 24, 1401 }, 13962, 780, 7 },
+				{ {(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-20)) / DownSize , (UpSize * (int32_t)(-32)) / DownSize}, (UpSize * (int32_t)(59)) / DownSize, { 0, -7053, -4167 }, 10305, 787, 4 },
+				{ {(UpSize * (int32_t)(124)) / DownSize , (UpSize * (int32_t)(76)) / DownSize , (UpSize * (int32_t)(16)) / DownSize}, (UpSize * (int32_t)(66)) / DownSize, { 2905, -7625, 727 }, 19291, 791, 22 },
+				{ {(UpSize * (int32_t)(-124)) / DownSize , (UpSize * (int32_t)(76)) / DownSize , (UpSize * (int32_t)(16)) / DownSize}, (UpSize * (int32_t)(66)) / DownSize, { -3084, -7566, 593 }, 19511, 813, 23 },
+				{ {(UpSize * (int32_t)(124)) / DownSize , (UpSize * (int32_t)(80)) / DownSize , (UpSize * (int32_t)(-6)) / DownSize}, (UpSize * (int32_t)(41)) / DownSize, { -893, -2313, 7808 }, 18984, 836, 11 },
+				{ {(UpSize * (int32_t)(-124)) / DownSize , (UpSize * (int32_t)(80)) / DownSize , (UpSize * (int32_t)(-6)) / DownSize}, (UpSize * (int32_t)(41)) / DownSize, { 893, -2313, 7808 }, 18984, 847, 11 },
+				{ {(UpSize * (int32_t)(156)) / DownSize , (UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(25)) / DownSize}, (UpSize * (int32_t)(25)) / DownSize, { -5968, -5585, -543 }, 13951, 858, 4 },
+				{ {(UpSize * (int32_t)(-156)) / DownSize , (UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(25)) / DownSize}, (UpSize * (int32_t)(25)) / DownSize, { 5968, -5585, -543 }, 13951, 862, 4 },
+				{ {(UpSize * (int32_t)(93)) / DownSize , (UpSize * (int32_t)(48)) / DownSize , (UpSize * (int32_t)(-8)) / DownSize}, (UpSize * (int32_t)(20)) / DownSize, { 8169, 576, -229 }, 459, 866, 2 },
+				{ {(UpSize * (int32_t)(-93)) / DownSize , (UpSize * (int32_t)(48)) / DownSize , (UpSize * (int32_t)(-8)) / DownSize}, (UpSize * (int32_t)(20)) / DownSize, { -8169, 576, -229 }, 459, 868, 2 },
+				{ {(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(78)) / DownSize , (UpSize * (int32_t)(3)) / DownSize}, (UpSize * (int32_t)(7)) / DownSize, { 1505, 424, 8042 }, 3725, 870, 2 },
+				{ {(UpSize * (int32_t)(-102)) / DownSize , (UpSize * (int32_t)(78)) / DownSize , (UpSize * (int32_t)(3)) / DownSize}, (UpSize * (int32_t)(7)) / DownSize, { -1505, 424, 8042 }, 3725, 872, 2 },
+				{ {(UpSize * (int32_t)(107)) / DownSize , (UpSize * (int32_t)(78)) / DownSize , (UpSize * (int32_t)(-2)) / DownSize}, (UpSize * (int32_t)(8)) / DownSize, { 7660, -1038, 2712 }, 1276, 874, 2 },
+				{ {(UpSize * (int32_t)(-107)) / DownSize , (UpSize * (int32_t)(78)) / DownSize , (UpSize * (int32_t)(-2)) / DownSize}, (UpSize * (int32_t)(8)) / DownSize, { -7660, -1038, 2712 }, 1276, 876, 2 },
+				{ {(UpSize * (int32_t)(156)) / DownSize , (UpSize * (int32_t)(100)) / DownSize , (UpSize * (int32_t)(30)) / DownSize}, (UpSize * (int32_t)(12)) / DownSize, { -6826, 1793, -4160 }, 3407, 878, 2 },
+				{ {(UpSize * (int32_t)(-156)) / DownSize , (UpSize * (int32_t)(100)) / DownSize , (UpSize * (int32_t)(30)) / DownSize}, (UpSize * (int32_t)(12)) / DownSize, { 6826, 1793, -4160 }, 3407, 880, 2 },
+				{ {(UpSize * (int32_t)(147)) / DownSize , (UpSize * (int32_t)(95)) / DownSize , (UpSize * (int32_t)(8)) / DownSize}, (UpSize * (int32_t)(24)) / DownSize, { -6400, 4172, 2957 }, 8948, 882, 3 },
+				{ {(UpSize * (int32_t)(-147)) / DownSize , (UpSize * (int32_t)(95)) / DownSize , (UpSize * (int32_t)(8)) / DownSize}, (UpSize * (int32_t)(24)) / DownSize, { 6400, 4172, 2957 }, 8948, 885, 3 },
+				{ {(UpSize * (int32_t)(130)) / DownSize , (UpSize * (int32_t)(88)) / DownSize , (UpSize * (int32_t)(13)) / DownSize}, (UpSize * (int32_t)(37)) / DownSize, { 2826, -7685, 235 }, 18762, 888, 25 },
+				{ {(UpSize * (int32_t)(-130)) / DownSize , (UpSize * (int32_t)(88)) / DownSize , (UpSize * (int32_t)(13)) / DownSize}, (UpSize * (int32_t)(37)) / DownSize, { -2826, -7685, 235 }, 18762, 913, 25 },
+				{ {(UpSize * (int32_t)(148)) / DownSize , (UpSize * (int32_t)(96)) / DownSize , (UpSize * (int32_t)(20)) / DownSize}, (UpSize * (int32_t)(17)) / DownSize, { 3367, -2790, -6927 }, 130, 938, 1 },
+				{ {(UpSize * (int32_t)(-148)) / DownSize , (UpSize * (int32_t)(96)) / DownSize , (UpSize * (int32_t)(20)) / DownSize}, (UpSize * (int32_t)(17)) / DownSize, { -3367, -2790, -6927 }, 130, 939, 1 },
+				{ {(UpSize * (int32_t)(166)) / DownSize , (UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(44)) / DownSize}, (UpSize * (int32_t)(19)) / DownSize, { 6890, 234, 4425 }, 1473, 940, 2 },
+				{ {(UpSize * (int32_t)(-166)) / DownSize , (UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(44)) / DownSize}, (UpSize * (int32_t)(19)) / DownSize, { -6890, 234, 4425 }, 1473, 942, 2 },
+				{ {(UpSize * (int32_t)(130)) / DownSize , (UpSize * (int32_t)(88)) / DownSize , (UpSize * (int32_t)(42)) / DownSize}, (UpSize * (int32_t)(40)) / DownSize, { -4241, 1057, 6928 }, 14992, 944, 6 },
+				{ {(UpSize * (int32_t)(-130)) / DownSize , (UpSize * (int32_t)(88)) / DownSize , (UpSize * (int32_t)(42)) / DownSize}, (UpSize * (int32_t)(40)) / DownSize, { 4241, 1057, 6928 }, 14992, 950, 6 },
+				{ {(UpSize * (int32_t)(134)) / DownSize , (UpSize * (int32_t)(96)) / DownSize , (UpSize * (int32_t)(14)) / DownSize}, (UpSize * (int32_t)(54)) / DownSize, { -3069, 7593, -184 }, 7891, 956, 4 },
+				{ {(UpSize * (int32_t)(-134)) / DownSize , (UpSize * (int32_t)(96)) / DownSize , (UpSize * (int32_t)(14)) / DownSize}, (UpSize * (int32_t)(54)) / DownSize, { 3069, 7593, -184 }, 7891, 960, 4 },
+				{ {(UpSize * (int32_t)(168)) / DownSize , (UpSize * (int32_t)(107)) / DownSize , (UpSize * (int32_t)(26)) / DownSize}, (UpSize * (int32_t)(29)) / DownSize, { 3315, 7488, 218 }, 130, 964, 1 },
+				{ {(UpSize * (int32_t)(-168)) / DownSize , (UpSize * (int32_t)(107)) / DownSize , (UpSize * (int32_t)(26)) / DownSize}, (UpSize * (int32_t)(29)) / DownSize, { -3315, 7488, 218 }, 130, 965, 1 },
+				{ {(UpSize * (int32_t)(88)) / DownSize , (UpSize * (int32_t)(78)) / DownSize , (UpSize * (int32_t)(-16)) / DownSize}, (UpSize * (int32_t)(24)) / DownSize, { -2952, 3515, -6785 }, 131, 966, 1 },
+				{ {(UpSize * (int32_t)(-88)) / DownSize , (UpSize * (int32_t)(78)) / DownSize , (UpSize * (int32_t)(-16)) / DownSize}, (UpSize * (int32_t)(24)) / DownSize, { 2952, 3515, -6785 }, 131, 967, 1 },
+			};
+
+			constexpr auto MeshletCount = sizeof(Meshlets) / sizeof(meshlet_t);
+
+			static constexpr vertex16_t VerticesLod1[] PROGMEM
+			{
+				{(UpSize * (int32_t)(64)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(4)) / DownSize},
+				{(UpSize * (int32_t)(72)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(23)) / DownSize},
+				{(UpSize * (int32_t)(58)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(18)) / DownSize},
+				{(UpSize * (int32_t)(51)) / DownSize , (UpSize * (int32_t)(-60)) / DownSize , (UpSize * (int32_t)(37)) / DownSize},
+				{(UpSize * (int32_t)(64)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(42)) / DownSize},
+				{(UpSize * (int32_t)(45)) / DownSize , (UpSize * (int32_t)(-52)) / DownSize , (UpSize * (int32_t)(-4)) / DownSize},
+				{(UpSize * (int32_t)(42)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(9)) / DownSize},
+				{(UpSize * (int32_t)(45)) / DownSize , (UpSize * (int32_t)(-52)) / DownSize , (UpSize * (int32_t)(50)) / DownSize},
+				{(UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(18)) / DownSize},
+				{(UpSize * (int32_t)(-72)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(23)) / DownSize},
+				{(UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(4)) / DownSize},
+				{(UpSize * (int32_t)(-51)) / DownSize , (UpSize * (int32_t)(-60)) / DownSize , (UpSize * (int32_t)(37)) / DownSize},
+				{(UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(42)) / DownSize},
+				{(UpSize * (int32_t)(-45)) / DownSize , (UpSize * (int32_t)(-52)) / DownSize , (UpSize * (int32_t)(-4)) / DownSize},
+				{(UpSize * (int32_t)(-42)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(9)) / DownSize},
+				{(UpSize * (int32_t)(-45)) / DownSize , (UpSize * (int32_t)(-52)) / DownSize , (UpSize * (int32_t)(50)) / DownSize},
+				{(UpSize * (int32_t)(26)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(4)) / DownSize},
+				{(UpSize * (int32_t)(51)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize},
+				{(UpSize * (int32_t)(48)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(0)) / DownSize},
+				{(UpSize * (int32_t)(33)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(18)) / DownSize},
+				{(UpSize * (int32_t)(26)) / DownSize , (UpSize * (int32_t)(-32)) / DownSize , (UpSize * (int32_t)(-32)) / DownSize},
+				{(UpSize * (int32_t)(56)) / DownSize , (UpSize * (int32_t)(-28)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize},
+				{(UpSize * (int32_t)(79)) / DownSize , (UpSize * (int32_t)(-40)) / DownSize , (UpSize * (int32_t)(-1)) / DownSize},
+				{(UpSize * (int32_t)(16)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(-21)) / DownSize},
+				{(UpSize * (int32_t)(81)) / DownSize , (UpSize * (int32_t)(-29)) / DownSize , (UpSize * (int32_t)(-13)) / DownSize},
+				{(UpSize * (int32_t)(74)) / DownSize , (UpSize * (int32_t)(-47)) / DownSize , (UpSize * (int32_t)(17)) / DownSize},
+				{(UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(42)) / DownSize},
+				{(UpSize * (int32_t)(106)) / DownSize , (UpSize * (int32_t)(-17)) / DownSize , (UpSize * (int32_t)(11)) / DownSize},
+				{(UpSize * (int32_t)(80)) / DownSize , (UpSize * (int32_t)(-44)) / DownSize , (UpSize * (int32_t)(35)) / DownSize},
+				{(UpSize * (int32_t)(40)) / DownSize , (UpSize * (int32_t)(-67)) / DownSize , (UpSize * (int32_t)(74)) / DownSize},
+				{(UpSize * (int32_t)(37)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(52)) / DownSize},
+				{(UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(-36)) / DownSize , (UpSize * (int32_t)(47)) / DownSize},
+				{(UpSize * (int32_t)(21)) / DownSize , (UpSize * (int32_t)(-59)) / DownSize , (UpSize * (int32_t)(45)) / DownSize},
+				{(UpSize * (int32_t)(26)) / DownSize , (UpSize * (int32_t)(-69)) / DownSize , (UpSize * (int32_t)(71)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-65)) / DownSize , (UpSize * (int32_t)(37)) / DownSize},
+				{(UpSize * (int32_t)(20)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(20)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-53)) / DownSize , (UpSize * (int32_t)(-2)) / DownSize},
+				{(UpSize * (int32_t)(18)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(23)) / DownSize},
+				{(UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(0)) / DownSize},
+				{(UpSize * (int32_t)(-51)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize},
+				{(UpSize * (int32_t)(-26)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(4)) / DownSize},
+				{(UpSize * (int32_t)(-33)) / DownSize , (UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(18)) / DownSize},
+				{(UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(-28)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize},
+				{(UpSize * (int32_t)(-26)) / DownSize , (UpSize * (int32_t)(-32)) / DownSize , (UpSize * (int32_t)(-32)) / DownSize},
+				{(UpSize * (int32_t)(-79)) / DownSize , (UpSize * (int32_t)(-40)) / DownSize , (UpSize * (int32_t)(-1)) / DownSize},
+				{(UpSize * (int32_t)(-16)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(-21)) / DownSize},
+				{(UpSize * (int32_t)(-81)) / DownSize , (UpSize * (int32_t)(-29)) / DownSize , (UpSize * (int32_t)(-13)) / DownSize},
+				{(UpSize * (int32_t)(-74)) / DownSize , (UpSize * (int32_t)(-47)) / DownSize , (UpSize * (int32_t)(17)) / DownSize},
+				{(UpSize * (int32_t)(-92)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(42)) / DownSize},
+				{(UpSize * (int32_t)(-106)) / DownSize , (UpSize * (int32_t)(-17)) / DownSize , (UpSize * (int32_t)(11)) / DownSize},
+				{(UpSize * (int32_t)(-80)) / DownSize , (UpSize * (int32_t)(-44)) / DownSize , (UpSize * (int32_t)(35)) / DownSize},
+				{(UpSize * (int32_t)(-40)) / DownSize , (UpSize * (int32_t)(-67)) / DownSize , (UpSize * (int32_t)(74)) / DownSize},
+				{(UpSize * (int32_t)(-37)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(52)) / DownSize},
+				{(UpSize * (int32_t)(-110)) / DownSize , (UpSize * (int32_t)(-36)) / DownSize , (UpSize * (int32_t)(47)) / DownSize},
+				{(UpSize * (int32_t)(-26)) / DownSize , (UpSize * (int32_t)(-69)) / DownSize , (UpSize * (int32_t)(71)) / DownSize},
+				{(UpSize * (int32_t)(-21)) / DownSize , (UpSize * (int32_t)(-59)) / DownSize , (UpSize * (int32_t)(45)) / DownSize},
+				{(UpSize * (int32_t)(-20)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(20)) / DownSize},
+				{(UpSize * (int32_t)(-18)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(23)) / DownSize},
+				{(UpSize * (int32_t)(26)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(42)) / DownSize},
+				{(UpSize * (int32_t)(32)) / DownSize , (UpSize * (int32_t)(-65)) / DownSize , (UpSize * (int32_t)(29)) / DownSize},
+				{(UpSize * (int32_t)(-3)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize},
+				{(UpSize * (int32_t)(48)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(45)) / DownSize},
+				{(UpSize * (int32_t)(-16)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(-37)) / DownSize},
+				{(UpSize * (int32_t)(3)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(-30)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize},
+				{(UpSize * (int32_t)(16)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(-37)) / DownSize},
+				{(UpSize * (int32_t)(-26)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(42)) / DownSize},
+				{(UpSize * (int32_t)(-32)) / DownSize , (UpSize * (int32_t)(-65)) / DownSize , (UpSize * (int32_t)(29)) / DownSize},
+				{(UpSize * (int32_t)(45)) / DownSize , (UpSize * (int32_t)(-66)) / DownSize , (UpSize * (int32_t)(23)) / DownSize},
+				{(UpSize * (int32_t)(-45)) / DownSize , (UpSize * (int32_t)(-66)) / DownSize , (UpSize * (int32_t)(23)) / DownSize},
+				{(UpSize * (int32_t)(42)) / DownSize , (UpSize * (int32_t)(-27)) / DownSize , (UpSize * (int32_t)(-129)) / DownSize},
+				{(UpSize * (int32_t)(30)) / DownSize , (UpSize * (int32_t)(-41)) / DownSize , (UpSize * (int32_t)(-125)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-34)) / DownSize , (UpSize * (int32_t)(-134)) / DownSize},
+				{(UpSize * (int32_t)(10)) / DownSize , (UpSize * (int32_t)(-50)) / DownSize , (UpSize * (int32_t)(-117)) / DownSize},
+				{(UpSize * (int32_t)(-10)) / DownSize , (UpSize * (int32_t)(-50)) / DownSize , (UpSize * (int32_t)(-117)) / DownSize},
+				{(UpSize * (int32_t)(-30)) / DownSize , (UpSize * (int32_t)(-41)) / DownSize , (UpSize * (int32_t)(-125)) / DownSize},
+				{(UpSize * (int32_t)(-42)) / DownSize , (UpSize * (int32_t)(-27)) / DownSize , (UpSize * (int32_t)(-129)) / DownSize},
+				{(UpSize * (int32_t)(33)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(-106)) / DownSize},
+				{(UpSize * (int32_t)(14)) / DownSize , (UpSize * (int32_t)(-54)) / DownSize , (UpSize * (int32_t)(-100)) / DownSize},
+				{(UpSize * (int32_t)(-7)) / DownSize , (UpSize * (int32_t)(-54)) / DownSize , (UpSize * (int32_t)(-103)) / DownSize},
+				{(UpSize * (int32_t)(-33)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(-106)) / DownSize},
+				{(UpSize * (int32_t)(-14)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(-41)) / DownSize},
+				{(UpSize * (int32_t)(22)) / DownSize , (UpSize * (int32_t)(-51)) / DownSize , (UpSize * (int32_t)(-44)) / DownSize},
+				{(UpSize * (int32_t)(-22)) / DownSize , (UpSize * (int32_t)(-51)) / DownSize , (UpSize * (int32_t)(-44)) / DownSize},
+				{(UpSize * (int32_t)(14)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(-41)) / DownSize},
+				{(UpSize * (int32_t)(47)) / DownSize , (UpSize * (int32_t)(-28)) / DownSize , (UpSize * (int32_t)(-122)) / DownSize},
+				{(UpSize * (int32_t)(-47)) / DownSize , (UpSize * (int32_t)(-28)) / DownSize , (UpSize * (int32_t)(-122)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-19)) / DownSize , (UpSize * (int32_t)(-133)) / DownSize},
+				{(UpSize * (int32_t)(42)) / DownSize , (UpSize * (int32_t)(-11)) / DownSize , (UpSize * (int32_t)(-125)) / DownSize},
+				{(UpSize * (int32_t)(-21)) / DownSize , (UpSize * (int32_t)(-16)) / DownSize , (UpSize * (int32_t)(-129)) / DownSize},
+				{(UpSize * (int32_t)(-42)) / DownSize , (UpSize * (int32_t)(-11)) / DownSize , (UpSize * (int32_t)(-125)) / DownSize},
+				{(UpSize * (int32_t)(40)) / DownSize , (UpSize * (int32_t)(-33)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize},
+				{(UpSize * (int32_t)(28)) / DownSize , (UpSize * (int32_t)(-15)) / DownSize , (UpSize * (int32_t)(-44)) / DownSize},
+				{(UpSize * (int32_t)(30)) / DownSize , (UpSize * (int32_t)(-12)) / DownSize , (UpSize * (int32_t)(-53)) / DownSize},
+				{(UpSize * (int32_t)(23)) / DownSize , (UpSize * (int32_t)(7)) / DownSize , (UpSize * (int32_t)(-61)) / DownSize},
+				{(UpSize * (int32_t)(37)) / DownSize , (UpSize * (int32_t)(-9)) / DownSize , (UpSize * (int32_t)(-99)) / DownSize},
+				{(UpSize * (int32_t)(-40)) / DownSize , (UpSize * (int32_t)(-33)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize},
+				{(UpSize * (int32_t)(-28)) / DownSize , (UpSize * (int32_t)(-15)) / DownSize , (UpSize * (int32_t)(-44)) / DownSize},
+				{(UpSize * (int32_t)(-30)) / DownSize , (UpSize * (int32_t)(-12)) / DownSize , (UpSize * (int32_t)(-53)) / DownSize},
+				{(UpSize * (int32_t)(-23)) / DownSize , (UpSize * (int32_t)(7)) / DownSize , (UpSize * (int32_t)(-61)) / DownSize},
+				{(UpSize * (int32_t)(-37)) / DownSize , (UpSize * (int32_t)(-9)) / DownSize , (UpSize * (int32_t)(-99)) / DownSize},
+				{(UpSize * (int32_t)(-16)) / DownSize , (UpSize * (int32_t)(-6)) / DownSize , (UpSize * (int32_t)(-77)) / DownSize},
+				{(UpSize * (int32_t)(63)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(69)) / DownSize},
+				{(UpSize * (int32_t)(41)) / DownSize , (UpSize * (int32_t)(-54)) / DownSize , (UpSize * (int32_t)(89)) / DownSize},
+				{(UpSize * (int32_t)(20)) / DownSize , (UpSize * (int32_t)(-57)) / DownSize , (UpSize * (int32_t)(84)) / DownSize},
+				{(UpSize * (int32_t)(-63)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize , (UpSize * (int32_t)(69)) / DownSize},
+				{(UpSize * (int32_t)(-41)) / DownSize , (UpSize * (int32_t)(-54)) / DownSize , (UpSize * (int32_t)(89)) / DownSize},
+				{(UpSize * (int32_t)(-20)) / DownSize , (UpSize * (int32_t)(-57)) / DownSize , (UpSize * (int32_t)(84)) / DownSize},
+				{(UpSize * (int32_t)(4)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(51)) / DownSize},
+				{(UpSize * (int32_t)(13)) / DownSize , (UpSize * (int32_t)(-68)) / DownSize , (UpSize * (int32_t)(47)) / DownSize},
+				{(UpSize * (int32_t)(-13)) / DownSize , (UpSize * (int32_t)(-68)) / DownSize , (UpSize * (int32_t)(47)) / DownSize},
+				{(UpSize * (int32_t)(-8)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(55)) / DownSize},
+				{(UpSize * (int32_t)(8)) / DownSize , (UpSize * (int32_t)(-43)) / DownSize , (UpSize * (int32_t)(-110)) / DownSize},
+				{(UpSize * (int32_t)(-10)) / DownSize , (UpSize * (int32_t)(-43)) / DownSize , (UpSize * (int32_t)(-109)) / DownSize},
+				{(UpSize * (int32_t)(14)) / DownSize , (UpSize * (int32_t)(-38)) / DownSize , (UpSize * (int32_t)(51)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-37)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(25)) / DownSize , (UpSize * (int32_t)(-39)) / DownSize , (UpSize * (int32_t)(77)) / DownSize},
+				{(UpSize * (int32_t)(43)) / DownSize , (UpSize * (int32_t)(-36)) / DownSize , (UpSize * (int32_t)(80)) / DownSize},
+				{(UpSize * (int32_t)(62)) / DownSize , (UpSize * (int32_t)(-31)) / DownSize , (UpSize * (int32_t)(63)) / DownSize},
+				{(UpSize * (int32_t)(59)) / DownSize , (UpSize * (int32_t)(-15)) / DownSize , (UpSize * (int32_t)(59)) / DownSize},
+				{(UpSize * (int32_t)(81)) / DownSize , (UpSize * (int32_t)(4)) / DownSize , (UpSize * (int32_t)(50)) / DownSize},
+				{(UpSize * (int32_t)(-14)) / DownSize , (UpSize * (int32_t)(-38)) / DownSize , (UpSize * (int32_t)(51)) / DownSize},
+				{(UpSize * (int32_t)(-25)) / DownSize , (UpSize * (int32_t)(-39)) / DownSize , (UpSize * (int32_t)(77)) / DownSize},
+				{(UpSize * (int32_t)(-43)) / DownSize , (UpSize * (int32_t)(-36)) / DownSize , (UpSize * (int32_t)(80)) / DownSize},
+				{(UpSize * (int32_t)(-59)) / DownSize , (UpSize * (int32_t)(-15)) / DownSize , (UpSize * (int32_t)(59)) / DownSize},
+				{(UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(-31)) / DownSize , (UpSize * (int32_t)(63)) / DownSize},
+				{(UpSize * (int32_t)(-81)) / DownSize , (UpSize * (int32_t)(4)) / DownSize , (UpSize * (int32_t)(50)) / DownSize},
+				{(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(-19)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(93)) / DownSize , (UpSize * (int32_t)(-3)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(109)) / DownSize , (UpSize * (int32_t)(33)) / DownSize , (UpSize * (int32_t)(22)) / DownSize},
+				{(UpSize * (int32_t)(-102)) / DownSize , (UpSize * (int32_t)(-19)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(-93)) / DownSize , (UpSize * (int32_t)(-3)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(-109)) / DownSize , (UpSize * (int32_t)(33)) / DownSize , (UpSize * (int32_t)(22)) / DownSize},
+				{(UpSize * (int32_t)(99)) / DownSize , (UpSize * (int32_t)(-8)) / DownSize , (UpSize * (int32_t)(13)) / DownSize},
+				{(UpSize * (int32_t)(-99)) / DownSize , (UpSize * (int32_t)(-8)) / DownSize , (UpSize * (int32_t)(13)) / DownSize},
+				{(UpSize * (int32_t)(77)) / DownSize , (UpSize * (int32_t)(-13)) / DownSize , (UpSize * (int32_t)(-8)) / DownSize},
+				{(UpSize * (int32_t)(56)) / DownSize , (UpSize * (int32_t)(-20)) / DownSize , (UpSize * (int32_t)(-20)) / DownSize},
+				{(UpSize * (int32_t)(52)) / DownSize , (UpSize * (int32_t)(21)) / DownSize , (UpSize * (int32_t)(-30)) / DownSize},
+				{(UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(31)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize},
+				{(UpSize * (int32_t)(55)) / DownSize , (UpSize * (int32_t)(67)) / DownSize , (UpSize * (int32_t)(-33)) / DownSize},
+				{(UpSize * (int32_t)(76)) / DownSize , (UpSize * (int32_t)(61)) / DownSize , (UpSize * (int32_t)(-24)) / DownSize},
+				{(UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(63)) / DownSize , (UpSize * (int32_t)(-7)) / DownSize},
+				{(UpSize * (int32_t)(38)) / DownSize , (UpSize * (int32_t)(74)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize},
+				{(UpSize * (int32_t)(16)) / DownSize , (UpSize * (int32_t)(-6)) / DownSize , (UpSize * (int32_t)(-77)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(4)) / DownSize , (UpSize * (int32_t)(-70)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(85)) / DownSize , (UpSize * (int32_t)(-57)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-1)) / DownSize , (UpSize * (int32_t)(-81)) / DownSize},
+				{(UpSize * (int32_t)(62)) / DownSize , (UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(-5)) / DownSize},
+				{(UpSize * (int32_t)(101)) / DownSize , (UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(-24)) / DownSize},
+				{(UpSize * (int32_t)(99)) / DownSize , (UpSize * (int32_t)(56)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize},
+				{(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(80)) / DownSize , (UpSize * (int32_t)(3)) / DownSize},
+				{(UpSize * (int32_t)(112)) / DownSize , (UpSize * (int32_t)(79)) / DownSize , (UpSize * (int32_t)(20)) / DownSize},
+				{(UpSize * (int32_t)(44)) / DownSize , (UpSize * (int32_t)(109)) / DownSize , (UpSize * (int32_t)(-27)) / DownSize},
+				{(UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(46)) / DownSize , (UpSize * (int32_t)(33)) / DownSize},
+				{(UpSize * (int32_t)(106)) / DownSize , (UpSize * (int32_t)(66)) / DownSize , (UpSize * (int32_t)(32)) / DownSize},
+				{(UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(95)) / DownSize , (UpSize * (int32_t)(-9)) / DownSize},
+				{(UpSize * (int32_t)(133)) / DownSize , (UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(-21)) / DownSize},
+				{(UpSize * (int32_t)(133)) / DownSize , (UpSize * (int32_t)(103)) / DownSize , (UpSize * (int32_t)(-19)) / DownSize},
+				{(UpSize * (int32_t)(164)) / DownSize , (UpSize * (int32_t)(95)) / DownSize , (UpSize * (int32_t)(-1)) / DownSize},
+				{(UpSize * (int32_t)(133)) / DownSize , (UpSize * (int32_t)(93)) / DownSize , (UpSize * (int32_t)(34)) / DownSize},
+				{(UpSize * (int32_t)(124)) / DownSize , (UpSize * (int32_t)(72)) / DownSize , (UpSize * (int32_t)(42)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(126)) / DownSize , (UpSize * (int32_t)(-33)) / DownSize},
+				{(UpSize * (int32_t)(168)) / DownSize , (UpSize * (int32_t)(108)) / DownSize , (UpSize * (int32_t)(-1)) / DownSize},
+				{(UpSize * (int32_t)(151)) / DownSize , (UpSize * (int32_t)(99)) / DownSize , (UpSize * (int32_t)(37)) / DownSize},
+				{(UpSize * (int32_t)(157)) / DownSize , (UpSize * (int32_t)(91)) / DownSize , (UpSize * (int32_t)(38)) / DownSize},
+				{(UpSize * (int32_t)(173)) / DownSize , (UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(33)) / DownSize},
+				{(UpSize * (int32_t)(175)) / DownSize , (UpSize * (int32_t)(104)) / DownSize , (UpSize * (int32_t)(30)) / DownSize},
+				{(UpSize * (int32_t)(-77)) / DownSize , (UpSize * (int32_t)(-13)) / DownSize , (UpSize * (int32_t)(-8)) / DownSize},
+				{(UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(-20)) / DownSize , (UpSize * (int32_t)(-20)) / DownSize},
+				{(UpSize * (int32_t)(-52)) / DownSize , (UpSize * (int32_t)(21)) / DownSize , (UpSize * (int32_t)(-30)) / DownSize},
+				{(UpSize * (int32_t)(-94)) / DownSize , (UpSize * (int32_t)(31)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize},
+				{(UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(67)) / DownSize , (UpSize * (int32_t)(-33)) / DownSize},
+				{(UpSize * (int32_t)(-76)) / DownSize , (UpSize * (int32_t)(61)) / DownSize , (UpSize * (int32_t)(-24)) / DownSize},
+				{(UpSize * (int32_t)(-92)) / DownSize , (UpSize * (int32_t)(63)) / DownSize , (UpSize * (int32_t)(-7)) / DownSize},
+				{(UpSize * (int32_t)(-38)) / DownSize , (UpSize * (int32_t)(74)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize},
+				{(UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(-5)) / DownSize},
+				{(UpSize * (int32_t)(-99)) / DownSize , (UpSize * (int32_t)(56)) / DownSize , (UpSize * (int32_t)(-26)) / DownSize},
+				{(UpSize * (int32_t)(-101)) / DownSize , (UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(-24)) / DownSize},
+				{(UpSize * (int32_t)(-112)) / DownSize , (UpSize * (int32_t)(79)) / DownSize , (UpSize * (int32_t)(20)) / DownSize},
+				{(UpSize * (int32_t)(-102)) / DownSize , (UpSize * (int32_t)(80)) / DownSize , (UpSize * (int32_t)(3)) / DownSize},
+				{(UpSize * (int32_t)(-44)) / DownSize , (UpSize * (int32_t)(109)) / DownSize , (UpSize * (int32_t)(-27)) / DownSize},
+				{(UpSize * (int32_t)(-82)) / DownSize , (UpSize * (int32_t)(95)) / DownSize , (UpSize * (int32_t)(-9)) / DownSize},
+				{(UpSize * (int32_t)(-110)) / DownSize , (UpSize * (int32_t)(46)) / DownSize , (UpSize * (int32_t)(33)) / DownSize},
+				{(UpSize * (int32_t)(-106)) / DownSize , (UpSize * (int32_t)(66)) / DownSize , (UpSize * (int32_t)(32)) / DownSize},
+				{(UpSize * (int32_t)(-133)) / DownSize , (UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(-21)) / DownSize},
+				{(UpSize * (int32_t)(-133)) / DownSize , (UpSize * (int32_t)(103)) / DownSize , (UpSize * (int32_t)(-19)) / DownSize},
+				{(UpSize * (int32_t)(-164)) / DownSize , (UpSize * (int32_t)(95)) / DownSize , (UpSize * (int32_t)(-1)) / DownSize},
+				{(UpSize * (int32_t)(-124)) / DownSize , (UpSize * (int32_t)(72)) / DownSize , (UpSize * (int32_t)(42)) / DownSize},
+				{(UpSize * (int32_t)(-133)) / DownSize , (UpSize * (int32_t)(93)) / DownSize , (UpSize * (int32_t)(34)) / DownSize},
+				{(UpSize * (int32_t)(-168)) / DownSize , (UpSize * (int32_t)(108)) / DownSize , (UpSize * (int32_t)(-1)) / DownSize},
+				{(UpSize * (int32_t)(-151)) / DownSize , (UpSize * (int32_t)(99)) / DownSize , (UpSize * (int32_t)(37)) / DownSize},
+				{(UpSize * (int32_t)(-157)) / DownSize , (UpSize * (int32_t)(91)) / DownSize , (UpSize * (int32_t)(38)) / DownSize},
+				{(UpSize * (int32_t)(-173)) / DownSize , (UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(33)) / DownSize},
+				{(UpSize * (int32_t)(-175)) / DownSize , (UpSize * (int32_t)(104)) / DownSize , (UpSize * (int32_t)(30)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-4)) / DownSize , (UpSize * (int32_t)(-111)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(146)) / DownSize , (UpSize * (int32_t)(1)) / DownSize},
+				{(UpSize * (int32_t)(43)) / DownSize , (UpSize * (int32_t)(125)) / DownSize , (UpSize * (int32_t)(-1)) / DownSize},
+				{(UpSize * (int32_t)(59)) / DownSize , (UpSize * (int32_t)(130)) / DownSize , (UpSize * (int32_t)(48)) / DownSize},
+				{(UpSize * (int32_t)(79)) / DownSize , (UpSize * (int32_t)(115)) / DownSize , (UpSize * (int32_t)(34)) / DownSize},
+				{(UpSize * (int32_t)(99)) / DownSize , (UpSize * (int32_t)(96)) / DownSize , (UpSize * (int32_t)(26)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(149)) / DownSize , (UpSize * (int32_t)(64)) / DownSize},
+				{(UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(89)) / DownSize , (UpSize * (int32_t)(41)) / DownSize},
+				{(UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(97)) / DownSize , (UpSize * (int32_t)(79)) / DownSize},
+				{(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(86)) / DownSize , (UpSize * (int32_t)(61)) / DownSize},
+				{(UpSize * (int32_t)(-43)) / DownSize , (UpSize * (int32_t)(125)) / DownSize , (UpSize * (int32_t)(-1)) / DownSize},
+				{(UpSize * (int32_t)(-59)) / DownSize , (UpSize * (int32_t)(130)) / DownSize , (UpSize * (int32_t)(48)) / DownSize},
+				{(UpSize * (int32_t)(-79)) / DownSize , (UpSize * (int32_t)(115)) / DownSize , (UpSize * (int32_t)(34)) / DownSize},
+				{(UpSize * (int32_t)(-99)) / DownSize , (UpSize * (int32_t)(96)) / DownSize , (UpSize * (int32_t)(26)) / DownSize},
+				{(UpSize * (int32_t)(-110)) / DownSize , (UpSize * (int32_t)(89)) / DownSize , (UpSize * (int32_t)(41)) / DownSize},
+				{(UpSize * (int32_t)(-82)) / DownSize , (UpSize * (int32_t)(97)) / DownSize , (UpSize * (int32_t)(79)) / DownSize},
+				{(UpSize * (int32_t)(-102)) / DownSize , (UpSize * (int32_t)(86)) / DownSize , (UpSize * (int32_t)(61)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(3)) / DownSize , (UpSize * (int32_t)(107)) / DownSize},
+				{(UpSize * (int32_t)(58)) / DownSize , (UpSize * (int32_t)(10)) / DownSize , (UpSize * (int32_t)(101)) / DownSize},
+				{(UpSize * (int32_t)(58)) / DownSize , (UpSize * (int32_t)(49)) / DownSize , (UpSize * (int32_t)(111)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(50)) / DownSize , (UpSize * (int32_t)(118)) / DownSize},
+				{(UpSize * (int32_t)(58)) / DownSize , (UpSize * (int32_t)(89)) / DownSize , (UpSize * (int32_t)(103)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(107)) / DownSize},
+				{(UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(49)) / DownSize , (UpSize * (int32_t)(111)) / DownSize},
+				{(UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(89)) / DownSize , (UpSize * (int32_t)(103)) / DownSize},
+				{(UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(10)) / DownSize , (UpSize * (int32_t)(101)) / DownSize},
+				{(UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(65)) / DownSize , (UpSize * (int32_t)(88)) / DownSize},
+				{(UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(33)) / DownSize , (UpSize * (int32_t)(82)) / DownSize},
+				{(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(55)) / DownSize , (UpSize * (int32_t)(71)) / DownSize},
+				{(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(24)) / DownSize , (UpSize * (int32_t)(64)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-33)) / DownSize , (UpSize * (int32_t)(65)) / DownSize},
+				{(UpSize * (int32_t)(-102)) / DownSize , (UpSize * (int32_t)(24)) / DownSize , (UpSize * (int32_t)(64)) / DownSize},
+				{(UpSize * (int32_t)(-82)) / DownSize , (UpSize * (int32_t)(33)) / DownSize , (UpSize * (int32_t)(82)) / DownSize},
+				{(UpSize * (int32_t)(-102)) / DownSize , (UpSize * (int32_t)(55)) / DownSize , (UpSize * (int32_t)(71)) / DownSize},
+				{(UpSize * (int32_t)(-82)) / DownSize , (UpSize * (int32_t)(65)) / DownSize , (UpSize * (int32_t)(88)) / DownSize},
+				{(UpSize * (int32_t)(131)) / DownSize , (UpSize * (int32_t)(80)) / DownSize , (UpSize * (int32_t)(53)) / DownSize},
+				{(UpSize * (int32_t)(114)) / DownSize , (UpSize * (int32_t)(70)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(158)) / DownSize , (UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(57)) / DownSize},
+				{(UpSize * (int32_t)(155)) / DownSize , (UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(2)) / DownSize},
+				{(UpSize * (int32_t)(132)) / DownSize , (UpSize * (int32_t)(79)) / DownSize , (UpSize * (int32_t)(-13)) / DownSize},
+				{(UpSize * (int32_t)(106)) / DownSize , (UpSize * (int32_t)(57)) / DownSize , (UpSize * (int32_t)(-17)) / DownSize},
+				{(UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(74)) / DownSize , (UpSize * (int32_t)(-9)) / DownSize},
+				{(UpSize * (int32_t)(-114)) / DownSize , (UpSize * (int32_t)(70)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(-131)) / DownSize , (UpSize * (int32_t)(80)) / DownSize , (UpSize * (int32_t)(53)) / DownSize},
+				{(UpSize * (int32_t)(-158)) / DownSize , (UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(57)) / DownSize},
+				{(UpSize * (int32_t)(-155)) / DownSize , (UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(2)) / DownSize},
+				{(UpSize * (int32_t)(-132)) / DownSize , (UpSize * (int32_t)(79)) / DownSize , (UpSize * (int32_t)(-13)) / DownSize},
+				{(UpSize * (int32_t)(-106)) / DownSize , (UpSize * (int32_t)(57)) / DownSize , (UpSize * (int32_t)(-17)) / DownSize},
+				{(UpSize * (int32_t)(-110)) / DownSize , (UpSize * (int32_t)(74)) / DownSize , (UpSize * (int32_t)(-9)) / DownSize},
+				{(UpSize * (int32_t)(134)) / DownSize , (UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(-8)) / DownSize},
+				{(UpSize * (int32_t)(154)) / DownSize , (UpSize * (int32_t)(100)) / DownSize , (UpSize * (int32_t)(4)) / DownSize},
+				{(UpSize * (int32_t)(-134)) / DownSize , (UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(-8)) / DownSize},
+				{(UpSize * (int32_t)(-154)) / DownSize , (UpSize * (int32_t)(100)) / DownSize , (UpSize * (int32_t)(4)) / DownSize},
+				{(UpSize * (int32_t)(160)) / DownSize , (UpSize * (int32_t)(100)) / DownSize , (UpSize * (int32_t)(24)) / DownSize},
+				{(UpSize * (int32_t)(-160)) / DownSize , (UpSize * (int32_t)(100)) / DownSize , (UpSize * (int32_t)(24)) / DownSize},
+				{(UpSize * (int32_t)(120)) / DownSize , (UpSize * (int32_t)(83)) / DownSize , (UpSize * (int32_t)(0)) / DownSize},
+				{(UpSize * (int32_t)(138)) / DownSize , (UpSize * (int32_t)(90)) / DownSize , (UpSize * (int32_t)(20)) / DownSize},
+				{(UpSize * (int32_t)(-120)) / DownSize , (UpSize * (int32_t)(83)) / DownSize , (UpSize * (int32_t)(0)) / DownSize},
+				{(UpSize * (int32_t)(-138)) / DownSize , (UpSize * (int32_t)(90)) / DownSize , (UpSize * (int32_t)(20)) / DownSize},
+				{(UpSize * (int32_t)(160)) / DownSize , (UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(52)) / DownSize},
+				{(UpSize * (int32_t)(-160)) / DownSize , (UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(52)) / DownSize},
+				{(UpSize * (int32_t)(131)) / DownSize , (UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(48)) / DownSize},
+				{(UpSize * (int32_t)(-131)) / DownSize , (UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(48)) / DownSize},
+			};
+
+			constexpr auto VertexCountLod1 = sizeof(VerticesLod1) / sizeof(vertex16_t);
+
+			static constexpr triangle_face_t TrianglesLod1[] PROGMEM
+			{
+				{ 0, 1, 2 },
+				{ 3, 2, 1 },
+				{ 1, 4, 3 },
+				{ 5, 0, 2 },
+				{ 2, 6, 5 },
+				{ 4, 7, 3 },
+				{ 8, 9, 10 },
+				{ 9, 8, 11 },
+				{ 11, 12, 9 },
+				{ 8, 10, 13 },
+				{ 13, 14, 8 },
+				{ 11, 15, 12 },
+				{ 16, 17, 18 },
+				{ 16, 5, 6 },
+				{ 6, 19, 16 },
+				{ 20, 21, 17 },
+				{ 22, 17, 21 },
+				{ 17, 23, 20 },
+				{ 21, 24, 22 },
+				{ 25, 18, 17 },
+				{ 22, 25, 17 },
+				{ 25, 22, 26 },
+				{ 24, 27, 22 },
+				{ 26, 28, 25 },
+				{ 28, 26, 29 },
+				{ 29, 30, 28 },
+				{ 27, 31, 26 },
+				{ 26, 22, 27 },
+				{ 32, 30, 33 },
+				{ 29, 33, 30 },
+				{ 34, 35, 32 },
+				{ 35, 34, 36 },
+				{ 36, 16, 35 },
+				{ 37, 16, 19 },
+				{ 38, 39, 40 },
+				{ 14, 13, 40 },
+				{ 40, 41, 14 },
+				{ 39, 42, 43 },
+				{ 42, 39, 44 },
+				{ 43, 45, 39 },
+				{ 44, 46, 42 },
+				{ 39, 38, 47 },
+				{ 39, 47, 44 },
+				{ 48, 44, 47 },
+				{ 44, 49, 46 },
+				{ 47, 50, 48 },
+				{ 51, 48, 50 },
+				{ 50, 52, 51 },
+				{ 48, 53, 49 },
+				{ 49, 44, 48 },
+				{ 54, 52, 55 },
+				{ 52, 54, 51 },
+				{ 55, 56, 34 },
+				{ 36, 34, 56 },
+				{ 56, 40, 36 },
+				{ 41, 40, 57 },
+				{ 58, 37, 19 },
+				{ 19, 59, 58 },
+				{ 7, 58, 59 },
+				{ 59, 3, 7 },
+				{ 36, 23, 16 },
+				{ 23, 36, 60 },
+				{ 32, 61, 30 },
+				{ 40, 45, 36 },
+				{ 39, 45, 40 },
+				{ 60, 62, 63 },
+				{ 62, 60, 45 },
+				{ 62, 64, 63 },
+				{ 63, 64, 65 },
+				{ 41, 57, 66 },
+				{ 66, 67, 41 },
+				{ 67, 66, 15 },
+				{ 15, 11, 67 },
+				{ 28, 30, 61 },
+				{ 6, 59, 19 },
+				{ 41, 67, 14 },
+				{ 68, 2, 3 },
+				{ 6, 2, 68 },
+				{ 68, 3, 59 },
+				{ 68, 59, 6 },
+				{ 11, 8, 69 },
+				{ 69, 8, 14 },
+				{ 67, 11, 69 },
+				{ 14, 67, 69 },
+				{ 70, 71, 72 },
+				{ 72, 71, 73 },
+				{ 72, 73, 74 },
+				{ 74, 75, 72 },
+				{ 72, 75, 76 },
+				{ 71, 77, 78 },
+				{ 79, 80, 75 },
+				{ 78, 73, 71 },
+				{ 75, 74, 79 },
+				{ 78, 81, 79 },
+				{ 78, 77, 82 },
+				{ 83, 80, 79 },
+				{ 79, 81, 83 },
+				{ 84, 78, 82 },
+				{ 84, 64, 78 },
+				{ 78, 64, 81 },
+				{ 85, 77, 71 },
+				{ 75, 80, 86 },
+				{ 71, 70, 85 },
+				{ 86, 76, 75 },
+				{ 87, 88, 70 },
+				{ 70, 72, 87 },
+				{ 87, 72, 76 },
+				{ 76, 89, 87 },
+				{ 76, 90, 89 },
+				{ 77, 85, 91 },
+				{ 91, 82, 77 },
+				{ 91, 20, 82 },
+				{ 23, 84, 82 },
+				{ 20, 23, 82 },
+				{ 92, 20, 91 },
+				{ 91, 93, 92 },
+				{ 94, 92, 93 },
+				{ 65, 84, 23 },
+				{ 23, 63, 65 },
+				{ 91, 85, 93 },
+				{ 95, 93, 85 },
+				{ 88, 95, 85 },
+				{ 96, 86, 80 },
+				{ 80, 83, 96 },
+				{ 83, 43, 96 },
+				{ 83, 81, 45 },
+				{ 83, 45, 43 },
+				{ 96, 43, 97 },
+				{ 97, 98, 96 },
+				{ 98, 97, 99 },
+				{ 45, 81, 62 },
+				{ 98, 86, 96 },
+				{ 86, 98, 100 },
+				{ 98, 99, 101 },
+				{ 86, 100, 90 },
+				{ 29, 26, 31 },
+				{ 31, 102, 29 },
+				{ 102, 103, 29 },
+				{ 33, 29, 103 },
+				{ 103, 104, 33 },
+				{ 53, 48, 51 },
+				{ 51, 105, 53 },
+				{ 51, 106, 105 },
+				{ 106, 51, 54 },
+				{ 54, 107, 106 },
+				{ 104, 108, 109 },
+				{ 109, 33, 104 },
+				{ 34, 109, 108 },
+				{ 110, 111, 107 },
+				{ 107, 54, 110 },
+				{ 111, 110, 34 },
+				{ 34, 108, 111 },
+				{ 33, 109, 32 },
+				{ 32, 109, 34 },
+				{ 55, 110, 54 },
+				{ 34, 110, 55 },
+				{ 16, 23, 17 },
+				{ 64, 84, 65 },
+				{ 62, 81, 64 },
+				{ 60, 63, 23 },
+				{ 60, 36, 45 },
+				{ 78, 79, 112 },
+				{ 79, 113, 112 },
+				{ 73, 112, 113 },
+				{ 113, 74, 73 },
+				{ 73, 78, 112 },
+				{ 113, 79, 74 },
+				{ 114, 115, 108 },
+				{ 116, 114, 108 },
+				{ 108, 104, 116 },
+				{ 117, 116, 104 },
+				{ 104, 103, 117 },
+				{ 114, 118, 119 },
+				{ 120, 119, 118 },
+				{ 121, 111, 108 },
+				{ 108, 115, 121 },
+				{ 111, 121, 122 },
+				{ 122, 107, 111 },
+				{ 107, 122, 123 },
+				{ 123, 106, 107 },
+				{ 124, 125, 121 },
+				{ 125, 124, 126 },
+				{ 103, 102, 118 },
+				{ 118, 117, 103 },
+				{ 102, 31, 118 },
+				{ 127, 118, 31 },
+				{ 118, 127, 128 },
+				{ 128, 120, 118 },
+				{ 129, 128, 127 },
+				{ 125, 105, 106 },
+				{ 106, 123, 125 },
+				{ 125, 53, 105 },
+				{ 53, 125, 130 },
+				{ 131, 130, 125 },
+				{ 125, 126, 131 },
+				{ 130, 131, 132 },
+				{ 31, 27, 133 },
+				{ 133, 127, 31 },
+				{ 134, 49, 53 },
+				{ 53, 130, 134 },
+				{ 27, 24, 135 },
+				{ 135, 133, 27 },
+				{ 136, 135, 24 },
+				{ 24, 21, 136 },
+				{ 135, 136, 137 },
+				{ 136, 21, 20 },
+				{ 92, 137, 136 },
+				{ 137, 138, 135 },
+				{ 133, 135, 138 },
+				{ 138, 137, 139 },
+				{ 92, 94, 137 },
+				{ 139, 137, 94 },
+				{ 139, 140, 138 },
+				{ 138, 140, 141 },
+				{ 94, 142, 139 },
+				{ 143, 94, 93 },
+				{ 94, 144, 145 },
+				{ 145, 142, 94 },
+				{ 94, 143, 146 },
+				{ 140, 139, 147 },
+				{ 147, 139, 142 },
+				{ 129, 138, 141 },
+				{ 138, 129, 133 },
+				{ 148, 149, 140 },
+				{ 141, 150, 151 },
+				{ 142, 152, 147 },
+				{ 141, 153, 129 },
+				{ 141, 154, 153 },
+				{ 147, 155, 140 },
+				{ 156, 149, 148 },
+				{ 148, 157, 156 },
+				{ 158, 156, 157 },
+				{ 127, 133, 129 },
+				{ 151, 159, 160 },
+				{ 161, 152, 142 },
+				{ 157, 162, 158 },
+				{ 142, 145, 161 },
+				{ 160, 159, 163 },
+				{ 163, 164, 160 },
+				{ 165, 158, 162 },
+				{ 162, 166, 165 },
+				{ 151, 154, 141 },
+				{ 167, 46, 49 },
+				{ 49, 134, 167 },
+				{ 46, 167, 168 },
+				{ 168, 42, 46 },
+				{ 169, 168, 167 },
+				{ 43, 42, 168 },
+				{ 168, 169, 97 },
+				{ 167, 170, 169 },
+				{ 170, 167, 134 },
+				{ 171, 169, 170 },
+				{ 169, 99, 97 },
+				{ 99, 169, 171 },
+				{ 170, 172, 171 },
+				{ 173, 172, 170 },
+				{ 171, 174, 99 },
+				{ 145, 144, 99 },
+				{ 99, 174, 145 },
+				{ 146, 101, 99 },
+				{ 175, 171, 172 },
+				{ 174, 171, 175 },
+				{ 173, 170, 132 },
+				{ 172, 176, 177 },
+				{ 134, 132, 170 },
+				{ 178, 179, 173 },
+				{ 175, 180, 174 },
+				{ 172, 181, 175 },
+				{ 132, 182, 173 },
+				{ 182, 183, 173 },
+				{ 177, 176, 184 },
+				{ 184, 185, 177 },
+				{ 185, 184, 186 },
+				{ 174, 180, 161 },
+				{ 187, 188, 178 },
+				{ 132, 134, 130 },
+				{ 186, 189, 185 },
+				{ 190, 188, 187 },
+				{ 161, 145, 174 },
+				{ 187, 191, 190 },
+				{ 189, 186, 192 },
+				{ 192, 193, 189 },
+				{ 146, 144, 94 },
+				{ 99, 144, 146 },
+				{ 194, 146, 143 },
+				{ 101, 146, 194 },
+				{ 143, 95, 194 },
+				{ 194, 100, 101 },
+				{ 143, 93, 95 },
+				{ 87, 194, 95 },
+				{ 87, 89, 100 },
+				{ 100, 194, 87 },
+				{ 95, 88, 87 },
+				{ 100, 98, 101 },
+				{ 89, 90, 100 },
+				{ 85, 70, 88 },
+				{ 90, 76, 86 },
+				{ 195, 196, 152 },
+				{ 152, 161, 195 },
+				{ 196, 147, 152 },
+				{ 147, 196, 197 },
+				{ 197, 198, 147 },
+				{ 199, 155, 147 },
+				{ 147, 198, 199 },
+				{ 200, 197, 196 },
+				{ 196, 195, 200 },
+				{ 148, 155, 199 },
+				{ 199, 201, 148 },
+				{ 202, 198, 197 },
+				{ 199, 198, 202 },
+				{ 202, 203, 199 },
+				{ 180, 204, 195 },
+				{ 195, 161, 180 },
+				{ 180, 175, 204 },
+				{ 205, 204, 175 },
+				{ 175, 206, 205 },
+				{ 175, 181, 207 },
+				{ 207, 206, 175 },
+				{ 204, 205, 200 },
+				{ 200, 195, 204 },
+				{ 207, 181, 177 },
+				{ 177, 208, 207 },
+				{ 205, 206, 209 },
+				{ 209, 206, 207 },
+				{ 207, 210, 209 },
+				{ 211, 212, 213 },
+				{ 213, 214, 211 },
+				{ 214, 213, 215 },
+				{ 215, 216, 214 },
+				{ 211, 214, 217 },
+				{ 214, 216, 218 },
+				{ 218, 217, 214 },
+				{ 217, 219, 211 },
+				{ 215, 213, 220 },
+				{ 213, 212, 221 },
+				{ 221, 220, 213 },
+				{ 220, 202, 215 },
+				{ 222, 220, 221 },
+				{ 221, 223, 222 },
+				{ 203, 202, 220 },
+				{ 220, 222, 203 },
+				{ 120, 128, 223 },
+				{ 223, 221, 120 },
+				{ 212, 211, 224 },
+				{ 120, 221, 212 },
+				{ 212, 119, 120 },
+				{ 224, 119, 212 },
+				{ 119, 224, 114 },
+				{ 216, 215, 197 },
+				{ 197, 215, 202 },
+				{ 197, 200, 216 },
+				{ 216, 200, 205 },
+				{ 205, 218, 216 },
+				{ 209, 218, 205 },
+				{ 225, 131, 126 },
+				{ 126, 226, 225 },
+				{ 227, 225, 226 },
+				{ 219, 226, 126 },
+				{ 126, 124, 219 },
+				{ 226, 219, 217 },
+				{ 226, 228, 227 },
+				{ 217, 228, 226 },
+				{ 182, 225, 227 },
+				{ 132, 131, 225 },
+				{ 225, 182, 132 },
+				{ 210, 227, 228 },
+				{ 227, 183, 182 },
+				{ 228, 209, 210 },
+				{ 207, 183, 227 },
+				{ 228, 217, 218 },
+				{ 218, 209, 228 },
+				{ 227, 210, 207 },
+				{ 219, 124, 224 },
+				{ 121, 224, 124 },
+				{ 224, 211, 219 },
+				{ 115, 114, 224 },
+				{ 224, 121, 115 },
+				{ 114, 116, 117 },
+				{ 117, 118, 114 },
+				{ 123, 122, 121 },
+				{ 121, 125, 123 },
+				{ 129, 153, 223 },
+				{ 222, 223, 153 },
+				{ 153, 154, 222 },
+				{ 222, 154, 199 },
+				{ 199, 203, 222 },
+				{ 223, 128, 129 },
+				{ 136, 20, 92 },
+				{ 97, 43, 168 },
+				{ 229, 230, 160 },
+				{ 229, 160, 164 },
+				{ 164, 231, 229 },
+				{ 164, 165, 231 },
+				{ 165, 164, 232 },
+				{ 232, 158, 165 },
+				{ 158, 232, 233 },
+				{ 160, 230, 154 },
+				{ 160, 154, 151 },
+				{ 233, 156, 158 },
+				{ 156, 233, 234 },
+				{ 235, 234, 233 },
+				{ 234, 149, 156 },
+				{ 234, 141, 140 },
+				{ 150, 141, 235 },
+				{ 140, 149, 234 },
+				{ 187, 236, 237 },
+				{ 191, 187, 237 },
+				{ 237, 238, 191 },
+				{ 238, 192, 191 },
+				{ 239, 191, 192 },
+				{ 192, 186, 239 },
+				{ 240, 239, 186 },
+				{ 183, 236, 187 },
+				{ 178, 183, 187 },
+				{ 186, 184, 240 },
+				{ 241, 240, 184 },
+				{ 173, 183, 178 },
+				{ 240, 241, 242 },
+				{ 242, 173, 179 },
+				{ 184, 176, 241 },
+				{ 172, 173, 241 },
+				{ 241, 176, 172 },
+				{ 233, 243, 235 },
+				{ 235, 141, 234 },
+				{ 243, 233, 232 },
+				{ 232, 244, 243 },
+				{ 242, 245, 240 },
+				{ 241, 173, 242 },
+				{ 239, 240, 245 },
+				{ 245, 246, 239 },
+				{ 164, 247, 244 },
+				{ 244, 232, 164 },
+				{ 164, 163, 247 },
+				{ 246, 248, 191 },
+				{ 191, 239, 246 },
+				{ 248, 190, 191 },
+				{ 150, 235, 249 },
+				{ 150, 249, 151 },
+				{ 249, 250, 151 },
+				{ 243, 250, 249 },
+				{ 250, 243, 244 },
+				{ 159, 151, 250 },
+				{ 249, 235, 243 },
+				{ 250, 244, 247 },
+				{ 250, 247, 163 },
+				{ 159, 250, 163 },
+				{ 251, 242, 179 },
+				{ 178, 251, 179 },
+				{ 178, 252, 251 },
+				{ 251, 252, 245 },
+				{ 246, 245, 252 },
+				{ 252, 178, 188 },
+				{ 245, 242, 251 },
+				{ 248, 246, 252 },
+				{ 190, 248, 252 },
+				{ 190, 252, 188 },
+				{ 231, 165, 166 },
+				{ 166, 253, 231 },
+				{ 193, 192, 238 },
+				{ 238, 254, 193 },
+				{ 229, 231, 253 },
+				{ 253, 255, 229 },
+				{ 230, 229, 255 },
+				{ 255, 201, 230 },
+				{ 199, 154, 230 },
+				{ 230, 201, 199 },
+				{ 254, 238, 237 },
+				{ 237, 256, 254 },
+				{ 256, 237, 236 },
+				{ 236, 208, 256 },
+				{ 236, 183, 207 },
+				{ 207, 208, 236 },
+				{ 255, 157, 148 },
+				{ 148, 201, 255 },
+				{ 162, 157, 255 },
+				{ 255, 253, 162 },
+				{ 177, 185, 256 },
+				{ 256, 208, 177 },
+				{ 256, 185, 189 },
+				{ 189, 254, 256 },
+				{ 253, 166, 162 },
+				{ 189, 193, 254 },
+				{ 140, 155, 148 },
+				{ 177, 181, 172 },
+			};
+
+			constexpr auto TriangleCountLod1 = sizeof(TrianglesLod1) / sizeof(triangle_face_t);
+
+			static constexpr vertex16_t VerticesLod2[] PROGMEM
+			{
+				{(UpSize * (int32_t)(44)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(6)) / DownSize},
+				{(UpSize * (int32_t)(25)) / DownSize , (UpSize * (int32_t)(-59)) / DownSize , (UpSize * (int32_t)(23)) / DownSize},
+				{(UpSize * (int32_t)(26)) / DownSize , (UpSize * (int32_t)(-55)) / DownSize , (UpSize * (int32_t)(4)) / DownSize},
+				{(UpSize * (int32_t)(27)) / DownSize , (UpSize * (int32_t)(-24)) / DownSize , (UpSize * (int32_t)(-38)) / DownSize},
+				{(UpSize * (int32_t)(81)) / DownSize , (UpSize * (int32_t)(-29)) / DownSize , (UpSize * (int32_t)(-13)) / DownSize},
+				{(UpSize * (int32_t)(50)) / DownSize , (UpSize * (int32_t)(-50)) / DownSize , (UpSize * (int32_t)(-7)) / DownSize},
+				{(UpSize * (int32_t)(13)) / DownSize , (UpSize * (int32_t)(-64)) / DownSize , (UpSize * (int32_t)(-27)) / DownSize},
+				{(UpSize * (int32_t)(86)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(39)) / DownSize},
+				{(UpSize * (int32_t)(33)) / DownSize , (UpSize * (int32_t)(-68)) / DownSize , (UpSize * (int32_t)(72)) / DownSize},
+				{(UpSize * (int32_t)(37)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(52)) / DownSize},
+				{(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(-12)) / DownSize , (UpSize * (int32_t)(12)) / DownSize},
+				{(UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(-36)) / DownSize , (UpSize * (int32_t)(47)) / DownSize},
+				{(UpSize * (int32_t)(2)) / DownSize , (UpSize * (int32_t)(-60)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(-50)) / DownSize , (UpSize * (int32_t)(-50)) / DownSize , (UpSize * (int32_t)(-7)) / DownSize},
+				{(UpSize * (int32_t)(-81)) / DownSize , (UpSize * (int32_t)(-29)) / DownSize , (UpSize * (int32_t)(-13)) / DownSize},
+				{(UpSize * (int32_t)(-27)) / DownSize , (UpSize * (int32_t)(-24)) / DownSize , (UpSize * (int32_t)(-38)) / DownSize},
+				{(UpSize * (int32_t)(-9)) / DownSize , (UpSize * (int32_t)(-61)) / DownSize , (UpSize * (int32_t)(-23)) / DownSize},
+				{(UpSize * (int32_t)(-86)) / DownSize , (UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(39)) / DownSize},
+				{(UpSize * (int32_t)(-37)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(52)) / DownSize},
+				{(UpSize * (int32_t)(-33)) / DownSize , (UpSize * (int32_t)(-68)) / DownSize , (UpSize * (int32_t)(72)) / DownSize},
+				{(UpSize * (int32_t)(-110)) / DownSize , (UpSize * (int32_t)(-36)) / DownSize , (UpSize * (int32_t)(47)) / DownSize},
+				{(UpSize * (int32_t)(-102)) / DownSize , (UpSize * (int32_t)(-12)) / DownSize , (UpSize * (int32_t)(12)) / DownSize},
+				{(UpSize * (int32_t)(-26)) / DownSize , (UpSize * (int32_t)(-57)) / DownSize , (UpSize * (int32_t)(14)) / DownSize},
+				{(UpSize * (int32_t)(-18)) / DownSize , (UpSize * (int32_t)(-53)) / DownSize , (UpSize * (int32_t)(-42)) / DownSize},
+				{(UpSize * (int32_t)(61)) / DownSize , (UpSize * (int32_t)(-53)) / DownSize , (UpSize * (int32_t)(11)) / DownSize},
+				{(UpSize * (int32_t)(46)) / DownSize , (UpSize * (int32_t)(-54)) / DownSize , (UpSize * (int32_t)(43)) / DownSize},
+				{(UpSize * (int32_t)(-46)) / DownSize , (UpSize * (int32_t)(-54)) / DownSize , (UpSize * (int32_t)(43)) / DownSize},
+				{(UpSize * (int32_t)(-61)) / DownSize , (UpSize * (int32_t)(-53)) / DownSize , (UpSize * (int32_t)(11)) / DownSize},
+				{(UpSize * (int32_t)(-44)) / DownSize , (UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(6)) / DownSize},
+				{(UpSize * (int32_t)(36)) / DownSize , (UpSize * (int32_t)(-34)) / DownSize , (UpSize * (int32_t)(-127)) / DownSize},
+				{(UpSize * (int32_t)(24)) / DownSize , (UpSize * (int32_t)(-50)) / DownSize , (UpSize * (int32_t)(-103)) / DownSize},
+				{(UpSize * (int32_t)(-9)) / DownSize , (UpSize * (int32_t)(-52)) / DownSize , (UpSize * (int32_t)(-110)) / DownSize},
+				{(UpSize * (int32_t)(-36)) / DownSize , (UpSize * (int32_t)(-34)) / DownSize , (UpSize * (int32_t)(-127)) / DownSize},
+				{(UpSize * (int32_t)(44)) / DownSize , (UpSize * (int32_t)(-30)) / DownSize , (UpSize * (int32_t)(-93)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-19)) / DownSize , (UpSize * (int32_t)(-133)) / DownSize},
+				{(UpSize * (int32_t)(40)) / DownSize , (UpSize * (int32_t)(-10)) / DownSize , (UpSize * (int32_t)(-112)) / DownSize},
+				{(UpSize * (int32_t)(-42)) / DownSize , (UpSize * (int32_t)(-11)) / DownSize , (UpSize * (int32_t)(-125)) / DownSize},
+				{(UpSize * (int32_t)(-44)) / DownSize , (UpSize * (int32_t)(-30)) / DownSize , (UpSize * (int32_t)(-93)) / DownSize},
+				{(UpSize * (int32_t)(30)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(86)) / DownSize},
+				{(UpSize * (int32_t)(-30)) / DownSize , (UpSize * (int32_t)(-56)) / DownSize , (UpSize * (int32_t)(86)) / DownSize},
+				{(UpSize * (int32_t)(7)) / DownSize , (UpSize * (int32_t)(-36)) / DownSize , (UpSize * (int32_t)(58)) / DownSize},
+				{(UpSize * (int32_t)(-14)) / DownSize , (UpSize * (int32_t)(-38)) / DownSize , (UpSize * (int32_t)(51)) / DownSize},
+				{(UpSize * (int32_t)(34)) / DownSize , (UpSize * (int32_t)(-38)) / DownSize , (UpSize * (int32_t)(78)) / DownSize},
+				{(UpSize * (int32_t)(-34)) / DownSize , (UpSize * (int32_t)(-38)) / DownSize , (UpSize * (int32_t)(78)) / DownSize},
+				{(UpSize * (int32_t)(59)) / DownSize , (UpSize * (int32_t)(-15)) / DownSize , (UpSize * (int32_t)(59)) / DownSize},
+				{(UpSize * (int32_t)(98)) / DownSize , (UpSize * (int32_t)(-11)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(-59)) / DownSize , (UpSize * (int32_t)(-15)) / DownSize , (UpSize * (int32_t)(59)) / DownSize},
+				{(UpSize * (int32_t)(-98)) / DownSize , (UpSize * (int32_t)(-11)) / DownSize , (UpSize * (int32_t)(44)) / DownSize},
+				{(UpSize * (int32_t)(66)) / DownSize , (UpSize * (int32_t)(-16)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize},
+				{(UpSize * (int32_t)(94)) / DownSize , (UpSize * (int32_t)(31)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize},
+				{(UpSize * (int32_t)(66)) / DownSize , (UpSize * (int32_t)(64)) / DownSize , (UpSize * (int32_t)(-28)) / DownSize},
+				{(UpSize * (int32_t)(23)) / DownSize , (UpSize * (int32_t)(7)) / DownSize , (UpSize * (int32_t)(-61)) / DownSize},
+				{(UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(63)) / DownSize , (UpSize * (int32_t)(-7)) / DownSize},
+				{(UpSize * (int32_t)(38)) / DownSize , (UpSize * (int32_t)(74)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(-4)) / DownSize , (UpSize * (int32_t)(-111)) / DownSize},
+				{(UpSize * (int32_t)(-16)) / DownSize , (UpSize * (int32_t)(3)) / DownSize , (UpSize * (int32_t)(-67)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(85)) / DownSize , (UpSize * (int32_t)(-57)) / DownSize},
+				{(UpSize * (int32_t)(62)) / DownSize , (UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(-5)) / DownSize},
+				{(UpSize * (int32_t)(109)) / DownSize , (UpSize * (int32_t)(33)) / DownSize , (UpSize * (int32_t)(22)) / DownSize},
+				{(UpSize * (int32_t)(101)) / DownSize , (UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(-24)) / DownSize},
+				{(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(56)) / DownSize , (UpSize * (int32_t)(-22)) / DownSize},
+				{(UpSize * (int32_t)(44)) / DownSize , (UpSize * (int32_t)(117)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize},
+				{(UpSize * (int32_t)(114)) / DownSize , (UpSize * (int32_t)(71)) / DownSize , (UpSize * (int32_t)(40)) / DownSize},
+				{(UpSize * (int32_t)(146)) / DownSize , (UpSize * (int32_t)(93)) / DownSize , (UpSize * (int32_t)(-7)) / DownSize},
+				{(UpSize * (int32_t)(150)) / DownSize , (UpSize * (int32_t)(106)) / DownSize , (UpSize * (int32_t)(-10)) / DownSize},
+				{(UpSize * (int32_t)(107)) / DownSize , (UpSize * (int32_t)(79)) / DownSize , (UpSize * (int32_t)(11)) / DownSize},
+				{(UpSize * (int32_t)(159)) / DownSize , (UpSize * (int32_t)(97)) / DownSize , (UpSize * (int32_t)(40)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(126)) / DownSize , (UpSize * (int32_t)(-33)) / DownSize},
+				{(UpSize * (int32_t)(174)) / DownSize , (UpSize * (int32_t)(99)) / DownSize , (UpSize * (int32_t)(32)) / DownSize},
+				{(UpSize * (int32_t)(-66)) / DownSize , (UpSize * (int32_t)(-16)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize},
+				{(UpSize * (int32_t)(-94)) / DownSize , (UpSize * (int32_t)(31)) / DownSize , (UpSize * (int32_t)(-14)) / DownSize},
+				{(UpSize * (int32_t)(-66)) / DownSize , (UpSize * (int32_t)(64)) / DownSize , (UpSize * (int32_t)(-28)) / DownSize},
+				{(UpSize * (int32_t)(-92)) / DownSize , (UpSize * (int32_t)(63)) / DownSize , (UpSize * (int32_t)(-7)) / DownSize},
+				{(UpSize * (int32_t)(-38)) / DownSize , (UpSize * (int32_t)(74)) / DownSize , (UpSize * (int32_t)(-48)) / DownSize},
+				{(UpSize * (int32_t)(-62)) / DownSize , (UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(-5)) / DownSize},
+				{(UpSize * (int32_t)(-109)) / DownSize , (UpSize * (int32_t)(33)) / DownSize , (UpSize * (int32_t)(22)) / DownSize},
+				{(UpSize * (int32_t)(-102)) / DownSize , (UpSize * (int32_t)(56)) / DownSize , (UpSize * (int32_t)(-22)) / DownSize},
+				{(UpSize * (int32_t)(-101)) / DownSize , (UpSize * (int32_t)(82)) / DownSize , (UpSize * (int32_t)(-24)) / DownSize},
+				{(UpSize * (int32_t)(-114)) / DownSize , (UpSize * (int32_t)(71)) / DownSize , (UpSize * (int32_t)(40)) / DownSize},
+				{(UpSize * (int32_t)(-146)) / DownSize , (UpSize * (int32_t)(93)) / DownSize , (UpSize * (int32_t)(-7)) / DownSize},
+				{(UpSize * (int32_t)(-150)) / DownSize , (UpSize * (int32_t)(106)) / DownSize , (UpSize * (int32_t)(-10)) / DownSize},
+				{(UpSize * (int32_t)(-159)) / DownSize , (UpSize * (int32_t)(97)) / DownSize , (UpSize * (int32_t)(40)) / DownSize},
+				{(UpSize * (int32_t)(-107)) / DownSize , (UpSize * (int32_t)(79)) / DownSize , (UpSize * (int32_t)(11)) / DownSize},
+				{(UpSize * (int32_t)(-174)) / DownSize , (UpSize * (int32_t)(99)) / DownSize , (UpSize * (int32_t)(32)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(146)) / DownSize , (UpSize * (int32_t)(1)) / DownSize},
+				{(UpSize * (int32_t)(59)) / DownSize , (UpSize * (int32_t)(130)) / DownSize , (UpSize * (int32_t)(48)) / DownSize},
+				{(UpSize * (int32_t)(104)) / DownSize , (UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(34)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(149)) / DownSize , (UpSize * (int32_t)(64)) / DownSize},
+				{(UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(70)) / DownSize},
+				{(UpSize * (int32_t)(-59)) / DownSize , (UpSize * (int32_t)(130)) / DownSize , (UpSize * (int32_t)(48)) / DownSize},
+				{(UpSize * (int32_t)(-104)) / DownSize , (UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(34)) / DownSize},
+				{(UpSize * (int32_t)(-92)) / DownSize , (UpSize * (int32_t)(92)) / DownSize , (UpSize * (int32_t)(70)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(3)) / DownSize , (UpSize * (int32_t)(107)) / DownSize},
+				{(UpSize * (int32_t)(58)) / DownSize , (UpSize * (int32_t)(10)) / DownSize , (UpSize * (int32_t)(101)) / DownSize},
+				{(UpSize * (int32_t)(58)) / DownSize , (UpSize * (int32_t)(49)) / DownSize , (UpSize * (int32_t)(111)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(50)) / DownSize , (UpSize * (int32_t)(118)) / DownSize},
+				{(UpSize * (int32_t)(58)) / DownSize , (UpSize * (int32_t)(89)) / DownSize , (UpSize * (int32_t)(103)) / DownSize},
+				{(UpSize * (int32_t)(0)) / DownSize , (UpSize * (int32_t)(110)) / DownSize , (UpSize * (int32_t)(107)) / DownSize},
+				{(UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(49)) / DownSize , (UpSize * (int32_t)(111)) / DownSize},
+				{(UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(89)) / DownSize , (UpSize * (int32_t)(103)) / DownSize},
+				{(UpSize * (int32_t)(-58)) / DownSize , (UpSize * (int32_t)(10)) / DownSize , (UpSize * (int32_t)(101)) / DownSize},
+				{(UpSize * (int32_t)(102)) / DownSize , (UpSize * (int32_t)(40)) / DownSize , (UpSize * (int32_t)(68)) / DownSize},
+				{(UpSize * (int32_t)(-102)) / DownSize , (UpSize * (int32_t)(40)) / DownSize , (UpSize * (int32_t)(68)) / DownSize},
+				{(UpSize * (int32_t)(146)) / DownSize , (UpSize * (int32_t)(106)) / DownSize , (UpSize * (int32_t)(50)) / DownSize},
+				{(UpSize * (int32_t)(-146)) / DownSize , (UpSize * (int32_t)(106)) / DownSize , (UpSize * (int32_t)(50)) / DownSize},
+			};
+
+			constexpr auto VertexCountLod2 = sizeof(VerticesLod2) / sizeof(vertex16_t);
+
+			static constexpr triangle_face_t TrianglesLod2[] PROGMEM
+			{
+				{ 0, 1, 2 },
+				{ 3, 4, 5 },
+				{ 5, 6, 3 },
+				{ 4, 7, 5 },
+				{ 8, 9, 7 },
+				{ 10, 11, 7 },
+				{ 7, 4, 10 },
+				{ 12, 2, 9 },
+				{ 13, 14, 15 },
+				{ 15, 16, 13 },
+				{ 13, 17, 14 },
+				{ 17, 18, 19 },
+				{ 17, 20, 21 },
+				{ 21, 14, 17 },
+				{ 18, 22, 12 },
+				{ 2, 12, 22 },
+				{ 6, 2, 16 },
+				{ 22, 16, 2 },
+				{ 13, 16, 22 },
+				{ 16, 23, 6 },
+				{ 0, 24, 25 },
+				{ 0, 25, 1 },
+				{ 26, 27, 28 },
+				{ 22, 26, 28 },
+				{ 29, 30, 31 },
+				{ 31, 32, 29 },
+				{ 30, 23, 31 },
+				{ 23, 32, 31 },
+				{ 6, 23, 30 },
+				{ 33, 30, 29 },
+				{ 34, 35, 29 },
+				{ 34, 29, 32 },
+				{ 32, 36, 34 },
+				{ 33, 6, 30 },
+				{ 33, 3, 6 },
+				{ 35, 3, 33 },
+				{ 32, 23, 37 },
+				{ 23, 15, 37 },
+				{ 23, 16, 15 },
+				{ 37, 15, 36 },
+				{ 8, 7, 11 },
+				{ 11, 38, 8 },
+				{ 20, 17, 19 },
+				{ 19, 39, 20 },
+				{ 12, 8, 38 },
+				{ 39, 19, 12 },
+				{ 8, 12, 9 },
+				{ 12, 19, 18 },
+				{ 2, 6, 5 },
+				{ 40, 41, 12 },
+				{ 42, 40, 12 },
+				{ 12, 38, 42 },
+				{ 41, 39, 12 },
+				{ 39, 41, 43 },
+				{ 44, 42, 38 },
+				{ 38, 11, 44 },
+				{ 45, 44, 11 },
+				{ 39, 43, 46 },
+				{ 46, 20, 39 },
+				{ 20, 46, 47 },
+				{ 10, 45, 11 },
+				{ 20, 47, 21 },
+				{ 10, 4, 48 },
+				{ 48, 4, 3 },
+				{ 10, 48, 49 },
+				{ 49, 48, 50 },
+				{ 3, 51, 48 },
+				{ 50, 48, 51 },
+				{ 49, 50, 52 },
+				{ 51, 53, 50 },
+				{ 54, 51, 3 },
+				{ 51, 55, 56 },
+				{ 56, 53, 51 },
+				{ 51, 54, 55 },
+				{ 57, 50, 53 },
+				{ 58, 49, 52 },
+				{ 49, 58, 10 },
+				{ 59, 60, 50 },
+				{ 53, 61, 57 },
+				{ 52, 62, 58 },
+				{ 63, 60, 59 },
+				{ 59, 64, 63 },
+				{ 45, 10, 58 },
+				{ 65, 66, 62 },
+				{ 67, 61, 53 },
+				{ 53, 56, 67 },
+				{ 68, 63, 64 },
+				{ 65, 62, 52 },
+				{ 69, 14, 21 },
+				{ 15, 14, 69 },
+				{ 70, 69, 21 },
+				{ 71, 69, 70 },
+				{ 69, 55, 15 },
+				{ 55, 69, 71 },
+				{ 72, 71, 70 },
+				{ 71, 73, 55 },
+				{ 55, 73, 56 },
+				{ 73, 71, 74 },
+				{ 72, 70, 75 },
+				{ 71, 76, 77 },
+				{ 21, 75, 70 },
+				{ 75, 78, 72 },
+				{ 77, 76, 79 },
+				{ 79, 80, 77 },
+				{ 73, 74, 67 },
+				{ 78, 81, 82 },
+				{ 75, 21, 47 },
+				{ 67, 56, 73 },
+				{ 80, 79, 83 },
+				{ 54, 36, 55 },
+				{ 54, 3, 35 },
+				{ 34, 54, 35 },
+				{ 36, 54, 34 },
+				{ 36, 15, 55 },
+				{ 33, 29, 35 },
+				{ 36, 32, 37 },
+				{ 61, 67, 84 },
+				{ 57, 61, 85 },
+				{ 57, 85, 86 },
+				{ 87, 85, 61 },
+				{ 61, 84, 87 },
+				{ 59, 57, 86 },
+				{ 86, 85, 88 },
+				{ 84, 67, 74 },
+				{ 89, 84, 74 },
+				{ 90, 89, 74 },
+				{ 84, 89, 87 },
+				{ 90, 74, 77 },
+				{ 91, 89, 90 },
+				{ 92, 93, 94 },
+				{ 94, 95, 92 },
+				{ 95, 94, 96 },
+				{ 96, 97, 95 },
+				{ 92, 95, 98 },
+				{ 95, 97, 99 },
+				{ 99, 98, 95 },
+				{ 98, 100, 92 },
+				{ 96, 94, 101 },
+				{ 94, 93, 101 },
+				{ 101, 88, 96 },
+				{ 44, 45, 101 },
+				{ 93, 92, 40 },
+				{ 44, 101, 93 },
+				{ 40, 44, 93 },
+				{ 97, 96, 85 },
+				{ 85, 96, 88 },
+				{ 85, 87, 97 },
+				{ 97, 87, 89 },
+				{ 89, 99, 97 },
+				{ 91, 99, 89 },
+				{ 102, 47, 46 },
+				{ 100, 102, 46 },
+				{ 102, 100, 98 },
+				{ 75, 47, 102 },
+				{ 102, 78, 75 },
+				{ 90, 78, 102 },
+				{ 102, 98, 99 },
+				{ 99, 91, 102 },
+				{ 102, 91, 90 },
+				{ 100, 46, 40 },
+				{ 41, 40, 46 },
+				{ 40, 92, 100 },
+				{ 42, 44, 40 },
+				{ 41, 46, 43 },
+				{ 58, 62, 101 },
+				{ 101, 62, 86 },
+				{ 86, 88, 101 },
+				{ 101, 45, 58 },
+				{ 68, 66, 63 },
+				{ 52, 60, 63 },
+				{ 60, 52, 50 },
+				{ 79, 81, 83 },
+				{ 72, 78, 82 },
+				{ 79, 76, 72 },
+				{ 71, 72, 76 },
+				{ 65, 52, 63 },
+				{ 65, 63, 66 },
+				{ 79, 72, 82 },
+				{ 81, 79, 82 },
+				{ 68, 103, 66 },
+				{ 81, 104, 83 },
+				{ 62, 66, 103 },
+				{ 103, 86, 62 },
+				{ 104, 81, 78 },
+				{ 78, 90, 104 },
+				{ 103, 64, 59 },
+				{ 59, 86, 103 },
+				{ 77, 80, 104 },
+				{ 104, 90, 77 },
+				{ 103, 68, 64 },
+				{ 80, 83, 104 },
+				{ 50, 57, 59 },
+				{ 77, 74, 71 },
+			};
+
+			constexpr auto TriangleCountLod2 = sizeof(TrianglesLod2) / sizeof(triangle_face_t);
 		}
 	}
 
@@ -3913,6 +5079,65 @@ namespace Assets
 			{
 			}
 		};
+
+		struct SuzanneMeshletObject : public IntegerWorld::RenderObjects::Mesh::SimpleStaticMeshletTriangleObject
+			<Shapes::Suzanne::VertexCount, Shapes::Suzanne::TriangleCount, Shapes::Suzanne::MeshletCount>
+		{
+			SuzanneMeshletObject() : IntegerWorld::RenderObjects::Mesh::SimpleStaticMeshletTriangleObject
+				<Shapes::Suzanne::VertexCount, Shapes::Suzanne::TriangleCount, Shapes::Suzanne::MeshletCount>
+				(Shapes::Suzanne::Vertices,
+					Shapes::Suzanne::Triangles,
+					Shapes::Suzanne::Meshlets)
+			{
+			}
+		};
+
+		/// <summary>
+		/// Suzanne with 3 levels of detail: full, half and a fifth of the triangles.
+		/// </summary>
+		struct SuzanneLodObject : public IntegerWorld::RenderObjects::Mesh::LodTriangleObject
+			<Shapes::Suzanne::VertexCount, Shapes::Suzanne::TriangleCount, 3,
+			IntegerWorld::PrimitiveSources::Vertex::Static::Source,
+			IntegerWorld::PrimitiveSources::Triangle::Static::Source,
+			IntegerWorld::FrustumCullingEnum::PrimitiveCulling,
+			IntegerWorld::FaceCullingEnum::BackfaceCulling,
+			IntegerWorld::PrimitiveSources::Albedo::Dynamic::SingleSource,
+			IntegerWorld::PrimitiveSources::Material::Dynamic::SingleSource>
+		{
+			IntegerWorld::PrimitiveSources::Albedo::Dynamic::SingleSource AlbedosSource{};
+			IntegerWorld::PrimitiveSources::Material::Dynamic::SingleSource MaterialsSource{};
+
+			/// <summary>
+			/// </summary>
+			/// <param name="halfPixelRadius">Projected radius in pixels, at or below which the half level is used.</param>
+			/// <param name="fifthPixelRadius">Projected radius in pixels, at or below which the fifth level is used.</param>
+			SuzanneLodObject(const uint16_t halfPixelRadius = 64, const uint16_t fifthPixelRadius = 24)
+				: IntegerWorld::RenderObjects::Mesh::LodTriangleObject
+				<Shapes::Suzanne::VertexCount, Shapes::Suzanne::TriangleCount, 3,
+				IntegerWorld::PrimitiveSources::Vertex::Static::Source,
+				IntegerWorld::PrimitiveSources::Triangle::Static::Source,
+				IntegerWorld::FrustumCullingEnum::PrimitiveCulling,
+				IntegerWorld::FaceCullingEnum::BackfaceCulling,
+				IntegerWorld::PrimitiveSources::Albedo::Dynamic::SingleSource,
+				IntegerWorld::PrimitiveSources::Material::Dynamic::SingleSource>
+				(IntegerWorld::PrimitiveSources::Vertex::Static::Source(Shapes::Suzanne::Vertices),
+					IntegerWorld::PrimitiveSources::Triangle::Static::Source(Shapes::Suzanne::Triangles),
+					AlbedosSource, MaterialsSource)
+			{
+				BoundingRadius = Shapes::Suzanne::BoundingRadius;
+				SetLevel(1, IntegerWorld::PrimitiveSources::Vertex::Static::Source(Shapes::Suzanne::VerticesLod1), Shapes::Suzanne::VertexCountLod1,
+					IntegerWorld::PrimitiveSources::Triangle::Static::Source(Shapes::Suzanne::TrianglesLod1), Shapes::Suzanne::TriangleCountLod1,
+					halfPixelRadius);
+				SetLevel(2, IntegerWorld::PrimitiveSources::Vertex::Static::Source(Shapes::Suzanne::VerticesLod2), Shapes::Suzanne::VertexCountLod2,
+					IntegerWorld::PrimitiveSources::Triangle::Static::Source(Shapes::Suzanne::TrianglesLod2), Shapes::Suzanne::TriangleCountLod2,
+					fifthPixelRadius);
+			}
+
+			void SetAlbedo(const IntegerWorld::Rgb8::color_t albedo)
+			{
+				AlbedosSource.Albedo = albedo;
+			}
+		};
 	}
 }
 #endif
\ No newline at end of file
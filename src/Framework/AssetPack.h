@@ -0,0 +1,286 @@
+#ifndef _INTEGER_WORLD_ASSET_PACK_h
+#define _INTEGER_WORLD_ASSET_PACK_h
+
+#include "Model.h"
+
+namespace IntegerWorld
+{
+	/// <summary>
+	/// Binary asset pack, little-endian, version AssetPack::Version:
+	/// - asset_pack_header_t at offset 0.
+	/// - asset_pack_chunk_t table right after the header, ChunkCount entries.
+	/// - Chunk data at AssetPack::Alignment aligned offsets, as arrays of the chunk's element type.
+	/// Chunks belong to a mesh index, so a pack can hold many meshes and textures.
+	/// Element layouts are the engine's own structs, so data is read in place by the static primitive sources.
+	/// </summary>
+	namespace AssetPack
+	{
+		// "IWPK"
+		static constexpr uint32_t Magic = 0x4B505749;
+		static constexpr uint16_t Version = 1;
+		static constexpr uint8_t Alignment = 8;
+	}
+
+	enum class AssetPackChunkEnum : uint8_t
+	{
+		// vertex16_t per vertex.
+		Vertices = 1,
+		// vertex8_t per vertex, parameter is the scale shift.
+		Vertices8 = 2,
+		// triangle_face_t per triangle.
+		Triangles = 3,
+		// triangle8_face_t per triangle.
+		Triangles8 = 4,
+		// edge_line_t per edge.
+		Edges = 5,
+		// vertex16_t per triangle.
+		FaceNormals = 6,
+		// vertex16_t per vertex.
+		VertexNormals = 7,
+		// uv_t per triangle corner.
+		Uvs = 8,
+		// uint8_t material group per triangle.
+		Groups = 9,
+		// Rgb8::color_t per albedo.
+		Albedos = 10,
+		// Rgb8::color_t per texel, row-major. Parameter is the width shift in the low nibble and height shift in the high nibble.
+		Texture = 11,
+		// triangle32_face_t per triangle, for INTEGER_WORLD_INDEX32 builds.
+		Triangles32 = 12,
+	};
+
+	struct asset_pack_header_t
+	{
+		uint32_t magic;
+		uint16_t version;
+		uint16_t chunkCount;
+		uint32_t size;
+		uint32_t reserved;
+	};
+
+	struct asset_pack_chunk_t
+	{
+		uint8_t type;
+		uint8_t parameter;
+		uint16_t mesh;
+		uint32_t offset;
+		uint32_t count;
+		uint32_t reserved;
+	};
+
+	/// <summary>
+	/// Zero-copy view over an asset pack in addressable memory: RAM, an mmapped file or memory-mapped flash.
+	/// Returned arrays point into the pack, for the Static primitive sources.
+	/// Not for AVR PROGMEM, the header and table are read directly.
+	/// </summary>
+	class AssetPackReader
+	{
+	private:
+		const uint8_t* Data = nullptr;
+		const asset_pack_chunk_t* Chunks = nullptr;
+		uint32_t Size = 0;
+		uint16_t ChunkCount = 0;
+
+	public:
+		AssetPackReader() {}
+
+		/// <summary>
+		/// Validates the pack header, chunk table and chunk bounds.
+		/// </summary>
+		/// <param name="data">Pack start, aligned to AssetPack::Alignment.</param>
+		/// <param name="size">Available bytes.</param>
+		/// <returns>False if the pack is invalid, the reader is left empty.</returns>
+		bool Open(const void* data, const uint32_t size)
+		{
+			Close();
+
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			if (bytes == nullptr
+				|| (reinterpret_cast<uintptr_t>(bytes) % AssetPack::Alignment) != 0
+				|| size < sizeof(asset_pack_header_t))
+				return false;
+
+			const asset_pack_header_t* header = reinterpret_cast<const asset_pack_header_t*>(bytes);
+			if (header->magic != AssetPack::Magic
+				|| header->version != AssetPack::Version
+				|| header->size > size
+				|| header->size < sizeof(asset_pack_header_t) + (static_cast<uint32_t>(header->chunkCount) * sizeof(asset_pack_chunk_t)))
+				return false;
+
+			const asset_pack_chunk_t* chunks = reinterpret_cast<const asset_pack_chunk_t*>(bytes + sizeof(asset_pack_header_t));
+			for (uint_fast16_t i = 0; i < header->chunkCount; i++)
+			{
+				const uint32_t elementSize = GetElementSize(static_cast<AssetPackChunkEnum>(chunks[i].type));
+				if (elementSize == 0
+					|| (chunks[i].offset % AssetPack::Alignment) != 0
+					|| chunks[i].offset > header->size
+					|| chunks[i].count > ((header->size - chunks[i].offset) / elementSize))
+					return false;
+			}
+
+			Data = bytes;
+			Chunks = chunks;
+			Size = header->size;
+			ChunkCount = header->chunkCount;
+
+			return true;
+		}
+
+		void Close()
+		{
+			Data = nullptr;
+			Chunks = nullptr;
+			Size = 0;
+			ChunkCount = 0;
+		}
+
+		uint16_t GetChunkCount() const
+		{
+			return ChunkCount;
+		}
+
+		const asset_pack_chunk_t* GetChunk(const uint16_t index) const
+		{
+			if (index >= ChunkCount)
+				return nullptr;
+
+			return &Chunks[index];
+		}
+
+		/// <summary>
+		/// First chunk of the given type for the mesh, nullptr if none.
+		/// </summary>
+		const asset_pack_chunk_t* FindChunk(const AssetPackChunkEnum type, const uint16_t mesh) const
+		{
+			for (uint_fast16_t i = 0; i < ChunkCount; i++)
+			{
+				if (Chunks[i].type == static_cast<uint8_t>(type)
+					&& Chunks[i].mesh == mesh)
+					return &Chunks[i];
+			}
+
+			return nullptr;
+		}
+
+		/// <summary>
+		/// Chunk data as an array of its element type, nullptr if the chunk is missing.
+		/// </summary>
+		/// <param name="count">Element count, 0 if the chunk is missing.</param>
+		template<typename element_t>
+		const element_t* GetArray(const AssetPackChunkEnum type, const uint16_t mesh, uint32_t& count) const
+		{
+			const asset_pack_chunk_t* chunk = FindChunk(type, mesh);
+			if (chunk == nullptr
+				|| GetElementSize(type) != sizeof(element_t))
+			{
+				count = 0;
+				return nullptr;
+			}
+
+			count = chunk->count;
+
+			return reinterpret_cast<const element_t*>(Data + chunk->offset);
+		}
+
+		const vertex16_t* GetVertices(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<vertex16_t>(AssetPackChunkEnum::Vertices, mesh, count);
+		}
+
+		/// <summary>
+		/// Quantized vertices and their scale shift, for Vertex::Static::Int8Source.
+		/// </summary>
+		const vertex8_t* GetVertices8(const uint16_t mesh, uint32_t& count, uint8_t& scaleShift) const
+		{
+			const asset_pack_chunk_t* chunk = FindChunk(AssetPackChunkEnum::Vertices8, mesh);
+			scaleShift = chunk != nullptr ? chunk->parameter : 0;
+
+			return GetArray<vertex8_t>(AssetPackChunkEnum::Vertices8, mesh, count);
+		}
+
+		const triangle_face_t* GetTriangles(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<triangle_face_t>(AssetPackChunkEnum::Triangles, mesh, count);
+		}
+
+		const triangle8_face_t* GetTriangles8(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<triangle8_face_t>(AssetPackChunkEnum::Triangles8, mesh, count);
+		}
+
+		const triangle32_face_t* GetTriangles32(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<triangle32_face_t>(AssetPackChunkEnum::Triangles32, mesh, count);
+		}
+
+		const edge_line_t* GetEdges(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<edge_line_t>(AssetPackChunkEnum::Edges, mesh, count);
+		}
+
+		const vertex16_t* GetFaceNormals(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<vertex16_t>(AssetPackChunkEnum::FaceNormals, mesh, count);
+		}
+
+		const vertex16_t* GetVertexNormals(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<vertex16_t>(AssetPackChunkEnum::VertexNormals, mesh, count);
+		}
+
+		const uv_t* GetUvs(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<uv_t>(AssetPackChunkEnum::Uvs, mesh, count);
+		}
+
+		const uint8_t* GetGroups(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<uint8_t>(AssetPackChunkEnum::Groups, mesh, count);
+		}
+
+		const Rgb8::color_t* GetAlbedos(const uint16_t mesh, uint32_t& count) const
+		{
+			return GetArray<Rgb8::color_t>(AssetPackChunkEnum::Albedos, mesh, count);
+		}
+
+		/// <summary>
+		/// Texels of a texture, with its power of two dimensions.
+		/// </summary>
+		const Rgb8::color_t* GetTexture(const uint16_t mesh, uint16_t& width, uint16_t& height) const
+		{
+			const asset_pack_chunk_t* chunk = FindChunk(AssetPackChunkEnum::Texture, mesh);
+			uint32_t count = 0;
+			const Rgb8::color_t* texels = GetArray<Rgb8::color_t>(AssetPackChunkEnum::Texture, mesh, count);
+			if (texels == nullptr
+				|| count < (static_cast<uint32_t>(1) << ((chunk->parameter & 0x0F) + (chunk->parameter >> 4))))
+			{
+				width = 0;
+				height = 0;
+				return nullptr;
+			}
+
+			width = static_cast<uint16_t>(1) << (chunk->parameter & 0x0F);
+			height = static_cast<uint16_t>(1) << (chunk->parameter >> 4);
+
+			return texels;
+		}
+
+		static constexpr uint8_t GetElementSize(const AssetPackChunkEnum type)
+		{
+			return type == AssetPackChunkEnum::Vertices ? sizeof(vertex16_t)
+				: type == AssetPackChunkEnum::Vertices8 ? sizeof(vertex8_t)
+				: type == AssetPackChunkEnum::Triangles ? sizeof(triangle_face_t)
+				: type == AssetPackChunkEnum::Triangles8 ? sizeof(triangle8_face_t)
+				: type == AssetPackChunkEnum::Edges ? sizeof(edge_line_t)
+				: type == AssetPackChunkEnum::FaceNormals ? sizeof(vertex16_t)
+				: type == AssetPackChunkEnum::VertexNormals ? sizeof(vertex16_t)
+				: type == AssetPackChunkEnum::Uvs ? sizeof(uv_t)
+				: type == AssetPackChunkEnum::Groups ? sizeof(uint8_t)
+				: type == AssetPackChunkEnum::Albedos ? sizeof(Rgb8::color_t)
+				: type == AssetPackChunkEnum::Texture ? sizeof(Rgb8::color_t)
+				: type == AssetPackChunkEnum::Triangles32 ? sizeof(triangle32_face_t)
+				: 0;
+		}
+	};
+}
+#endif
\ No newline at end of file
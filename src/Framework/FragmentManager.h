@@ -12,20 +12,20 @@ namespace IntegerWorld
 	{
 	protected:
 		ordered_fragment_t* Fragments;
-		const uint16_t MaxFragments;
-		uint16_t FragmentCount = 0;
+		const primitive_index_t MaxFragments;
+		primitive_index_t FragmentCount = 0;
 
 	protected:
 		uint16_t ObjectIndex = 0;
 
 	public:
-		FragmentCollector(ordered_fragment_t* fragments, const uint16_t maxFragments)
+		FragmentCollector(ordered_fragment_t* fragments, const primitive_index_t maxFragments)
 			: Fragments(fragments)
 			, MaxFragments(maxFragments)
 		{
 		}
 
-		bool AddFragment(const uint16_t fragmentIndex, const uint16_t z)
+		bool AddFragment(const primitive_index_t fragmentIndex, const uint16_t z)
 		{
 			if (FragmentCount < MaxFragments)
 			{
@@ -40,7 +40,7 @@ namespace IntegerWorld
 		}
 	};
 
-	template<uint16_t MaxOrderedFragments>
+	template<primitive_index_t MaxOrderedFragments>
 	class OrderedFragmentManager : FragmentCollector
 	{
 	public:
@@ -60,7 +60,7 @@ namespace IntegerWorld
 			ObjectIndex = objectIndex;
 		}
 
-		uint16_t Count() const
+		primitive_index_t Count() const
 		{
 			return FragmentCount;
 		}
@@ -75,12 +75,12 @@ namespace IntegerWorld
 				});
 #else
 			ordered_fragment_t temp{};
-			for (uint_fast16_t gap = FragmentCount >> 1; gap > 0; gap >>= 1)
+			for (primitive_index_t gap = FragmentCount >> 1; gap > 0; gap >>= 1)
 			{
-				for (uint_fast16_t i = gap; i < FragmentCount; ++i)
+				for (primitive_index_t i = gap; i < FragmentCount; ++i)
 				{
 					temp = Fragments[i];
-					uint_fast16_t j = i;
+					primitive_index_t j = i;
 					while (j >= gap && Fragments[j - gap].Z < temp.Z)
 					{
 						Fragments[j] = Fragments[j - gap];
@@ -13,10 +13,31 @@ namespace IntegerWorld
 {
 	/// <summary>
 	/// SceneShader shader takes in an albedo, material and primitive properties, to calculate a lit color.
+	/// GetLitColor is const and must not keep per-call state in the shader, so one instance can be shared by concurrent callers.
 	/// </summary>
 	struct ISceneShader
 	{
-		virtual Rgb8::color_t GetLitColor(const Rgb8::color_t albedo, const material_t& material, const vertex16_t& position, const vertex16_t& normal) = 0;
+		virtual Rgb8::color_t GetLitColor(const Rgb8::color_t albedo, const material_t& material, const vertex16_t& position, const vertex16_t& normal) const = 0;
+
+		/// <summary>
+		/// Selects the lights that can reach an object's world bounding sphere, once per frame on ObjectShade.
+		/// The list is kept by the object, so selection stays stateless in the shader. Selects all lights by default.
+		/// </summary>
+		/// <param name="lights">Object's light list to fill.</param>
+		/// <param name="center">Bounding sphere center in world space.</param>
+		/// <param name="radius">Bounding sphere radius in world units, 0 when unknown.</param>
+		virtual void SelectObjectLights(object_lights_t& lights, const vertex16_t& /*center*/, const uint16_t /*radius*/) const
+		{
+			lights.count = OBJECT_LIGHTS_ALL;
+		}
+
+		/// <summary>
+		/// GetLitColor with only the lights selected for the object by SelectObjectLights.
+		/// </summary>
+		virtual Rgb8::color_t GetObjectLitColor(const Rgb8::color_t albedo, const material_t& material, const vertex16_t& position, const vertex16_t& normal, const object_lights_t& /*lights*/) const
+		{
+			return GetLitColor(albedo, material, position, normal);
+		}
 	};
 
 	/// <summary>
@@ -78,6 +99,11 @@ namespace IntegerWorld
 	///
 	/// Threading / performance notes:
 	/// - Methods are called from the single EngineRenderTask render thread; no internal locking is expected.
+	/// - Exception: FragmentShade may be called concurrently for the same object by an IFragmentRasterizer.
+	///   It must only read object state, keeping the fragment and any pixel shader state on the stack.
+	/// - Exception: with an IStageExecutor set on the engine, ObjectShade through ScreenShade run for one object
+	///   on a single worker, while other objects run on other workers. Objects must only write their own state;
+	///   shared sources and scene shaders are read-only during the frame.
 	/// - Avoid long computations in hot paths. Cache computed data in object-local buffers.
 	/// </summary>
 	struct IRenderObject
@@ -101,13 +127,14 @@ namespace IntegerWorld
 		/// Called repeatedly before world transform.
 		/// Responsibilities:
 		/// - Apply skeletal/morph/animated offsets into the vertex buffer.
+		/// - Objects on a fused vertex path (e.g. Mesh FusedVertices) don't load the vertex buffer, offsets applied here would be lost.
 		/// Return semantics:
 		/// - Return true when the object has finished processing all indices for this stage (engine will advance to the next object).
 		/// - Return false to indicate there are more indices to process (engine will call this method again with the next index).
 		/// </summary>
 		/// <param name="vertexIndex">Vertex index.</param>
 		/// <returns>True if finished; false to continue.</returns>
-		virtual bool VertexShade(const uint16_t vertexIndex) = 0;
+		virtual bool VertexShade(const primitive_index_t vertexIndex) = 0;
 
 		/// <summary>
 		/// Convert a vertex from local-space to world-space. (Per-vertex stage)
@@ -120,7 +147,7 @@ namespace IntegerWorld
 		/// </summary>
 		/// <param name="vertexIndex">Vertex index.</param>
 		/// <returns>True if finished; false to continue.</returns>
-		virtual bool WorldTransform(const uint16_t vertexIndex) = 0;
+		virtual bool WorldTransform(const primitive_index_t vertexIndex) = 0;
 
 		/// <summary>
 		/// Compute world-space properties and perform per-primitive world culling. (Per-primitive stage)
@@ -135,7 +162,7 @@ namespace IntegerWorld
 		/// <param name="frustum">Pre-computed view frustum for world-space checks.</param>
 		/// <param name="primitiveIndex">Primitive index.</param>
 		/// <returns>True if finished; false to continue.</returns>
-		virtual bool WorldShade(const frustum_t& frustum, const uint16_t primitiveIndex) = 0;
+		virtual bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex) = 0;
 
 		/// <summary>
 		/// Transform world-space vertex into camera-space. (Per-vertex stage)
@@ -149,7 +176,7 @@ namespace IntegerWorld
 		/// <param name="transform">Pre-computed camera transform (cos/sin and translation).</param>
 		/// <param name="vertexIndex">Vertex index.</param>
 		/// <returns>True if finished; false to continue.</returns>
-		virtual bool CameraTransform(const transform16_camera_t& transform, const uint16_t vertexIndex) = 0;
+		virtual bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex) = 0;
 
 		/// <summary>
 		/// Project camera-space into screen-space using the given ViewportProjector. (Per-vertex stage)
@@ -165,7 +192,7 @@ namespace IntegerWorld
 		/// <param name="screenProjector">Projector configured for current viewport/FOV.</param>
 		/// <param name="vertexIndex">Vertex index.</param>
 		/// <returns>True if finished; false to continue.</returns>
-		virtual bool ScreenProject(ViewportProjector& screenProjector, const uint16_t vertexIndex) = 0;
+		virtual bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex) = 0;
 
 		/// <summary>
 		/// Compute and cache final screen-space properties. (Per-primitive stage)
@@ -180,7 +207,7 @@ namespace IntegerWorld
 		/// </summary>
 		/// <param name="primitiveIndex">Primitive index.</param>
 		/// <returns>True if finished; false to continue.</returns>
-		virtual bool ScreenShade(const uint16_t primitiveIndex) = 0;
+		virtual bool ScreenShade(const primitive_index_t primitiveIndex) = 0;
 
 		/// <summary>
 		/// Emit the object's primitives as z-ordered fragment entries to the provided FragmentCollector.
@@ -205,7 +232,84 @@ namespace IntegerWorld
 		/// </summary>
 		/// <param name="rasterizer">Rasterizer bound to the output surface.</param>
 		/// <param name="primitiveIndex">Fragment index, same as primitive index as emitted by FragmentCollect.</param>
-		virtual void FragmentShade(WindowRasterizer& rasterizer, const uint16_t primitiveIndex) = 0;
+		virtual void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex) = 0;
+
+		/// <summary>
+		/// World-space bounding sphere of the object, for per-frame visibility culling before ObjectShade.
+		/// Must be valid from the object's public state (e.g. Translation and Resize), without running any stage.
+		/// Objects without bounds are always considered visible.
+		/// </summary>
+		/// <param name="center">Sphere center in world space.</param>
+		/// <param name="radius">Sphere radius in world units.</param>
+		/// <returns>True if the object has bounds.</returns>
+		virtual bool GetBoundingSphere(vertex16_t& /*center*/, uint16_t& /*radius*/)
+		{
+			return false;
+		}
+	};
+
+	/// <summary>
+	/// Unit of work dispatched by an IStageExecutor, indexed by item (object, tile, ...).
+	/// </summary>
+	struct IStageJob
+	{
+		/// <summary>
+		/// Runs the job for one item. May be called concurrently for different items.
+		/// </summary>
+		/// <param name="index">Item index.</param>
+		/// <param name="workerIndex">Index of the executing worker, in [0, worker count). Useful for per-worker scratch state.</param>
+		virtual void Run(const uint16_t index, const uint8_t workerIndex) = 0;
+	};
+
+	/// <summary>
+	/// Executes a job over a range of items, returning only when all items are done.
+	/// Implementations may run items concurrently and in any order.
+	/// </summary>
+	struct IStageExecutor
+	{
+		/// <summary>
+		/// Runs job.Run(i, worker) for every i in [0, count) and waits for completion.
+		/// </summary>
+		virtual void Execute(IStageJob& job, const uint16_t count) = 0;
+
+		/// <summary>
+		/// Number of workers that may run items concurrently.
+		/// </summary>
+		virtual uint8_t GetWorkerCount() const = 0;
+	};
+
+	/// <summary>
+	/// Optional rasterization backend that draws a whole frame of z-ordered fragments at once.
+	/// When set on the engine, it replaces the one-fragment-per-callback Rasterize stage.
+	/// Implementations may rasterize concurrently, as long as the final output matches drawing the fragments in order.
+	/// </summary>
+	struct IFragmentRasterizer
+	{
+		/// <summary>
+		/// Rasterizes all fragments, in the given order.
+		/// </summary>
+		/// <param name="objects">Render objects, indexed by ordered_fragment_t::ObjectIndex.</param>
+		/// <param name="fragments">Z-ordered fragments.</param>
+		/// <param name="fragmentCount">Number of fragments.</param>
+		virtual void RasterizeFragments(IRenderObject* const* objects, const ordered_fragment_t* fragments, const primitive_index_t fragmentCount) = 0;
+	};
+
+	/// <summary>
+	/// Optional per-frame visibility pass for the engine.
+	/// Called once per frame after the camera update, before ObjectShade.
+	/// Only the returned objects run the frame's stages, so culled objects cost nothing past this pass.
+	/// </summary>
+	struct IObjectCuller
+	{
+		/// <summary>
+		/// Selects the objects that may be visible in the frustum.
+		/// </summary>
+		/// <param name="objects">All engine objects.</param>
+		/// <param name="objectCount">Number of engine objects.</param>
+		/// <param name="frustum">Current view frustum (world-space).</param>
+		/// <param name="visibleObjects">Receives the visible object list, owned by the culler and valid until the next call.</param>
+		/// <returns>Number of visible objects.</returns>
+		virtual uint16_t CullObjects(IRenderObject* const* objects, const uint16_t objectCount, const frustum_t& frustum, IRenderObject* const*& visibleObjects) = 0;
 	};
 
 	/// <summary>
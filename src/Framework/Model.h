@@ -12,6 +12,17 @@ namespace IntegerWorld
 	using namespace IntegerSignal::FixedPoint::ScalarFraction;
 	using namespace IntegerSignal::FixedPoint::FactorScale;
 
+	/// <summary>
+	/// Vertex, primitive and fragment index type of the render stages, shared by all objects.
+	/// 16 bits by default, caps a single object at 65535 vertices and primitives.
+	/// Define INTEGER_WORLD_INDEX32 for larger meshes, e.g. host builds with scanned geometry.
+	/// </summary>
+#if defined(INTEGER_WORLD_INDEX32)
+	typedef uint32_t primitive_index_t;
+#else
+	typedef uint16_t primitive_index_t;
+#endif
+
 	/// <summary>
 	/// Specifies modes for frustum culling to determine which scene elements are considered for rendering.
 	/// </summary>
@@ -91,6 +102,29 @@ namespace IntegerWorld
 		fraction8_t Fresnel;
 	};
 
+	/// <summary>
+	/// Maximum lights selected per object, see object_lights_t.
+	/// </summary>
+#if !defined(INTEGER_WORLD_OBJECT_LIGHTS_MAX)
+#define INTEGER_WORLD_OBJECT_LIGHTS_MAX 8
+#endif
+
+	/// <summary>
+	/// Marks an object_lights_t that selects all lights.
+	/// </summary>
+	static constexpr uint8_t OBJECT_LIGHTS_ALL = UINT8_MAX;
+
+	/// <summary>
+	/// Scene lights that can reach an object, selected by the scene shader once per frame on ObjectShade.
+	/// count is OBJECT_LIGHTS_ALL when the shader doesn't select, the object has no bounds
+	/// or more than INTEGER_WORLD_OBJECT_LIGHTS_MAX lights reach it.
+	/// </summary>
+	struct object_lights_t
+	{
+		uint8_t indices[INTEGER_WORLD_OBJECT_LIGHTS_MAX];
+		uint8_t count = OBJECT_LIGHTS_ALL;
+	};
+
 
 	/// <summary>
 	/// Compile-time texture size struct that computes power-of-two Width and Height from enum-based dimension exponents.
@@ -129,6 +163,20 @@ namespace IntegerWorld
 		uint16_t c;
 	};
 
+	struct triangle8_face_t
+	{
+		uint8_t a;
+		uint8_t b;
+		uint8_t c;
+	};
+
+	struct triangle32_face_t
+	{
+		uint32_t a;
+		uint32_t b;
+		uint32_t c;
+	};
+
 	struct uv_t
 	{
 		uint8_t x;
@@ -142,6 +190,55 @@ namespace IntegerWorld
 		uv_t c;
 	};
 
+	/// <summary>
+	/// Cluster of consecutive triangles, with object-space bounds for whole-cluster culling.
+	/// All triangle normals are within the cone around coneAxis (VERTEX16_UNIT length),
+	/// coneCutoff is the sine of the cone's half-angle. UFRACTION16_1X disables cone culling.
+	/// Triangle ranges are 16-bit, so meshlet meshes stay within 65535 triangles even with INTEGER_WORLD_INDEX32.
+	/// </summary>
+	struct meshlet_t
+	{
+		vertex16_t center;
+		uint16_t radius;
+		vertex16_t coneAxis;
+		ufraction16_t coneCutoff;
+		uint16_t firstTriangle;
+		uint16_t triangleCount;
+	};
+
+	/// <summary>
+	/// Sparse morph target delta for one vertex, int8-quantized.
+	/// The delta in vertex units is the component left shifted by the target's shift.
+	/// </summary>
+	struct morph_delta_t
+	{
+		uint16_t vertex;
+		int8_t x;
+		int8_t y;
+		int8_t z;
+	};
+
+	/// <summary>
+	/// Morph target as a range of deltas, sorted by vertex and with at most one delta per vertex.
+	/// Vertex indices are 16-bit, so morph targets only reach the first 65536 vertices even with INTEGER_WORLD_INDEX32.
+	/// </summary>
+	struct morph_target_t
+	{
+		uint16_t firstDelta;
+		uint16_t deltaCount;
+		uint8_t shift;
+	};
+
+	/// <summary>
+	/// Vertex skin, up to 4 bone palette indices with ufraction8_t weights summing to UFRACTION8_1X.
+	/// Unused slots have a 0 weight.
+	/// </summary>
+	struct skin_vertex_t
+	{
+		uint8_t bones[4];
+		ufraction8_t weights[4];
+	};
+
 	struct billboard_fragment_t
 	{
 		int16_t topLeftX;
@@ -157,7 +254,7 @@ namespace IntegerWorld
 
 	struct point_cloud_fragment_t
 	{
-		uint16_t index;
+		primitive_index_t index;
 
 		int16_t x;
 		int16_t y;
@@ -173,7 +270,7 @@ namespace IntegerWorld
 		vertex16_t vertexA;
 		vertex16_t vertexB;
 
-		uint16_t index;
+		primitive_index_t index;
 		int16_t z;
 
 		uint8_t red;
@@ -186,7 +283,7 @@ namespace IntegerWorld
 		vertex16_t vertexA;
 		vertex16_t vertexB;
 
-		uint16_t index;
+		primitive_index_t index;
 		int16_t z;
 
 		uint8_t redA;
@@ -208,7 +305,7 @@ namespace IntegerWorld
 		uv_t uvB;
 		uv_t uvC;
 
-		uint16_t index;
+		primitive_index_t index;
 		int16_t z;
 
 		uint8_t red;
@@ -226,7 +323,7 @@ namespace IntegerWorld
 		uv_t uvB;
 		uv_t uvC;
 
-		uint16_t index;
+		primitive_index_t index;
 		int16_t z;
 
 		uint8_t redA;
@@ -250,16 +347,32 @@ namespace IntegerWorld
 		int16_t z;
 	};
 
+	/// <summary>
+	/// Camera position and rotation.
+	/// With INTEGER_WORLD_LARGE_WORLD, WorldPosition is the 32-bit origin of the frame's render space:
+	/// objects are rebased around it on ObjectShade and Position is the camera offset from it.
+	/// Lights and instance positions stay in 16-bit render space.
+	/// </summary>
 	struct camera_state_t
 	{
 		vertex16_t Position{};
 		rotation_angle_t Rotation{};
+#if defined(INTEGER_WORLD_LARGE_WORLD)
+		vertex32_t WorldPosition{};
+#endif
+	};
+
+	struct mesh_instance_t
+	{
+		vertex16_t Position{};
+		rotation_angle_t Rotation{};
+		Rgb8::color_t Albedo = Rgb8::WHITE;
 	};
 
 	struct ordered_fragment_t
 	{
 		uint16_t ObjectIndex;
-		uint16_t FragmentIndex;
+		primitive_index_t FragmentIndex;
 		int16_t Z;
 	};
 
@@ -270,6 +383,14 @@ namespace IntegerWorld
 
 	struct frustum_t
 	{
+		// Outcode bits, one per failed test of IsPointInside.
+		static constexpr uint8_t OUTCODE_SPHERE = 1 << 0;
+		static constexpr uint8_t OUTCODE_NEAR = 1 << 1;
+		static constexpr uint8_t OUTCODE_LEFT = 1 << 2;
+		static constexpr uint8_t OUTCODE_RIGHT = 1 << 3;
+		static constexpr uint8_t OUTCODE_TOP = 1 << 4;
+		static constexpr uint8_t OUTCODE_BOTTOM = 1 << 5;
+
 		plane16_t cullingNearPlane;
 		plane16_t cullingLeftPlane;
 		plane16_t cullingRightPlane;
@@ -278,21 +399,23 @@ namespace IntegerWorld
 
 		rotation_angle_t rotation;
 		vertex16_t origin;
+#if defined(INTEGER_WORLD_LARGE_WORLD)
+		// Render space origin in world coordinates, see camera_state_t::WorldPosition.
+		vertex32_t worldOrigin;
+#endif
 		int32_t radiusSquared;
+		uint16_t radius;
+
+		// Screen projection scale, for projected sizes (see GetProjectedRadius).
+		uint32_t projectionScale;
+		uint8_t projectionShifts;
 
 		bool IsPointInside(const vertex16_t& point, const uint16_t planeTolerance = VERTEX16_UNIT / 16) const
 		{
 			// Sphere culling - early distance check.
-			{
-				const int16_t dx = point.x - origin.x;
-				const int16_t dy = point.y - origin.y;
-				const int16_t dz = point.z - origin.z;
-				const int32_t squareDistance = (static_cast<int32_t>(dx) * dx) + (static_cast<int32_t>(dy) * dy) + (static_cast<int32_t>(dz) * dz);
-
-				// If point is outside the bounding sphere, it's definitely outside the frustum.
-				if (squareDistance > radiusSquared)
-					return false;
-			}
+			// If point is outside the bounding sphere, it's definitely outside the frustum.
+			if (!IsPointInRange(point))
+				return false;
 
 			// Check against near plane. Z axis points forward, so point must be in front of near plane.
 			if (PlaneDistanceToPoint(cullingNearPlane, point) < 0)
@@ -318,8 +441,157 @@ namespace IntegerWorld
 			return true;
 		}
 
+		/// <summary>
+		/// Runs all IsPointInside tests and returns the failed ones as OUTCODE_ bits.
+		/// 0 when the point is inside. Points outside the same plane have a common bit.
+		/// </summary>
+		uint8_t GetOutcode(const vertex16_t& point, const uint16_t planeTolerance = VERTEX16_UNIT / 16) const
+		{
+			uint8_t outcode = 0;
+
+			if (!IsPointInRange(point))
+				outcode |= OUTCODE_SPHERE;
+
+			if (PlaneDistanceToPoint(cullingNearPlane, point) < 0)
+				outcode |= OUTCODE_NEAR;
+
+			if (PlaneDistanceToPoint(cullingLeftPlane, point) > static_cast<int16_t>(planeTolerance))
+				outcode |= OUTCODE_LEFT;
+
+			if (PlaneDistanceToPoint(cullingRightPlane, point) > static_cast<int16_t>(planeTolerance))
+				outcode |= OUTCODE_RIGHT;
+
+			if (PlaneDistanceToPoint(cullingTopPlane, point) > static_cast<int16_t>(planeTolerance))
+				outcode |= OUTCODE_TOP;
+
+			if (PlaneDistanceToPoint(cullingBottomPlane, point) > static_cast<int16_t>(planeTolerance))
+				outcode |= OUTCODE_BOTTOM;
+
+			return outcode;
+		}
+
+		/// <summary>
+		/// Tests if any part of a sphere may be inside the frustum.
+		/// Conservative: a sphere near a frustum edge may pass while being outside.
+		/// </summary>
+		/// <param name="center">Sphere center in world space.</param>
+		/// <param name="sphereRadius">Sphere radius in world units.</param>
+		bool IsSphereInside(const vertex16_t& center, const uint16_t sphereRadius, const uint16_t planeTolerance = VERTEX16_UNIT / 16) const
+		{
+			// Bounding sphere early distance check, the spheres don't overlap.
+			if (SquareDistance(center) > Square(static_cast<uint32_t>(radius) + sphereRadius))
+				return false;
+
+			// Sphere is entirely behind one of the planes.
+			if (PlaneDistanceToPoint(cullingNearPlane, center) < -static_cast<int32_t>(sphereRadius))
+				return false;
+
+			const int32_t sideTolerance = static_cast<int32_t>(planeTolerance) + sphereRadius;
+			if (PlaneDistanceToPoint(cullingLeftPlane, center) > sideTolerance
+				|| PlaneDistanceToPoint(cullingRightPlane, center) > sideTolerance
+				|| PlaneDistanceToPoint(cullingTopPlane, center) > sideTolerance
+				|| PlaneDistanceToPoint(cullingBottomPlane, center) > sideTolerance)
+				return false;
+
+			return true;
+		}
+
+		/// <summary>
+		/// Tests if a sphere is entirely inside the frustum,
+		/// i.e. every point within the sphere passes IsPointInside with the same tolerance.
+		/// </summary>
+		/// <param name="center">Sphere center in world space.</param>
+		/// <param name="sphereRadius">Sphere radius in world units.</param>
+		bool IsSphereFullyInside(const vertex16_t& center, const uint16_t sphereRadius, const uint16_t planeTolerance = VERTEX16_UNIT / 16) const
+		{
+			// Sphere must fit inside the bounding sphere.
+			if (sphereRadius > radius
+				|| SquareDistance(center) > Square(radius - sphereRadius))
+				return false;
+
+			// Sphere must be in front of the near plane.
+			if (PlaneDistanceToPoint(cullingNearPlane, center) < static_cast<int32_t>(sphereRadius))
+				return false;
+
+			const int32_t sideTolerance = static_cast<int32_t>(planeTolerance) - sphereRadius;
+			if (PlaneDistanceToPoint(cullingLeftPlane, center) > sideTolerance
+				|| PlaneDistanceToPoint(cullingRightPlane, center) > sideTolerance
+				|| PlaneDistanceToPoint(cullingTopPlane, center) > sideTolerance
+				|| PlaneDistanceToPoint(cullingBottomPlane, center) > sideTolerance)
+				return false;
+
+			return true;
+		}
+
+		/// <summary>
+		/// Approximate projected radius of a sphere in pixels, from its distance to the camera.
+		/// </summary>
+		/// <param name="center">Sphere center in world space.</param>
+		/// <param name="sphereRadius">Sphere radius in world units.</param>
+		/// <returns>Horizontal screen radius in pixels, 0 without a screen projection.</returns>
+		uint16_t GetProjectedRadius(const vertex16_t& center, const uint16_t sphereRadius) const
+		{
+			// Reduce the square distance to 32 bits for the square root.
+			uint64_t squareDistance = SquareDistance(center);
+			uint8_t shifts = 0;
+			while (squareDistance > UINT32_MAX)
+			{
+				squareDistance >>= 2;
+				shifts++;
+			}
+			const uint32_t distance = static_cast<uint32_t>(IntegerSignal::SquareRoot32(static_cast<uint32_t>(squareDistance))) << shifts;
+
+			// Camera space depth after the focal distance shift is the distance to the camera, as in projection.
+			const uint64_t depth = static_cast<uint64_t>(distance) << projectionShifts;
+			if (depth == 0)
+				return UINT16_MAX;
+
+			return static_cast<uint16_t>(MinValue<uint64_t>(UINT16_MAX, (static_cast<uint64_t>(sphereRadius) * projectionScale) / depth));
+		}
+
 	private:
-		static int16_t PlaneDistanceToPoint(const plane16_t& plane, const vertex16_t& point)
+		// The draw distance radius is at most DRAW_DISTANCE_MAX (see ViewportProjector::SetDrawDistance).
+		static_assert((3 * static_cast<uint64_t>(DRAW_DISTANCE_MAX) * DRAW_DISTANCE_MAX) <= UINT32_MAX, "Point range squares must fit in uint32.");
+
+		/// <summary>
+		/// Per-vertex draw distance check, in 32 bits.
+		/// Each axis is rejected against radius first, so the 3 squares are 16x16 bit and their sum fits in uint32.
+		/// </summary>
+		bool IsPointInRange(const vertex16_t& point) const
+		{
+			const uint16_t dx = static_cast<uint16_t>(AbsValue(static_cast<int32_t>(point.x) - origin.x));
+			if (dx > radius)
+				return false;
+
+			const uint16_t dy = static_cast<uint16_t>(AbsValue(static_cast<int32_t>(point.y) - origin.y));
+			if (dy > radius)
+				return false;
+
+			const uint16_t dz = static_cast<uint16_t>(AbsValue(static_cast<int32_t>(point.z) - origin.z));
+			if (dz > radius)
+				return false;
+
+			return ((static_cast<uint32_t>(dx) * dx) + (static_cast<uint32_t>(dy) * dy) + (static_cast<uint32_t>(dz) * dz))
+				<= static_cast<uint32_t>(radiusSquared);
+		}
+
+		uint64_t SquareDistance(const vertex16_t& point) const
+		{
+			const int32_t dx = static_cast<int32_t>(point.x) - origin.x;
+			const int32_t dy = static_cast<int32_t>(point.y) - origin.y;
+			const int32_t dz = static_cast<int32_t>(point.z) - origin.z;
+
+			return Square(static_cast<uint32_t>(AbsValue(dx)))
+				+ Square(static_cast<uint32_t>(AbsValue(dy)))
+				+ Square(static_cast<uint32_t>(AbsValue(dz)));
+		}
+
+		static constexpr uint64_t Square(const uint32_t value)
+		{
+			return static_cast<uint64_t>(value) * value;
+		}
+
+		static int32_t PlaneDistanceToPoint(const plane16_t& plane, const vertex16_t& point)
 		{
 			// Calculate dot product between normal and point, normalized by VERTEX16_UNIT.
 			const int32_t dotProduct = SignedRightShift(DotProduct16(plane, point), GetBitShifts(VERTEX16_UNIT));
@@ -337,7 +609,7 @@ namespace IntegerWorld
 		uint32_t FrameDuration = 0;
 		uint32_t Render = 0;
 		uint32_t Rasterize = 0;
-		uint16_t FragmentsDrawn = 0;
+		primitive_index_t FragmentsDrawn = 0;
 
 		uint32_t GetRenderDuration() const
 		{
@@ -372,7 +644,7 @@ namespace IntegerWorld
 		uint32_t RasterizeWait = 0;
 		uint32_t Rasterize = 0;
 
-		uint16_t FragmentsDrawn = 0;
+		primitive_index_t FragmentsDrawn = 0;
 
 		uint32_t GetRenderDuration() const
 		{
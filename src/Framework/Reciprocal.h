@@ -0,0 +1,72 @@
+#ifndef _INTEGER_WORLD_RECIPROCAL_h
+#define _INTEGER_WORLD_RECIPROCAL_h
+
+#include <IntegerSignal.h>
+
+namespace IntegerWorld
+{
+	/// <summary>
+	/// Fixed-point reciprocal for MCUs without a hardware divider.
+	/// A 128 entry table gives a ~9 bit seed, one Newton step refines it to ~15 bits.
+	/// Usage: numerator / value ~= (numerator * reciprocal) >> shifts.
+	/// </summary>
+	namespace Reciprocal
+	{
+		static constexpr uint8_t SeedBits = 7;
+		static constexpr uint8_t Q = 30;
+
+		// round(2^30 / n) for n at the center of each of the 128 sub-ranges of [2^15, 2^16).
+		static constexpr uint16_t Seeds[1 << SeedBits] PROGMEM
+		{
+			32640, 32388, 32140, 31896, 31655, 31418, 31184, 30954,
+			30728, 30504, 30284, 30067, 29853, 29642, 29434, 29229,
+			29026, 28827, 28630, 28436, 28244, 28056, 27869, 27685,
+			27504, 27324, 27148, 26973, 26801, 26631, 26462, 26297,
+			26133, 25971, 25811, 25653, 25497, 25343, 25191, 25041,
+			24892, 24745, 24600, 24457, 24315, 24175, 24036, 23899,
+			23764, 23630, 23498, 23367, 23237, 23109, 22982, 22857,
+			22733, 22611, 22490, 22370, 22251, 22134, 22017, 21902,
+			21789, 21676, 21565, 21454, 21345, 21237, 21130, 21024,
+			20919, 20815, 20713, 20611, 20510, 20410, 20311, 20214,
+			20117, 20021, 19925, 19831, 19738, 19645, 19554, 19463,
+			19373, 19284, 19196, 19108, 19022, 18936, 18851, 18766,
+			18683, 18600, 18518, 18437, 18356, 18276, 18197, 18118,
+			18040, 17963, 17886, 17810, 17735, 17660, 17586, 17513,
+			17440, 17368, 17296, 17225, 17155, 17085, 17015, 16947,
+			16878, 16811, 16744, 16677, 16611, 16546, 16481, 16416
+		};
+
+		/// <summary>
+		/// Gets the reciprocal of a 16 bit value.
+		/// </summary>
+		/// <param name="value">Divisor, must be non zero.</param>
+		/// <param name="shifts">Right shifts to apply after multiplying by the reciprocal.</param>
+		/// <returns>Reciprocal of value, normalized to [2^14, 2^15].</returns>
+		static uint16_t Get(const uint16_t value, uint8_t& shifts)
+		{
+			// Normalize to [2^15, 2^16) without relying on a count-leading-zeros instruction.
+			uint32_t normal = value;
+			uint8_t normalShifts = 0;
+			if (normal < ((uint32_t)1 << 8)) { normal <<= 8; normalShifts += 8; }
+			if (normal < ((uint32_t)1 << 12)) { normal <<= 4; normalShifts += 4; }
+			if (normal < ((uint32_t)1 << 14)) { normal <<= 2; normalShifts += 2; }
+			if (normal < ((uint32_t)1 << 15)) { normal <<= 1; normalShifts += 1; }
+
+			const uint8_t index = static_cast<uint8_t>((normal >> (15 - SeedBits)) & ((1 << SeedBits) - 1));
+#if defined(ARDUINO_ARCH_AVR)
+			const int32_t seed = static_cast<int32_t>(pgm_read_word(&Seeds[index]));
+#else
+			const int32_t seed = Seeds[index];
+#endif
+
+			// One Newton step: r = r + r * (1 - n * r), with the error pre-shifted to stay in 32 bits.
+			const int32_t error = static_cast<int32_t>(((uint32_t)1 << Q) - (normal * static_cast<uint32_t>(seed)));
+			const int32_t reciprocal = seed + SignedRightShift(seed * SignedRightShift(error, 7), Q - 7);
+
+			shifts = Q - normalShifts;
+
+			return static_cast<uint16_t>(reciprocal);
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -17,6 +17,26 @@ namespace IntegerWorld
 		int16_t z;
 	};
 
+	/// <summary>
+	/// Compact storage vertex with signed 8-bit coordinates, scaled to vertex16_t by a per-mesh left shift.
+	/// </summary>
+	struct vertex8_t
+	{
+		int8_t x;
+		int8_t y;
+		int8_t z;
+	};
+
+	/// <summary>
+	/// World-scale vertex with signed 32-bit coordinates, for large-world positions (see INTEGER_WORLD_LARGE_WORLD).
+	/// </summary>
+	struct vertex32_t
+	{
+		int32_t x;
+		int32_t y;
+		int32_t z;
+	};
+
 	/// <summary>
 	/// vertex16_t axis uses int16_t.
 	/// </summary>
@@ -143,6 +163,20 @@ namespace IntegerWorld
 		return IntegerSignal::SquareRoot32(distSquared);
 	}
 
+	/// <summary>
+	/// Squared distance between two vertices, in 64 bits so axis differences don't wrap as in Distance16.
+	/// </summary>
+	inline uint64_t SquareDistance16(const vertex16_t& a, const vertex16_t& b)
+	{
+		const int32_t dx = static_cast<int32_t>(b.x) - a.x;
+		const int32_t dy = static_cast<int32_t>(b.y) - a.y;
+		const int32_t dz = static_cast<int32_t>(b.z) - a.z;
+
+		return static_cast<uint64_t>(static_cast<int64_t>(dx) * dx)
+			+ static_cast<uint64_t>(static_cast<int64_t>(dy) * dy)
+			+ static_cast<uint64_t>(static_cast<int64_t>(dz) * dz);
+	}
+
 	/// <summary>
 	/// Computes an approximate average of three signed 16-bit integers using scaled fixed-point arithmetic to avoid overflow.
 	/// </summary>
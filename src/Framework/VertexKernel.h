@@ -0,0 +1,99 @@
+#ifndef _INTEGER_WORLD_VERTEX_KERNEL_h
+#define _INTEGER_WORLD_VERTEX_KERNEL_h
+
+#include "Transform.h"
+#include "Viewport.h"
+
+namespace IntegerWorld
+{
+	namespace VertexKernel
+	{
+		/// <summary>
+		/// Vertices processed per kernel call.
+		/// Small on MCUs to keep the working set in registers, larger on hosts to let the compiler vectorize the inner loops.
+		/// </summary>
+#if defined(ARDUINO)
+		static constexpr uint8_t ChunkSize = 4;
+#else
+		static constexpr uint8_t ChunkSize = 16;
+#endif
+
+		/// <summary>
+		/// Fused object -> screen vertex path: load, scale, rotate, translate and project a chunk of vertices in one pass.
+		/// - Reads from the vertex source directly (PROGMEM safe), so the per-frame vertex copy can be skipped.
+		/// - Works on structure-of-arrays chunk buffers, one short loop per step.
+		/// - Output matches ApplyTransform followed by ViewportProjector::Project, and may alias the source.
+		/// </summary>
+		/// <param name="transform">Fused object -> camera transform, see CalculateObjectCameraTransform.</param>
+		/// <param name="projector">Viewport projector for the frame.</param>
+		/// <param name="source">Vertex source with GetVertex(index).</param>
+		/// <param name="output">Projected vertices for [start, start + count).</param>
+		/// <param name="start">First source vertex index.</param>
+		/// <param name="count">Vertex count, up to ChunkSize.</param>
+		template<typename VertexSourceType>
+		static void TransformProject(const transform16_scale_rotate_translate_t& transform,
+			const ViewportProjector& projector,
+			const VertexSourceType& source,
+			vertex16_t* output,
+			const primitive_index_t start,
+			const uint8_t count)
+		{
+			int32_t x[ChunkSize];
+			int32_t y[ChunkSize];
+			int32_t z[ChunkSize];
+
+			// Load.
+			for (uint_fast8_t i = 0; i < count; i++)
+			{
+				const vertex16_t vertex = source.GetVertex(start + i);
+				x[i] = vertex.x;
+				y[i] = vertex.y;
+				z[i] = vertex.z;
+			}
+
+			// Scale.
+			if (transform.Resize != Scale16::SCALE_1X)
+			{
+				const scale16_t resize = transform.Resize;
+				for (uint_fast8_t i = 0; i < count; i++)
+				{
+					x[i] = Scale(resize, static_cast<int16_t>(x[i]));
+					y[i] = Scale(resize, static_cast<int16_t>(y[i]));
+					z[i] = Scale(resize, static_cast<int16_t>(z[i]));
+				}
+			}
+
+			// Rotate and translate, one output axis per loop to keep the live matrix row small.
+			int16_t cx[ChunkSize];
+			int16_t cy[ChunkSize];
+			int16_t cz[ChunkSize];
+			{
+				const int32_t m0 = transform.Matrix[0][0], m1 = transform.Matrix[0][1], m2 = transform.Matrix[0][2];
+				const int16_t translation = transform.Translation.x;
+				for (uint_fast8_t i = 0; i < count; i++)
+					cx[i] = static_cast<int16_t>(static_cast<int16_t>(SignedRightShift((m0 * x[i]) + (m1 * y[i]) + (m2 * z[i]), TRANSFORM16_MATRIX_SHIFTS)) + translation);
+			}
+			{
+				const int32_t m0 = transform.Matrix[1][0], m1 = transform.Matrix[1][1], m2 = transform.Matrix[1][2];
+				const int16_t translation = transform.Translation.y;
+				for (uint_fast8_t i = 0; i < count; i++)
+					cy[i] = static_cast<int16_t>(static_cast<int16_t>(SignedRightShift((m0 * x[i]) + (m1 * y[i]) + (m2 * z[i]), TRANSFORM16_MATRIX_SHIFTS)) + translation);
+			}
+			{
+				const int32_t m0 = transform.Matrix[2][0], m1 = transform.Matrix[2][1], m2 = transform.Matrix[2][2];
+				const int16_t translation = transform.Translation.z;
+				for (uint_fast8_t i = 0; i < count; i++)
+					cz[i] = static_cast<int16_t>(static_cast<int16_t>(SignedRightShift((m0 * x[i]) + (m1 * y[i]) + (m2 * z[i]), TRANSFORM16_MATRIX_SHIFTS)) + translation);
+			}
+
+			// Project and store.
+			for (uint_fast8_t i = 0; i < count; i++)
+			{
+				vertex16_t vertex{ cx[i], cy[i], cz[i] };
+				projector.Project(vertex);
+				output[i] = vertex;
+			}
+		}
+	}
+}
+#endif
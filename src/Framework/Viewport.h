@@ -2,9 +2,23 @@
 #define _INTEGER_WORLD_VIEWPORT_h
 
 #include "../Framework/Model.h"
+#include "../Framework/Reciprocal.h"
+
+// Cores without a hardware divider (Cortex-M0/M0+) project with the depth reciprocal.
+#if !defined(INTEGER_WORLD_PROJECTION_RECIPROCAL) && !defined(INTEGER_WORLD_PROJECTION_DIVISION) && defined(__ARM_ARCH_6M__)
+#define INTEGER_WORLD_PROJECTION_RECIPROCAL
+#endif
 
 namespace IntegerWorld
 {
+	/// <summary>
+	/// Camera to screen projector and view frustum builder.
+	/// Projection divides by depth (ProjectExact), unless INTEGER_WORLD_PROJECTION_RECIPROCAL is defined:
+	/// then it multiplies by a fixed-point reciprocal of depth (ProjectReciprocal, see Reciprocal),
+	/// within 1 pixel of the division path for on-screen vertices.
+	/// The reciprocal path is enabled by default on cores without a hardware divider (__ARM_ARCH_6M__),
+	/// #define INTEGER_WORLD_PROJECTION_DIVISION to keep the division path there.
+	/// </summary>
 	class ViewportProjector
 	{
 	private:
@@ -15,6 +29,8 @@ namespace IntegerWorld
 		static constexpr uint8_t DownShift = GetBitShifts(Range);
 		static constexpr uint8_t UnitShift = GetBitShifts(VERTEX16_UNIT);
 
+		static constexpr uint32_t DistanceNumVerticalMax = UINT32_MAX / (static_cast<uint32_t>(INT16_MAX) + 1);
+
 	private:
 		// Near plane corners in world space.
 		vertex16_t topLeft{};
@@ -36,6 +52,10 @@ namespace IntegerWorld
 
 		uint16_t distanceNum = (static_cast<uint32_t>(RangeMin) + RangeMax) / 2;
 
+		// distanceNum scaled by the aspect ratio (verticalNum / verticalDenum), for the vertical axis.
+		// Capped at DistanceNumVerticalMax, so |y| * distanceNumVertical fits in 32 bits.
+		uint32_t distanceNumVertical = distanceNum;
+
 		uint16_t drawDistance = RangeMax;
 
 		uint8_t frustumShifts = 5;
@@ -50,6 +70,7 @@ namespace IntegerWorld
 			ViewWidthHalf = MinValue<uint16_t>(INT16_MAX, static_cast<uint16_t>(viewWidth) >> 1);
 			ViewHeightHalf = MinValue<uint16_t>(INT16_MAX, static_cast<uint16_t>(viewHeight) >> 1);
 			frustumShifts = UnitShift - GetBitShifts(MaxValue<uint16_t>(viewWidth, viewHeight) / 2);
+			UpdateVerticalScale();
 		}
 
 		/// <summary>
@@ -58,6 +79,7 @@ namespace IntegerWorld
 		void SetFov(const ufraction16_t fovFraction)
 		{
 			distanceNum = RangeMin + Fraction(static_cast<ufraction16_t>(UFRACTION16_1X - fovFraction), Range);
+			UpdateVerticalScale();
 		}
 
 		void SetDrawDistance(const uint16_t distance)
@@ -80,9 +102,17 @@ namespace IntegerWorld
 		{
 			// Set frustum culling radius squared.
 			frustum.radiusSquared = (static_cast<uint32_t>(drawDistance) * drawDistance);
+			frustum.radius = drawDistance;
+
+			// Same scale as Project, for projected sizes.
+			frustum.projectionScale = static_cast<uint32_t>(distanceNum) * ViewWidthHalf;
+			frustum.projectionShifts = DownShift;
 
 			// Set frustum origin to apparent camera position.
 			frustum.origin = cameraControls.Position;
+#if defined(INTEGER_WORLD_LARGE_WORLD)
+			frustum.worldOrigin = cameraControls.WorldPosition;
+#endif
 
 			// Set the camera rotation.
 			frustum.rotation = cameraControls.Rotation;
@@ -138,7 +168,57 @@ namespace IntegerWorld
 			CalculatePlane(frustum.origin, bottomLeft, bottomRight, frustum.cullingBottomPlane);
 		}
 
-		void Project(vertex16_t& cameraToscreen)
+		/// <summary>
+		/// Projects a camera-space vertex to screen space, with z set to the view depth.
+		/// </summary>
+		void Project(vertex16_t& cameraToscreen) const
+		{
+#if defined(INTEGER_WORLD_PROJECTION_RECIPROCAL)
+			ProjectReciprocal(cameraToscreen);
+#else
+			ProjectExact(cameraToscreen);
+#endif
+		}
+
+		/// <summary>
+		/// Projection with one reciprocal of depth per vertex, shared by both axes, and no divisions.
+		/// </summary>
+		void ProjectReciprocal(vertex16_t& cameraToscreen) const
+		{
+			const int32_t distanceDenum = static_cast<int32_t>(distanceNum) + cameraToscreen.z;
+
+			int32_t ix, iy;
+			if (distanceDenum == 0)
+			{
+				ix = SignedRightShift(static_cast<int32_t>(cameraToscreen.x) * ViewWidthHalf, DownShift);
+
+				iy = (static_cast<int32_t>(cameraToscreen.y) * verticalNum) / verticalDenum;
+				iy = SignedRightShift(iy * ViewHeightHalf, DownShift);
+			}
+			else
+			{
+				// distanceDenum is in (-2^15, 2^16), so its magnitude fits the 16 bit reciprocal.
+				const bool negative = distanceDenum < 0;
+				uint8_t shifts;
+				const uint16_t reciprocal = Reciprocal::Get(static_cast<uint16_t>(negative ? -distanceDenum : distanceDenum), shifts);
+
+				ix = MultiplyReciprocal(cameraToscreen.x, distanceNum, reciprocal, shifts, negative);
+				ix = SignedRightShift(ix * ViewWidthHalf, DownShift);
+
+				iy = MultiplyReciprocal(cameraToscreen.y, distanceNumVertical, reciprocal, shifts, negative);
+				iy = SignedRightShift(iy * ViewHeightHalf, DownShift);
+			}
+
+			// Convert to screen space (top-left is (0,0).
+			cameraToscreen.x = ViewWidthHalf - static_cast<int16_t>(ix);
+			cameraToscreen.y = ViewHeightHalf - static_cast<int16_t>(iy);
+			cameraToscreen.z = distanceDenum;
+		}
+
+		/// <summary>
+		/// Reference projection with exact integer divisions.
+		/// </summary>
+		void ProjectExact(vertex16_t& cameraToscreen) const
 		{
 			const int32_t distanceDenum = static_cast<int32_t>(distanceNum) + cameraToscreen.z;
 
@@ -167,6 +247,36 @@ namespace IntegerWorld
 		}
 
 	private:
+		void UpdateVerticalScale()
+		{
+			if (verticalDenum > 0)
+				distanceNumVertical = MinValue(DistanceNumVerticalMax, (static_cast<uint32_t>(distanceNum) * verticalNum) / verticalDenum);
+			else
+				distanceNumVertical = distanceNum;
+		}
+
+		/// <summary>
+		/// Truncating (value * scale / divisor), with the divisor given as its reciprocal and sign.
+		/// The 32 bit product magnitude is multiplied by the 16 bit reciprocal in two 16x16 halves, without 64 bit math.
+		/// </summary>
+		static int32_t MultiplyReciprocal(const int16_t value, const uint32_t scale, const uint16_t reciprocal, const uint8_t shifts, const bool negativeDivisor)
+		{
+			const bool negative = (value < 0) != negativeDivisor;
+			const uint32_t numerator = static_cast<uint32_t>(value < 0 ? -static_cast<int32_t>(value) : value) * scale;
+
+			const uint32_t high = static_cast<uint32_t>(static_cast<uint16_t>(numerator >> 16)) * reciprocal;
+			const uint32_t low = static_cast<uint32_t>(static_cast<uint16_t>(numerator)) * reciprocal;
+
+			// shifts is at least 15, only a divisor of 1 gives 15.
+			uint32_t magnitude;
+			if (shifts >= 16)
+				magnitude = (high + (low >> 16)) >> (shifts - 16);
+			else
+				magnitude = (high << (16 - shifts)) + (low >> shifts);
+
+			return negative ? -static_cast<int32_t>(magnitude) : static_cast<int32_t>(magnitude);
+		}
+
 		/// <summary>
 		/// Calculate the four corners of the plane using the center point and the right/up vectors
 		/// </summary>
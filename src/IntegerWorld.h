@@ -4,6 +4,7 @@
 // Core framework interfaces.
 #include "Framework/Interface.h"
 #include "Framework/Model.h"
+#include "Framework/AssetPack.h"
 
 // Primitives for shaders.
 #include "Shaders/Primitive/TriangleSampler.h"
@@ -13,6 +14,9 @@
 // Template building blocks for render objects.
 #include "PrimitiveSources/Vertex.h"
 #include "PrimitiveSources/Triangle.h"
+#include "PrimitiveSources/Meshlet.h"
+#include "PrimitiveSources/Morph.h"
+#include "PrimitiveSources/Skin.h"
 #include "PrimitiveSources/Albedo.h"
 #include "PrimitiveSources/Material.h"
 #include "PrimitiveSources/Normal.h"
@@ -50,6 +54,12 @@
 // Mesh render objects.
 #include "RenderObjects/Mesh/AbstractObject.h"
 #include "RenderObjects/Mesh/TriangleShadeObject.h"
+#include "RenderObjects/Mesh/MeshletObject.h"
+#include "RenderObjects/Mesh/LodObject.h"
+#include "RenderObjects/Mesh/InstancedObject.h"
+#include "RenderObjects/Mesh/StreamingObject.h"
+#include "RenderObjects/Mesh/MorphObject.h"
+#include "RenderObjects/Mesh/SkinnedObject.h"
 #include "RenderObjects/Mesh/VertexShadeObject.h"
 #include "RenderObjects/Mesh/PixelShaders.h"
 #include "RenderObjects/Mesh/FragmentShaders.h"
@@ -57,6 +67,7 @@
 // Scene shaders, including lights.
 #include "SceneShaders/Abstract.h"
 #include "SceneShaders/LightSource/Model.h"
+#include "SceneShaders/LightSource/Cluster.h"
 #include "SceneShaders/LightSource/Shader.h"
 #include "SceneShaders/Normal/Shader.h"
 
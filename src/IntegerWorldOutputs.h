@@ -4,4 +4,7 @@
 // Generic mock surface for testing.
 #include "OutputSurfaces/MockSurface.h"
 
+// In-memory frame buffer surface.
+#include "OutputSurfaces/FrameBufferSurface.h"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,9 @@
+#ifndef _INTEGER_WORLD_PARALLEL_INCLUDE_h
+#define _INTEGER_WORLD_PARALLEL_INCLUDE_h
+
+// Host-only multi-threaded rendering backends (requires std::thread).
+#include "OutputSurfaces/FrameBufferSurface.h"
+#include "Engine/ThreadStageExecutor.h"
+#include "Engine/TileRasterizer.h"
+
+#endif
@@ -2,6 +2,8 @@
 #define _INTEGER_WORLD_TASKS_INCLUDE_h
 
 #include "Engine/EngineRenderTask.h"
+#include "Engine/StageExecutor.h"
+#include "Engine/ObjectBvh.h"
 #include "Engine/PerformanceLogTask.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,268 @@
+#ifndef _INTEGER_WORLD_FRAME_BUFFER_SURFACE_h
+#define _INTEGER_WORLD_FRAME_BUFFER_SURFACE_h
+
+#include "../Framework/Interface.h"
+
+namespace IntegerWorld
+{
+	namespace FrameBufferOutput
+	{
+		/// <summary>
+		/// In-memory surface that draws into an externally owned Rgb8 color buffer.
+		/// - Reports the full buffer dimensions, so window clipping is the same for every view of the buffer.
+		/// - Discards any pixel outside its scissor rectangle, so several views can draw disjoint tiles of the same buffer concurrently.
+		/// - All drawing and blending is integer-only and deterministic.
+		/// </summary>
+		class BufferSurface : public IOutputSurface
+		{
+		protected:
+			Rgb8::color_t* Buffer;
+
+			const int16_t BufferWidth;
+			const int16_t BufferHeight;
+
+		private:
+			// Scissor rectangle [Left, Right) x [Top, Bottom).
+			int16_t Left = 0;
+			int16_t Top = 0;
+			int16_t Right;
+			int16_t Bottom;
+
+		public:
+			BufferSurface(Rgb8::color_t* buffer, const int16_t width, const int16_t height)
+				: IOutputSurface()
+				, Buffer(buffer)
+				, BufferWidth(width)
+				, BufferHeight(height)
+				, Right(width)
+				, Bottom(height)
+			{
+			}
+
+			/// <summary>
+			/// Restricts drawing to [x, x + width) x [y, y + height), limited to the buffer.
+			/// </summary>
+			void SetScissor(const int16_t x, const int16_t y, const int16_t width, const int16_t height)
+			{
+				Left = LimitValue<int16_t>(x, 0, BufferWidth);
+				Top = LimitValue<int16_t>(y, 0, BufferHeight);
+				Right = LimitValue<int16_t>(x + width, Left, BufferWidth);
+				Bottom = LimitValue<int16_t>(y + height, Top, BufferHeight);
+			}
+
+			/// <summary>
+			/// Removes the scissor, drawing to the whole buffer.
+			/// </summary>
+			void ClearScissor()
+			{
+				Left = 0;
+				Top = 0;
+				Right = BufferWidth;
+				Bottom = BufferHeight;
+			}
+
+			Rgb8::color_t* GetBuffer() const
+			{
+				return Buffer;
+			}
+
+			int16_t GetWidth() const
+			{
+				return BufferWidth;
+			}
+
+			int16_t GetHeight() const
+			{
+				return BufferHeight;
+			}
+
+		public:// Buffer managment interface.
+			bool StartSurface() override { return Buffer != nullptr; }
+			void StopSurface() override {}
+			bool IsSurfaceReady() override { return Buffer != nullptr; }
+			void FlipSurface() override {}
+
+		public:// Buffer window interface.
+			void GetSurfaceDimensions(int16_t& width, int16_t& height, uint8_t& colorDepth) final
+			{
+				width = BufferWidth;
+				height = BufferHeight;
+				colorDepth = 24;
+			}
+
+		public:// Buffer drawing interface.
+			void Pixel(const Rgb8::color_t color, const int16_t x, const int16_t y) final
+			{
+				if (IsInsideScissor(x, y))
+				{
+					Buffer[Index(x, y)] = color;
+				}
+			}
+
+			void Line(const Rgb8::color_t color, const int16_t x1, const int16_t y1, const int16_t x2, const int16_t y2) final
+			{
+				const int16_t dx = AbsValue<int16_t>(x2 - x1);
+				const int16_t dy = -AbsValue<int16_t>(y2 - y1);
+				const int8_t sx = x1 < x2 ? 1 : -1;
+				const int8_t sy = y1 < y2 ? 1 : -1;
+
+				int32_t error = int32_t(dx) + dy;
+				int16_t x = x1;
+				int16_t y = y1;
+				while (true)
+				{
+					if (IsInsideScissor(x, y))
+						Buffer[Index(x, y)] = color;
+
+					if (x == x2 && y == y2)
+						break;
+
+					const int32_t error2 = error * 2;
+					if (error2 >= dy) { error += dy; x += sx; }
+					if (error2 <= dx) { error += dx; y += sy; }
+				}
+			}
+
+			void TriangleFill(const Rgb8::color_t color, const int16_t x1, const int16_t y1, const int16_t x2, const int16_t y2, const int16_t x3, const int16_t y3) final
+			{
+				const int16_t xStart = MaxValue<int16_t>(Left, MinValue(x1, MinValue(x2, x3)));
+				const int16_t xEnd = MinValue<int16_t>(Right - 1, MaxValue(x1, MaxValue(x2, x3)));
+				const int16_t yStart = MaxValue<int16_t>(Top, MinValue(y1, MinValue(y2, y3)));
+				const int16_t yEnd = MinValue<int16_t>(Bottom - 1, MaxValue(y1, MaxValue(y2, y3)));
+
+				for (int_fast16_t y = yStart; y <= yEnd; y++)
+				{
+					for (int_fast16_t x = xStart; x <= xEnd; x++)
+					{
+						if (TriangleRasterHelper::PointInTriangle(x, y, x1, y1, x2, y2, x3, y3))
+						{
+							Buffer[Index(x, y)] = color;
+						}
+					}
+				}
+			}
+
+			void RectangleFill(const Rgb8::color_t color, const int16_t x1, const int16_t y1, const int16_t x2, const int16_t y2) final
+			{
+				const int16_t xStart = MaxValue<int16_t>(Left, MinValue(x1, x2));
+				const int16_t xEnd = MinValue<int16_t>(Right - 1, MaxValue(x1, x2));
+				const int16_t yStart = MaxValue<int16_t>(Top, MinValue(y1, y2));
+				const int16_t yEnd = MinValue<int16_t>(Bottom - 1, MaxValue(y1, y2));
+
+				for (int_fast16_t y = yStart; y <= yEnd; y++)
+				{
+					for (int_fast16_t x = xStart; x <= xEnd; x++)
+					{
+						Buffer[Index(x, y)] = color;
+					}
+				}
+			}
+
+			void PixelBlendAlpha(const Rgb8::color_t color, const int16_t x, const int16_t y) final
+			{
+				if (IsInsideScissor(x, y))
+				{
+					const Rgb8::color_t destination = Buffer[Index(x, y)];
+					const uint16_t alpha = Rgb8::Alpha(color);
+					const uint16_t inverse = Rgb8::COMPONENT_MAX - alpha;
+
+					Buffer[Index(x, y)] = Rgb8::Color(
+						static_cast<uint8_t>((uint16_t(Rgb8::Red(color)) * alpha + uint16_t(Rgb8::Red(destination)) * inverse) / Rgb8::COMPONENT_MAX),
+						static_cast<uint8_t>((uint16_t(Rgb8::Green(color)) * alpha + uint16_t(Rgb8::Green(destination)) * inverse) / Rgb8::COMPONENT_MAX),
+						static_cast<uint8_t>((uint16_t(Rgb8::Blue(color)) * alpha + uint16_t(Rgb8::Blue(destination)) * inverse) / Rgb8::COMPONENT_MAX));
+				}
+			}
+
+			void PixelBlendAdd(const Rgb8::color_t color, const int16_t x, const int16_t y) final
+			{
+				if (IsInsideScissor(x, y))
+				{
+					const Rgb8::color_t destination = Buffer[Index(x, y)];
+
+					Buffer[Index(x, y)] = Rgb8::Color(
+						static_cast<uint8_t>(MinValue<uint16_t>(Rgb8::COMPONENT_MAX, uint16_t(Rgb8::Red(color)) + Rgb8::Red(destination))),
+						static_cast<uint8_t>(MinValue<uint16_t>(Rgb8::COMPONENT_MAX, uint16_t(Rgb8::Green(color)) + Rgb8::Green(destination))),
+						static_cast<uint8_t>(MinValue<uint16_t>(Rgb8::COMPONENT_MAX, uint16_t(Rgb8::Blue(color)) + Rgb8::Blue(destination))));
+				}
+			}
+
+			void PixelBlendSubtract(const Rgb8::color_t color, const int16_t x, const int16_t y) final
+			{
+				if (IsInsideScissor(x, y))
+				{
+					const Rgb8::color_t destination = Buffer[Index(x, y)];
+
+					Buffer[Index(x, y)] = Rgb8::Color(
+						static_cast<uint8_t>(MaxValue<int16_t>(0, int16_t(Rgb8::Red(destination)) - Rgb8::Red(color))),
+						static_cast<uint8_t>(MaxValue<int16_t>(0, int16_t(Rgb8::Green(destination)) - Rgb8::Green(color))),
+						static_cast<uint8_t>(MaxValue<int16_t>(0, int16_t(Rgb8::Blue(destination)) - Rgb8::Blue(color))));
+				}
+			}
+
+			void PixelBlendMultiply(const Rgb8::color_t color, const int16_t x, const int16_t y) final
+			{
+				if (IsInsideScissor(x, y))
+				{
+					const Rgb8::color_t destination = Buffer[Index(x, y)];
+
+					Buffer[Index(x, y)] = Rgb8::Color(
+						static_cast<uint8_t>((uint16_t(Rgb8::Red(color)) * Rgb8::Red(destination)) / Rgb8::COMPONENT_MAX),
+						static_cast<uint8_t>((uint16_t(Rgb8::Green(color)) * Rgb8::Green(destination)) / Rgb8::COMPONENT_MAX),
+						static_cast<uint8_t>((uint16_t(Rgb8::Blue(color)) * Rgb8::Blue(destination)) / Rgb8::COMPONENT_MAX));
+				}
+			}
+
+			void PixelBlendScreen(const Rgb8::color_t color, const int16_t x, const int16_t y) final
+			{
+				if (IsInsideScissor(x, y))
+				{
+					const Rgb8::color_t destination = Buffer[Index(x, y)];
+
+					Buffer[Index(x, y)] = Rgb8::Color(
+						static_cast<uint8_t>(Rgb8::COMPONENT_MAX - ((uint16_t(Rgb8::COMPONENT_MAX - Rgb8::Red(color)) * (Rgb8::COMPONENT_MAX - Rgb8::Red(destination))) / Rgb8::COMPONENT_MAX)),
+						static_cast<uint8_t>(Rgb8::COMPONENT_MAX - ((uint16_t(Rgb8::COMPONENT_MAX - Rgb8::Green(color)) * (Rgb8::COMPONENT_MAX - Rgb8::Green(destination))) / Rgb8::COMPONENT_MAX)),
+						static_cast<uint8_t>(Rgb8::COMPONENT_MAX - ((uint16_t(Rgb8::COMPONENT_MAX - Rgb8::Blue(color)) * (Rgb8::COMPONENT_MAX - Rgb8::Blue(destination))) / Rgb8::COMPONENT_MAX)));
+				}
+			}
+
+		private:
+			bool IsInsideScissor(const int16_t x, const int16_t y) const
+			{
+				return x >= Left && x < Right
+					&& y >= Top && y < Bottom;
+			}
+
+			uint32_t Index(const int16_t x, const int16_t y) const
+			{
+				return (uint32_t(y) * uint16_t(BufferWidth)) + x;
+			}
+		};
+
+		/// <summary>
+		/// Frame buffer surface that owns its color buffer.
+		/// Large frames should be allocated statically or on the heap.
+		/// </summary>
+		/// <typeparam name="surfaceWidth">Frame width in pixels.</typeparam>
+		/// <typeparam name="surfaceHeight">Frame height in pixels.</typeparam>
+		template<uint16_t surfaceWidth, uint16_t surfaceHeight>
+		class OutputSurface : public BufferSurface
+		{
+		private:
+			Rgb8::color_t Frame[uint32_t(surfaceWidth) * surfaceHeight]{};
+
+		public:
+			OutputSurface()
+				: BufferSurface(Frame, surfaceWidth, surfaceHeight)
+			{
+			}
+
+#if defined(ARDUINO)
+			void PrintName(Print& serial)
+			{
+				serial.print(F("Frame Buffer"));
+			}
+#endif
+		};
+	}
+}
+#endif
@@ -22,7 +22,7 @@ namespace IntegerWorld
 					/// <summary>
 					/// Returns a reference to an edge line from ROM.
 					/// </summary>
-					const edge_line_t GetEdge(const uint16_t index) const
+					const edge_line_t GetEdge(const primitive_index_t index) const
 					{
 #if defined(ARDUINO_ARCH_AVR)
 						return edge_line_t{
@@ -50,7 +50,7 @@ namespace IntegerWorld
 					/// <summary>
 					/// Returns a reference to an edge line from RAM.
 					/// </summary>
-					const edge_line_t& GetEdge(const uint16_t index) const
+					const edge_line_t& GetEdge(const primitive_index_t index) const
 					{
 						return Edges[index];
 					}
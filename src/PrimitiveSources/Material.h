@@ -27,7 +27,7 @@ namespace IntegerWorld
 						return true;
 					}
 
-					static constexpr material_t GetMaterial(const uint16_t /*index*/)
+					static constexpr material_t GetMaterial(const primitive_index_t /*index*/)
 					{
 						return StaticMaterial;
 					}
@@ -51,7 +51,7 @@ namespace IntegerWorld
 
 
 #if defined(ARDUINO_ARCH_AVR)
-					const material_t& GetMaterial(const uint16_t index)
+					const material_t& GetMaterial(const primitive_index_t index)
 					{
 						MaterialBuffer.Emit = static_cast<ufraction8_t>(pgm_read_byte(&Materials[index].Emit));
 						MaterialBuffer.Rough = static_cast<ufraction8_t>(pgm_read_byte(&Materials[index].Rough));
@@ -62,7 +62,7 @@ namespace IntegerWorld
 						return MaterialBuffer;
 					}
 #else
-					const material_t& GetMaterial(const uint16_t index) const
+					const material_t& GetMaterial(const primitive_index_t index) const
 					{
 						return Materials[index];
 					}
@@ -91,7 +91,7 @@ namespace IntegerWorld
 
 
 #if defined(ARDUINO_ARCH_AVR)
-					const material_t& GetMaterial(const uint16_t index)
+					const material_t& GetMaterial(const primitive_index_t index)
 					{
 						MaterialBuffer.Emit = static_cast<ufraction8_t>(pgm_read_byte(&Materials[index].Emit));
 						MaterialBuffer.Rough = static_cast<ufraction8_t>(pgm_read_byte(&Materials[index].Rough));
@@ -103,7 +103,7 @@ namespace IntegerWorld
 						return MaterialBuffer;
 					}
 #else
-					const material_t& GetMaterial(const uint16_t index) const
+					const material_t& GetMaterial(const primitive_index_t index) const
 					{
 						const uint8_t palleteIndex = PalleteIndexes[index];
 						return Materials[palleteIndex];
@@ -123,7 +123,7 @@ namespace IntegerWorld
 						return true;
 					}
 
-					const material_t& GetMaterial(const uint16_t index) const
+					const material_t& GetMaterial(const primitive_index_t index) const
 					{
 						return Material;
 					}
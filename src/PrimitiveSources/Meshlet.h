@@ -0,0 +1,74 @@
+#ifndef _INTEGER_WORLD_PRIMITIVE_SOURCES_MESHLET_h
+#define _INTEGER_WORLD_PRIMITIVE_SOURCES_MESHLET_h
+
+#include "../Framework/Model.h"
+
+namespace IntegerWorld
+{
+	namespace PrimitiveSources
+	{
+		namespace Meshlet
+		{
+			namespace Static
+			{
+				class Source
+				{
+				private:
+					const meshlet_t* Meshlets = nullptr;
+
+				public:
+					Source(const meshlet_t* meshlets) : Meshlets(meshlets) {}
+
+					/// <summary>
+					/// Returns a meshlet from ROM.
+					/// </summary>
+					meshlet_t GetMeshlet(const uint16_t index) const
+					{
+#if defined(ARDUINO_ARCH_AVR)
+						return meshlet_t{
+							{
+								static_cast<int16_t>(pgm_read_word(&Meshlets[index].center.x)),
+								static_cast<int16_t>(pgm_read_word(&Meshlets[index].center.y)),
+								static_cast<int16_t>(pgm_read_word(&Meshlets[index].center.z))
+							},
+							static_cast<uint16_t>(pgm_read_word(&Meshlets[index].radius)),
+							{
+								static_cast<int16_t>(pgm_read_word(&Meshlets[index].coneAxis.x)),
+								static_cast<int16_t>(pgm_read_word(&Meshlets[index].coneAxis.y)),
+								static_cast<int16_t>(pgm_read_word(&Meshlets[index].coneAxis.z))
+							},
+							static_cast<ufraction16_t>(pgm_read_word(&Meshlets[index].coneCutoff)),
+							static_cast<uint16_t>(pgm_read_word(&Meshlets[index].firstTriangle)),
+							static_cast<uint16_t>(pgm_read_word(&Meshlets[index].triangleCount))
+						};
+#else
+						return Meshlets[index];
+#endif
+					}
+				};
+			}
+
+			namespace Dynamic
+			{
+				class Source
+				{
+				private:
+					// External meshlet array.
+					meshlet_t* Meshlets = nullptr;
+
+				public:
+					Source(meshlet_t* meshlets) : Meshlets(meshlets) {}
+
+					/// <summary>
+					/// Returns a reference to a meshlet from RAM.
+					/// </summary>
+					const meshlet_t& GetMeshlet(const uint16_t index) const
+					{
+						return Meshlets[index];
+					}
+				};
+			}
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,98 @@
+#ifndef _INTEGER_WORLD_PRIMITIVE_SOURCES_MORPH_h
+#define _INTEGER_WORLD_PRIMITIVE_SOURCES_MORPH_h
+
+#include "../Framework/Model.h"
+
+namespace IntegerWorld
+{
+	namespace PrimitiveSources
+	{
+		namespace Morph
+		{
+			namespace Static
+			{
+				class Source
+				{
+				private:
+					const morph_target_t* Targets = nullptr;
+					const morph_delta_t* Deltas = nullptr;
+
+				public:
+					Source(const morph_target_t* targets, const morph_delta_t* deltas)
+						: Targets(targets)
+						, Deltas(deltas)
+					{
+					}
+
+					/// <summary>
+					/// Returns a morph target from ROM.
+					/// </summary>
+					morph_target_t GetTarget(const uint8_t index) const
+					{
+#if defined(ARDUINO_ARCH_AVR)
+						return morph_target_t{
+							static_cast<uint16_t>(pgm_read_word(&Targets[index].firstDelta)),
+							static_cast<uint16_t>(pgm_read_word(&Targets[index].deltaCount)),
+							static_cast<uint8_t>(pgm_read_byte(&Targets[index].shift))
+						};
+#else
+						return Targets[index];
+#endif
+					}
+
+					/// <summary>
+					/// Returns a morph delta from ROM.
+					/// </summary>
+					morph_delta_t GetDelta(const uint16_t index) const
+					{
+#if defined(ARDUINO_ARCH_AVR)
+						return morph_delta_t{
+							static_cast<uint16_t>(pgm_read_word(&Deltas[index].vertex)),
+							static_cast<int8_t>(pgm_read_byte(&Deltas[index].x)),
+							static_cast<int8_t>(pgm_read_byte(&Deltas[index].y)),
+							static_cast<int8_t>(pgm_read_byte(&Deltas[index].z))
+						};
+#else
+						return Deltas[index];
+#endif
+					}
+				};
+			}
+
+			namespace Dynamic
+			{
+				class Source
+				{
+				private:
+					// External morph target and delta arrays.
+					morph_target_t* Targets = nullptr;
+					morph_delta_t* Deltas = nullptr;
+
+				public:
+					Source(morph_target_t* targets, morph_delta_t* deltas)
+						: Targets(targets)
+						, Deltas(deltas)
+					{
+					}
+
+					/// <summary>
+					/// Returns a reference to a morph target from RAM.
+					/// </summary>
+					const morph_target_t& GetTarget(const uint8_t index) const
+					{
+						return Targets[index];
+					}
+
+					/// <summary>
+					/// Returns a reference to a morph delta from RAM.
+					/// </summary>
+					const morph_delta_t& GetDelta(const uint16_t index) const
+					{
+						return Deltas[index];
+					}
+				};
+			}
+		}
+	}
+}
+#endif
\ No newline at end of file
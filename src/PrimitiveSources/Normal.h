@@ -23,7 +23,7 @@ namespace IntegerWorld
 					/// </summary>
 					/// <param name="index"></param>
 					/// <returns></returns>
-					static constexpr vertex16_t GetNormal(const uint16_t index)
+					static constexpr vertex16_t GetNormal(const primitive_index_t index)
 					{
 						return vertex16_t{ 0, 0, 0 };
 					}
@@ -42,7 +42,7 @@ namespace IntegerWorld
 					/// <summary>
 					/// Returns a copy of the fixed normal vector.
 					/// 
-					static constexpr vertex16_t GetNormal(const uint16_t index)
+					static constexpr vertex16_t GetNormal(const primitive_index_t index)
 					{
 						return Normal;
 					}
@@ -65,7 +65,7 @@ namespace IntegerWorld
 					/// <summary>
 					/// Returns a copy of a precomputed triangle normal from ROM.
 					/// </summary>
-					const vertex16_t GetNormal(const uint16_t index) const
+					const vertex16_t GetNormal(const primitive_index_t index) const
 					{
 						return vertex16_t{
 							static_cast<int16_t>(pgm_read_word(&NormalsSource[index].x)),
@@ -77,7 +77,7 @@ namespace IntegerWorld
 					/// <summary>
 					/// Returns a reference to a precomputed triangle normal from ROM.
 					/// </summary>
-					const vertex16_t& GetNormal(const uint16_t index) const
+					const vertex16_t& GetNormal(const primitive_index_t index) const
 					{
 						return NormalsSource[index];
 					}
@@ -103,7 +103,7 @@ namespace IntegerWorld
 					/// <summary>
 					/// Returns a reference to a precomputed triangle normal from RAM.
 					/// 
-					const vertex16_t& GetNormal(const uint16_t index) const
+					const vertex16_t& GetNormal(const primitive_index_t index) const
 					{
 						return NormalsSource[index];
 					}
@@ -125,7 +125,7 @@ namespace IntegerWorld
 					{
 					}
 
-					const vertex16_t& GetNormal(const uint16_t index) const
+					const vertex16_t& GetNormal(const primitive_index_t index) const
 					{
 						return Normal;
 					}
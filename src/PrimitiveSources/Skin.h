@@ -0,0 +1,72 @@
+#ifndef _INTEGER_WORLD_PRIMITIVE_SOURCES_SKIN_h
+#define _INTEGER_WORLD_PRIMITIVE_SOURCES_SKIN_h
+
+#include "../Framework/Model.h"
+
+namespace IntegerWorld
+{
+	namespace PrimitiveSources
+	{
+		namespace Skin
+		{
+			namespace Static
+			{
+				class Source
+				{
+				private:
+					const skin_vertex_t* Skins = nullptr;
+
+				public:
+					Source(const skin_vertex_t* skins) : Skins(skins) {}
+
+					/// <summary>
+					/// Returns a vertex skin from ROM.
+					/// </summary>
+					skin_vertex_t GetSkin(const primitive_index_t index) const
+					{
+#if defined(ARDUINO_ARCH_AVR)
+						return skin_vertex_t{
+							{
+								static_cast<uint8_t>(pgm_read_byte(&Skins[index].bones[0])),
+								static_cast<uint8_t>(pgm_read_byte(&Skins[index].bones[1])),
+								static_cast<uint8_t>(pgm_read_byte(&Skins[index].bones[2])),
+								static_cast<uint8_t>(pgm_read_byte(&Skins[index].bones[3]))
+							},
+							{
+								static_cast<ufraction8_t>(pgm_read_byte(&Skins[index].weights[0])),
+								static_cast<ufraction8_t>(pgm_read_byte(&Skins[index].weights[1])),
+								static_cast<ufraction8_t>(pgm_read_byte(&Skins[index].weights[2])),
+								static_cast<ufraction8_t>(pgm_read_byte(&Skins[index].weights[3]))
+							}
+						};
+#else
+						return Skins[index];
+#endif
+					}
+				};
+			}
+
+			namespace Dynamic
+			{
+				class Source
+				{
+				private:
+					// External skin array.
+					skin_vertex_t* Skins = nullptr;
+
+				public:
+					Source(skin_vertex_t* skins) : Skins(skins) {}
+
+					/// <summary>
+					/// Returns a reference to a vertex skin from RAM.
+					/// </summary>
+					const skin_vertex_t& GetSkin(const primitive_index_t index) const
+					{
+						return Skins[index];
+					}
+				};
+			}
+		}
+	}
+}
+#endif
\ No newline at end of file
@@ -17,12 +17,12 @@ namespace IntegerWorld
 					const triangle_face_t* Triangles = nullptr;
 
 				public:
-					Source(const triangle_face_t* triangles) : Triangles(triangles) {}
+					Source(const triangle_face_t* triangles = nullptr) : Triangles(triangles) {}
 
 					/// <summary>
 					/// Returns a triangle face from ROM. 
 					/// </summary>
-					triangle_face_t GetTriangle(const uint16_t index) const
+					triangle_face_t GetTriangle(const primitive_index_t index) const
 					{
 #if defined(ARDUINO_ARCH_AVR)
 						return triangle_face_t{
@@ -32,6 +32,57 @@ namespace IntegerWorld
 						};
 #else
 						return Triangles[index];
+#endif
+					}
+				};
+
+				/// <summary>
+				/// Triangle faces from ROM with 8-bit indices, for meshes of up to 256 vertices.
+				/// </summary>
+				class Uint8Source
+				{
+				private:
+					const triangle8_face_t* Triangles = nullptr;
+
+				public:
+					Uint8Source(const triangle8_face_t* triangles = nullptr) : Triangles(triangles) {}
+
+					triangle_face_t GetTriangle(const primitive_index_t index) const
+					{
+#if defined(ARDUINO_ARCH_AVR)
+						return triangle_face_t{
+							static_cast<uint16_t>(pgm_read_byte(&Triangles[index].a)),
+							static_cast<uint16_t>(pgm_read_byte(&Triangles[index].b)),
+							static_cast<uint16_t>(pgm_read_byte(&Triangles[index].c))
+						};
+#else
+						return triangle_face_t{ Triangles[index].a, Triangles[index].b, Triangles[index].c };
+#endif
+					}
+				};
+
+				/// <summary>
+				/// Triangle faces with 32-bit indices, for meshes beyond 65535 vertices.
+				/// Needs INTEGER_WORLD_INDEX32 to address them, see primitive_index_t.
+				/// </summary>
+				class Uint32Source
+				{
+				private:
+					const triangle32_face_t* Triangles = nullptr;
+
+				public:
+					Uint32Source(const triangle32_face_t* triangles = nullptr) : Triangles(triangles) {}
+
+					triangle32_face_t GetTriangle(const primitive_index_t index) const
+					{
+#if defined(ARDUINO_ARCH_AVR)
+						return triangle32_face_t{
+							static_cast<uint32_t>(pgm_read_dword(&Triangles[index].a)),
+							static_cast<uint32_t>(pgm_read_dword(&Triangles[index].b)),
+							static_cast<uint32_t>(pgm_read_dword(&Triangles[index].c))
+						};
+#else
+						return Triangles[index];
 #endif
 					}
 				};
@@ -51,7 +102,7 @@ namespace IntegerWorld
 					/// <summary>
 					/// Returns a reference to a triangle face from RAM.
 					/// </summary>
-					const triangle_face_t& GetTriangle(const uint16_t index) const
+					const triangle_face_t& GetTriangle(const primitive_index_t index) const
 					{
 						return Triangles[index];
 					}
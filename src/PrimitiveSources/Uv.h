@@ -18,7 +18,7 @@ namespace IntegerWorld
 						return false;
 					}
 
-					static constexpr triangle_uv_t GetUvs(const uint16_t triangleIndex)
+					static constexpr triangle_uv_t GetUvs(const primitive_index_t triangleIndex)
 					{
 						return triangle_uv_t{
 							uv_t{ 0, 0 },
@@ -45,7 +45,7 @@ namespace IntegerWorld
 					}
 
 #if defined(ARDUINO_ARCH_AVR)
-					const triangle_uv_t& GetUvs(const uint16_t triangleIndex)
+					const triangle_uv_t& GetUvs(const primitive_index_t triangleIndex)
 					{
 						const size_t baseIndex = static_cast<size_t>(triangleIndex) * 3;
 
@@ -59,7 +59,7 @@ namespace IntegerWorld
 						return Uvs;
 					}
 #else
-					triangle_uv_t GetUvs(const uint16_t triangleIndex) const
+					triangle_uv_t GetUvs(const primitive_index_t triangleIndex) const
 					{
 						const size_t baseIndex = static_cast<size_t>(triangleIndex) * 3;
 
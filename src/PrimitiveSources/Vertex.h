@@ -17,9 +17,9 @@ namespace IntegerWorld
 					const vertex16_t* Vertices = nullptr;
 
 				public:
-					Source(const vertex16_t* vertices) : Vertices(vertices) {}
+					Source(const vertex16_t* vertices = nullptr) : Vertices(vertices) {}
 
-					vertex16_t GetVertex(const uint16_t index) const
+					vertex16_t GetVertex(const primitive_index_t index) const
 					{
 #if defined(ARDUINO_ARCH_AVR)
 						return vertex16_t{
@@ -29,6 +29,41 @@ namespace IntegerWorld
 						};
 #else
 						return Vertices[index];
+#endif
+					}
+				};
+
+				/// <summary>
+				/// Quantized vertices from ROM, for meshes with modest precision needs.
+				/// Each int8 coordinate is scaled by the mesh's ScaleShift on read, before any transform.
+				/// </summary>
+				class Int8Source
+				{
+				private:
+					const vertex8_t* Vertices = nullptr;
+					uint8_t ScaleShift = 0;
+
+				public:
+					Int8Source(const vertex8_t* vertices = nullptr, const uint8_t scaleShift = 0)
+						: Vertices(vertices)
+						, ScaleShift(scaleShift)
+					{
+					}
+
+					vertex16_t GetVertex(const primitive_index_t index) const
+					{
+#if defined(ARDUINO_ARCH_AVR)
+						return vertex16_t{
+							SignedLeftShift(static_cast<int16_t>(static_cast<int8_t>(pgm_read_byte(&Vertices[index].x))), ScaleShift),
+							SignedLeftShift(static_cast<int16_t>(static_cast<int8_t>(pgm_read_byte(&Vertices[index].y))), ScaleShift),
+							SignedLeftShift(static_cast<int16_t>(static_cast<int8_t>(pgm_read_byte(&Vertices[index].z))), ScaleShift)
+						};
+#else
+						return vertex16_t{
+							SignedLeftShift(static_cast<int16_t>(Vertices[index].x), ScaleShift),
+							SignedLeftShift(static_cast<int16_t>(Vertices[index].y), ScaleShift),
+							SignedLeftShift(static_cast<int16_t>(Vertices[index].z), ScaleShift)
+						};
 #endif
 					}
 				};
@@ -47,7 +82,7 @@ namespace IntegerWorld
 						: Vertices(vertices) {
 					}
 
-					vertex16_t GetVertex(const uint16_t index) const
+					vertex16_t GetVertex(const primitive_index_t index) const
 					{
 						return Vertices[index];
 					}
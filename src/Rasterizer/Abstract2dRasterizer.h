@@ -23,6 +23,10 @@ namespace IntegerWorld
 		using Abstract2dDrawer<SurfaceType>::Surface;
 		using Abstract2dDrawer<SurfaceType>::SurfaceWidth;
 		using Abstract2dDrawer<SurfaceType>::SurfaceHeight;
+		using Abstract2dDrawer<SurfaceType>::ScissorLeft;
+		using Abstract2dDrawer<SurfaceType>::ScissorTop;
+		using Abstract2dDrawer<SurfaceType>::ScissorRight;
+		using Abstract2dDrawer<SurfaceType>::ScissorBottom;
 		using Abstract2dDrawer<SurfaceType>::IsInsideWindow;
 		using Abstract2dDrawer<SurfaceType>::ClipEndpointToWindow;
 		using Abstract2dDrawer<SurfaceType>::ClipTriangleToWindow;
@@ -282,8 +286,11 @@ namespace IntegerWorld
 			// Degenerate (all vertices share Y): single scanline fill.
 			if (y0 == y2)
 			{
-				const int16_t xStart = MinValue<int16_t>(x0, MinValue<int16_t>(x1, x2));
-				const int16_t xEnd = MaxValue<int16_t>(x0, MaxValue<int16_t>(x1, x2));
+				if (y0 < ScissorTop || y0 >= ScissorBottom)
+					return;
+
+				const int16_t xStart = MaxValue<int16_t>(ScissorLeft, MinValue<int16_t>(x0, MinValue<int16_t>(x1, x2)));
+				const int16_t xEnd = MinValue<int16_t>(ScissorRight - 1, MaxValue<int16_t>(x0, MaxValue<int16_t>(x1, x2)));
 
 				for (int_fast16_t x = xStart; x <= xEnd; x++)
 				{
@@ -318,11 +325,20 @@ namespace IntegerWorld
 				int32_t fxLeft = fx0;
 				int32_t fxRight = fx0;
 
-				for (int_fast16_t y = y0; y < y1; y++)
+				// Skip scanlines above the scissor, stepping the edges as if they were rasterized.
+				const int16_t yStart = MaxValue<int16_t>(y0, ScissorTop);
+				const int16_t yEnd = MinValue<int16_t>(y1, ScissorBottom);
+				if (yStart > y0)
+				{
+					fxLeft += stepLeft * (yStart - y0);
+					fxRight += stepRight * (yStart - y0);
+				}
+
+				for (int_fast16_t y = yStart; y < yEnd; y++)
 				{
 					// Top-left rule: left edge ceil, right edge ceil - 1 (half-open on the right).
-					const int16_t startX = BresenhamSpace::FixedCeilToInt(fxLeft);
-					const int16_t endX = BresenhamSpace::FixedCeilToInt(fxRight) - 1;
+					const int16_t startX = MaxValue<int16_t>(ScissorLeft, BresenhamSpace::FixedCeilToInt(fxLeft));
+					const int16_t endX = MinValue<int16_t>(ScissorRight - 1, BresenhamSpace::FixedCeilToInt(fxRight) - 1);
 
 					if (startX <= endX)
 					{
@@ -344,11 +360,20 @@ namespace IntegerWorld
 				int32_t fxLeft = longEdgeIsLeft ? (fx0 + dxLong * hTop) : fx1;
 				int32_t fxRight = longEdgeIsLeft ? fx1 : (fx0 + dxLong * hTop);
 
-				for (int_fast16_t y = y1; y < y2; y++)
+				// Skip scanlines above the scissor, stepping the edges as if they were rasterized.
+				const int16_t yStart = MaxValue<int16_t>(y1, ScissorTop);
+				const int16_t yEnd = MinValue<int16_t>(y2, ScissorBottom);
+				if (yStart > y1)
+				{
+					fxLeft += stepLeft * (yStart - y1);
+					fxRight += stepRight * (yStart - y1);
+				}
+
+				for (int_fast16_t y = yStart; y < yEnd; y++)
 				{
 					// Top-left rule: left edge ceil, right edge ceil - 1 (half-open on the right).
-					const int16_t startX = BresenhamSpace::FixedCeilToInt(fxLeft);
-					const int16_t endX = BresenhamSpace::FixedCeilToInt(fxRight) - 1;
+					const int16_t startX = MaxValue<int16_t>(ScissorLeft, BresenhamSpace::FixedCeilToInt(fxLeft));
+					const int16_t endX = MinValue<int16_t>(ScissorRight - 1, BresenhamSpace::FixedCeilToInt(fxRight) - 1);
 
 					if (startX <= endX)
 					{
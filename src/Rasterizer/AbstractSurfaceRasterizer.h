@@ -109,6 +109,13 @@ namespace IntegerWorld
 		int16_t SurfaceWidth = 1;
 		int16_t SurfaceHeight = 1;
 
+		// Optional scissor rectangle [Left, Right) x [Top, Bottom), applied on top of the window.
+		// Window clipping stays on the full surface, so scissored rasterization is pixel-exact with unscissored.
+		int16_t ScissorLeft = 0;
+		int16_t ScissorTop = 0;
+		int16_t ScissorRight = INT16_MAX;
+		int16_t ScissorBottom = INT16_MAX;
+
 		SurfaceType& Surface;
 
 	public:
@@ -133,6 +140,34 @@ namespace IntegerWorld
 			return SurfaceHeight;
 		}
 
+		/// <summary>
+		/// Restricts rasterization to the rectangle [x, x + width) x [y, y + height).
+		/// Used to split a frame into tiles that are rendered independently.
+		/// The surface is still expected to discard any pixel outside the scissor.
+		/// </summary>
+		/// <param name="x">Left edge of the scissor.</param>
+		/// <param name="y">Top edge of the scissor.</param>
+		/// <param name="width">Scissor width in pixels.</param>
+		/// <param name="height">Scissor height in pixels.</param>
+		void SetScissor(const int16_t x, const int16_t y, const int16_t width, const int16_t height)
+		{
+			ScissorLeft = x;
+			ScissorTop = y;
+			ScissorRight = x + width;
+			ScissorBottom = y + height;
+		}
+
+		/// <summary>
+		/// Removes the scissor, rasterizing to the whole window.
+		/// </summary>
+		void ClearScissor()
+		{
+			ScissorLeft = 0;
+			ScissorTop = 0;
+			ScissorRight = INT16_MAX;
+			ScissorBottom = INT16_MAX;
+		}
+
 	protected:
 		/// <summary>
 		/// Determines whether the specified 2D point (x, y) is within the current drawing window boundaries.
@@ -2,6 +2,7 @@
 #define _INTEGER_WORLD_RENDER_OBJECTS_ABSTRACT_OBJECT_h
 
 #include "../Framework/Interface.h"
+#include "../Framework/VertexKernel.h"
 
 #include "../PrimitiveSources/Vertex.h"
 #include "../PrimitiveSources/Triangle.h"
@@ -25,7 +26,7 @@ namespace IntegerWorld
 			AbstractObject() : IRenderObject() {}
 
 			// Default implementation since most objects do not have per-vertex animation.
-			virtual bool VertexShade(const uint16_t vertexIndex)
+			virtual bool VertexShade(const primitive_index_t vertexIndex)
 			{
 				return true;
 			}
@@ -33,22 +34,69 @@ namespace IntegerWorld
 
 		/// <summary>
 		/// Render Object with only translation.
+		/// With INTEGER_WORLD_LARGE_WORLD, the object is placed at WorldTranslation + Translation
+		/// and rebased to the camera world origin in 32-bit before narrowing to 16-bit WorldPosition.
 		/// </summary>
 		class AbstractTranslationObject : public AbstractObject
 		{
 		public:
 			vertex16_t Translation{};
+#if defined(INTEGER_WORLD_LARGE_WORLD)
+			vertex32_t WorldTranslation{};
+#endif
 
 		protected:
 			vertex16_t WorldPosition{};
 
+#if defined(INTEGER_WORLD_LARGE_WORLD)
+		private:
+			// Set on ObjectShade when the rebased position doesn't fit in 16-bit render space.
+			bool OutOfRange = false;
+#endif
+
 		public:
 			AbstractTranslationObject() : AbstractObject() {}
 
 			virtual void ObjectShade(const frustum_t& frustum)
+			{
+				UpdateWorldPosition(frustum);
+			}
+
+		protected:
+			/// <summary>
+			/// Places the object in render space, sets WorldPosition.
+			/// </summary>
+			void UpdateWorldPosition(const frustum_t& frustum)
 			{
 				// Apply world transform to object.
+#if defined(INTEGER_WORLD_LARGE_WORLD)
+				const int32_t x = (WorldTranslation.x - frustum.worldOrigin.x) + Translation.x;
+				const int32_t y = (WorldTranslation.y - frustum.worldOrigin.y) + Translation.y;
+				const int32_t z = (WorldTranslation.z - frustum.worldOrigin.z) + Translation.z;
+
+				OutOfRange = x < -VERTEX16_RANGE || x > VERTEX16_RANGE
+					|| y < -VERTEX16_RANGE || y > VERTEX16_RANGE
+					|| z < -VERTEX16_RANGE || z > VERTEX16_RANGE;
+
+				WorldPosition.x = static_cast<int16_t>(LimitValue<int32_t>(x, -VERTEX16_RANGE, VERTEX16_RANGE));
+				WorldPosition.y = static_cast<int16_t>(LimitValue<int32_t>(y, -VERTEX16_RANGE, VERTEX16_RANGE));
+				WorldPosition.z = static_cast<int16_t>(LimitValue<int32_t>(z, -VERTEX16_RANGE, VERTEX16_RANGE));
+#else
 				WorldPosition = Translation;
+#endif
+			}
+
+			/// <summary>
+			/// True when the object can't be placed in 16-bit render space this frame and must be culled on ObjectShade.
+			/// Always false without INTEGER_WORLD_LARGE_WORLD.
+			/// </summary>
+			bool IsOutOfRange() const
+			{
+#if defined(INTEGER_WORLD_LARGE_WORLD)
+				return OutOfRange;
+#else
+				return false;
+#endif
 			}
 		};
 
@@ -81,9 +129,12 @@ namespace IntegerWorld
 		/// <summary>
 		/// Abstract render object with vertices and primitives' z cache.
 		/// Implements world, camera transform and screen projection passes.
+		/// Objects that don't read world-space vertices in WorldShade can set FusedCameraTransform in ObjectShade:
+		/// WorldTransform is skipped, CameraTransform only composes the object -> camera transform,
+		/// and ScreenProject transforms and projects vertices in chunks with VertexKernel::TransformProject.
 		/// </summary>
-		template<uint16_t vertexCount,
-			uint16_t primitiveCount>
+		template<primitive_index_t vertexCount,
+			primitive_index_t primitiveCount>
 		class TemplateTransformObject : public AbstractTransformObject
 		{
 		protected:
@@ -91,15 +142,30 @@ namespace IntegerWorld
 			int16_t Primitives[primitiveCount]{};
 
 		protected:
-			uint16_t VertexCount = vertexCount;
+			primitive_index_t VertexCount = vertexCount;
+
+			// Skip world space for vertices, see class summary. MeshTransform is replaced by the fused transform on CameraTransform.
+			bool FusedCameraTransform = false;
+
+		protected:
+			/// <summary>
+			/// Fused vertex path: transforms and projects vertices [start, start + count) into Vertices.
+			/// Reads object-space vertices from Vertices by default; objects with a vertex source can read it directly instead.
+			/// </summary>
+			virtual void TransformProjectVertices(const ViewportProjector& screenProjector, const primitive_index_t start, const uint8_t count)
+			{
+				VertexKernel::TransformProject(MeshTransform, screenProjector,
+					PrimitiveSources::Vertex::Dynamic::Source(Vertices), &Vertices[start], start, count);
+			}
 
 		public:
 			TemplateTransformObject() : AbstractTransformObject() {}
 
 		public:
-			virtual bool WorldTransform(const uint16_t vertexIndex)
+			virtual bool WorldTransform(const primitive_index_t vertexIndex)
 			{
-				if (vertexIndex >= VertexCount)
+				if (FusedCameraTransform
+					|| vertexIndex >= VertexCount)
 					return true;
 
 				ApplyTransform(MeshTransform, Vertices[vertexIndex]);
@@ -107,8 +173,16 @@ namespace IntegerWorld
 				return false;
 			}
 
-			virtual bool CameraTransform(const transform16_camera_t& transform, const uint16_t vertexIndex)
+			virtual bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex)
 			{
+				if (FusedCameraTransform)
+				{
+					// Vertices are transformed together with projection.
+					CalculateObjectCameraTransform(MeshTransform, MeshTransform, transform);
+
+					return true;
+				}
+
 				if (vertexIndex >= VertexCount)
 					return true;
 
@@ -117,8 +191,21 @@ namespace IntegerWorld
 				return false;
 			}
 
-			virtual bool ScreenProject(ViewportProjector& screenProjector, const uint16_t vertexIndex)
+			virtual bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex)
 			{
+				if (FusedCameraTransform)
+				{
+					// Index is the vertex chunk.
+					const uint32_t start = static_cast<uint32_t>(vertexIndex) * VertexKernel::ChunkSize;
+					if (start >= VertexCount)
+						return true;
+
+					TransformProjectVertices(screenProjector, static_cast<primitive_index_t>(start),
+						static_cast<uint8_t>(MinValue<uint32_t>(VertexKernel::ChunkSize, VertexCount - start)));
+
+					return false;
+				}
+
 				if (vertexIndex >= VertexCount)
 					return true;
 
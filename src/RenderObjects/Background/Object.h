@@ -21,19 +21,19 @@ namespace IntegerWorld
 				FillObject() : IRenderObject() {}
 
 				void ObjectShade(const frustum_t& frustum) {}
-				bool VertexShade(const uint16_t vertexIndex) { return true; }
-				bool WorldTransform(const uint16_t vertexIndex) { return true; }
-				bool WorldShade(const frustum_t& frustum, const uint16_t primitiveIndex) { return true; }
-				bool CameraTransform(const transform16_camera_t& transform, const uint16_t vertexIndex) { return true; }
-				bool ScreenProject(ViewportProjector& screenProjector, const uint16_t vertexIndex) { return true; }
-				bool ScreenShade(const uint16_t primitiveIndex) { return true; }
+				bool VertexShade(const primitive_index_t vertexIndex) { return true; }
+				bool WorldTransform(const primitive_index_t vertexIndex) { return true; }
+				bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex) { return true; }
+				bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex) { return true; }
+				bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex) { return true; }
+				bool ScreenShade(const primitive_index_t primitiveIndex) { return true; }
 
 				void FragmentCollect(FragmentCollector& fragmentCollector)
 				{
 					fragmentCollector.AddFragment(0, MinValue<int32_t>(VERTEX16_RANGE, static_cast<int32_t>(VERTEX16_RANGE) + ZOffset));
 				}
 
-				void FragmentShade(WindowRasterizer& rasterizer, const uint16_t primitiveIndex) final
+				void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex) final
 				{
 					if (primitiveIndex == 0)
 					{
@@ -102,7 +102,8 @@ namespace IntegerWorld
 					ProportionCopy = Proportion;
 
 					// Simple frustum culling based on the center point.
-					if (frustum.IsPointInside(WorldPosition))
+					if (!IsOutOfRange()
+						&& frustum.IsPointInside(WorldPosition))
 					{
 						Primitive = 0;
 					}
@@ -112,9 +113,9 @@ namespace IntegerWorld
 					}
 				}
 
-				bool WorldTransform(const uint16_t vertexIndex) { return true; }
+				bool WorldTransform(const primitive_index_t vertexIndex) { return true; }
 
-				bool WorldShade(const frustum_t& frustum, const uint16_t primitiveIndex)
+				bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex)
 				{
 					//TODO: Apply scene lighting.
 					PrimitiveColor = Albedo;
@@ -122,7 +123,7 @@ namespace IntegerWorld
 					return true;
 				}
 
-				bool CameraTransform(const transform16_camera_t& transform, const uint16_t vertexIndex)
+				bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex)
 				{
 					if (Primitive < 0)
 						return true;
@@ -140,7 +141,7 @@ namespace IntegerWorld
 					return true;
 				}
 
-				bool ScreenProject(ViewportProjector& screenProjector, const uint16_t vertexIndex)
+				bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex)
 				{
 					screenProjector.Project(ScreenPosition);
 					screenProjector.Project(Top);
@@ -148,7 +149,7 @@ namespace IntegerWorld
 					return true;
 				}
 
-				bool ScreenShade(const uint16_t primitiveIndex)
+				bool ScreenShade(const primitive_index_t primitiveIndex)
 				{
 					if (Primitive < 0)
 						return true;
@@ -207,7 +208,7 @@ namespace IntegerWorld
 					}
 				}
 
-				void FragmentShade(WindowRasterizer& rasterizer, const uint16_t primitiveIndex) final
+				void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex) final
 				{
 					if (primitiveIndex == 0)
 					{
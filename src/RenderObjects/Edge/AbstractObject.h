@@ -42,7 +42,7 @@ namespace IntegerWorld
 				vertex16_t ScreenPosition{};
 
 			protected:
-				uint16_t EdgeCount = edgeCount;
+				primitive_index_t EdgeCount = edgeCount;
 
 			public:
 				AbstractObject(VertexSourceType& vertexSource,
@@ -95,6 +95,15 @@ namespace IntegerWorld
 						break;
 					};
 
+					if (Base::IsOutOfRange())
+					{
+						zFlag = -VERTEX16_UNIT;
+						for (uint_fast16_t i = 0; i < EdgeCount; i++)
+						{
+							Primitives[i] = zFlag;
+						}
+					}
+
 					if (zFlag >= 0)
 					{
 						for (uint_fast16_t i = 0; i < VertexCount; i++)
@@ -108,7 +117,7 @@ namespace IntegerWorld
 					}
 				}
 
-				virtual bool CameraTransform(const transform16_camera_t& transform, const uint16_t vertexIndex)
+				virtual bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex)
 				{
 					if (vertexIndex == 0)
 						ApplyCameraTransform(transform, ScreenPosition);
@@ -116,7 +125,7 @@ namespace IntegerWorld
 					return Base::CameraTransform(transform, vertexIndex);
 				}
 
-				virtual bool ScreenProject(ViewportProjector& screenProjector, const uint16_t vertexIndex)
+				virtual bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex)
 				{
 					if (vertexIndex == 0)
 						screenProjector.Project(ScreenPosition);
@@ -130,7 +139,7 @@ namespace IntegerWorld
 				/// - Emits a z key (average vertex z) for depth ordering when the primitive is visible.
 				/// </summary>
 				/// <returns>false to continue; true when no more primitives are available.</returns>
-				virtual bool ScreenShade(const uint16_t primitiveIndex)
+				virtual bool ScreenShade(const primitive_index_t primitiveIndex)
 				{
 					if (primitiveIndex >= EdgeCount)
 						return true;
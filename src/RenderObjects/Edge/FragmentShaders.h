@@ -27,17 +27,17 @@ namespace IntegerWorld
 
 					struct ColorInterpolateShader : IFragmentShader<edge_vertex_fragment_t>
 					{
-						PixelShaders::VertexColorInterpolate PixelShader{};
-
 						void FragmentShade(WindowRasterizer& rasterizer, const edge_vertex_fragment_t& fragment)
 						{
-							if (PixelShader.SetFragmentData(
+							PixelShaders::VertexColorInterpolate pixelShader{};
+
+							if (pixelShader.SetFragmentData(
 								fragment.vertexA,
 								fragment.vertexB,
 								Rgb8::Color(fragment.redA, fragment.greenA, fragment.blueA),
 								Rgb8::Color(fragment.redB, fragment.greenB, fragment.blueB)))
 							{
-								rasterizer.RasterLine(fragment.vertexA, fragment.vertexB, PixelShader);
+								rasterizer.RasterLine(fragment.vertexA, fragment.vertexB, pixelShader);
 							}
 						}
 					};
@@ -54,14 +54,13 @@ namespace IntegerWorld
 
 					class ZInterpolateShader : public IFragmentShader<edge_line_fragment_t>
 					{
-					private:
-						PixelShaders::ZInterpolate<edge_line_fragment_t> PixelShader{};
-
 					public:
 						void FragmentShade(WindowRasterizer& rasterizer, const edge_line_fragment_t& fragment)
 						{
-							PixelShader.SetFragmentData(fragment);
-							rasterizer.RasterLine(fragment.vertexA, fragment.vertexB, PixelShader);
+							PixelShaders::ZInterpolate<edge_line_fragment_t> pixelShader{};
+
+							pixelShader.SetFragmentData(fragment);
+							rasterizer.RasterLine(fragment.vertexA, fragment.vertexB, pixelShader);
 						}
 					};
 				}
@@ -71,33 +70,31 @@ namespace IntegerWorld
 					template<pixel_blend_mode_t blendMode = pixel_blend_mode_t::Replace>
 					class ColorInterpolateShader : public IFragmentShader<edge_vertex_fragment_t>
 					{
-					private:
-						PixelShaders::VertexColorInterpolate PixelShader{};
-
 					public:
 						void FragmentShade(WindowRasterizer& rasterizer, const edge_vertex_fragment_t& fragment)
 						{
-							if (PixelShader.SetFragmentData(
+							PixelShaders::VertexColorInterpolate pixelShader{};
+
+							if (pixelShader.SetFragmentData(
 								fragment.vertexA,
 								fragment.vertexB,
 								Rgb8::Color(fragment.redA, fragment.greenA, fragment.blueA),
 								Rgb8::Color(fragment.redB, fragment.greenB, fragment.blueB)))
 							{
-								rasterizer.RasterLine(fragment.vertexA, fragment.vertexB, PixelShader);
+								rasterizer.RasterLine(fragment.vertexA, fragment.vertexB, pixelShader);
 							}
 						}
 					};
 
 					class ZInterpolateShader : public IFragmentShader<edge_vertex_fragment_t>
 					{
-					private:
-						PixelShaders::ZInterpolate<edge_vertex_fragment_t> PixelShader{};
-
 					public:
 						void FragmentShade(WindowRasterizer& rasterizer, const edge_vertex_fragment_t& fragment)
 						{
-							PixelShader.SetFragmentData(fragment);
-							rasterizer.RasterLine(fragment.vertexA, fragment.vertexB, PixelShader);
+							PixelShaders::ZInterpolate<edge_vertex_fragment_t> pixelShader{};
+
+							pixelShader.SetFragmentData(fragment);
+							rasterizer.RasterLine(fragment.vertexA, fragment.vertexB, pixelShader);
 						}
 					};
 				}
@@ -70,10 +70,6 @@ namespace IntegerWorld
 				// Per-triangle lit albedo colors.
 				CompactRgb8List<edgeCount> LightBuffer{};
 
-			private:
-				// Reusable edge fragment.
-				edge_line_fragment_t Fragment{};
-
 			public:
 				LineShadeObject(VertexSourceType& vertexSource,
 					EdgeSourceType& edgeSource,
@@ -93,7 +89,7 @@ namespace IntegerWorld
 				/// - Applies the scene shader to light the primitive's albedo color.
 				/// </summary>
 				/// <returns>false to continue processing; true when no more primitives are available.</returns>
-				virtual bool WorldShade(const frustum_t& frustum, const uint16_t primitiveIndex)
+				virtual bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex)
 				{
 					if (primitiveIndex >= EdgeCount)
 						return true;
@@ -176,26 +172,27 @@ namespace IntegerWorld
 				/// </summary>
 				/// <param name="rasterizer">Window rasterizer to receive the shaded edge.</param>
 				/// <param name="primitiveIndex">Edge index.</param>
-				virtual void FragmentShade(WindowRasterizer& rasterizer, const uint16_t primitiveIndex)
+				virtual void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex)
 				{
 					if (FragmentShader == nullptr)
 					{
 						return;
 					}
-					Fragment.index = primitiveIndex;
-					Fragment.z = Primitives[primitiveIndex];
+					edge_line_fragment_t fragment{};
+					fragment.index = primitiveIndex;
+					fragment.z = Primitives[primitiveIndex];
 					{
 						const auto edge = EdgeSource.GetEdge(primitiveIndex);
-						Fragment.vertexA = Vertices[edge.a];
-						Fragment.vertexB = Vertices[edge.b];
+						fragment.vertexA = Vertices[edge.a];
+						fragment.vertexB = Vertices[edge.b];
 					}
 					{
 						const auto color = LightBuffer.GetColor(primitiveIndex);
-						Fragment.red = Rgb8::Red(color);
-						Fragment.green = Rgb8::Green(color);
-						Fragment.blue = Rgb8::Blue(color);
+						fragment.red = Rgb8::Red(color);
+						fragment.green = Rgb8::Green(color);
+						fragment.blue = Rgb8::Blue(color);
 					}
-					FragmentShader->FragmentShade(rasterizer, Fragment);
+					FragmentShader->FragmentShade(rasterizer, fragment);
 				}
 			};
 
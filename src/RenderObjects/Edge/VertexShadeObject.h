@@ -70,9 +70,6 @@ namespace IntegerWorld
 				// Per-vertex lit albedo colors.
 				CompactRgb8List<vertexCount> LightBuffer{};
 
-				// Reusable edge fragment.
-				edge_vertex_fragment_t Fragment{};
-
 			public:
 				VertexShadeObject(VertexSourceType& vertexSource,
 					EdgeSourceType& edgeSource,
@@ -91,7 +88,7 @@ namespace IntegerWorld
 				/// - Applies the scene shader to light the primitive's albedo color.
 				/// </summary>
 				/// <returns>false to continue processing; true when no more primitives are available.</returns>
-				virtual bool WorldShade(const frustum_t& frustum, const uint16_t primitiveIndex)
+				virtual bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex)
 				{
 					if (primitiveIndex < EdgeCount
 						&&
@@ -174,7 +171,7 @@ namespace IntegerWorld
 				/// </summary>
 				/// <param name="rasterizer">Window rasterizer to receive the shaded edge.</param>
 				/// <param name="primitiveIndex">Edge index.</param>
-				virtual void FragmentShade(WindowRasterizer& rasterizer, const uint16_t primitiveIndex)
+				virtual void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex)
 				{
 					if (FragmentShader == nullptr)
 						return;
@@ -188,24 +185,25 @@ namespace IntegerWorld
 
 					const auto edge = EdgeSource.GetEdge(primitiveIndex);
 
-					Fragment.index = primitiveIndex;
-					Fragment.z = Primitives[primitiveIndex];
-					Fragment.vertexA = Vertices[edge.a];
-					Fragment.vertexB = Vertices[edge.b];
+					edge_vertex_fragment_t fragment{};
+					fragment.index = primitiveIndex;
+					fragment.z = Primitives[primitiveIndex];
+					fragment.vertexA = Vertices[edge.a];
+					fragment.vertexB = Vertices[edge.b];
 
 					{
 						auto color = LightBuffer.GetColor(edge.a);
-						Fragment.redA = Rgb8::Red(color);
-						Fragment.greenA = Rgb8::Green(color);
-						Fragment.blueA = Rgb8::Blue(color);
+						fragment.redA = Rgb8::Red(color);
+						fragment.greenA = Rgb8::Green(color);
+						fragment.blueA = Rgb8::Blue(color);
 
 						color = LightBuffer.GetColor(edge.b);
-						Fragment.redB = Rgb8::Red(color);
-						Fragment.greenB = Rgb8::Green(color);
-						Fragment.blueB = Rgb8::Blue(color);
+						fragment.redB = Rgb8::Red(color);
+						fragment.greenB = Rgb8::Green(color);
+						fragment.blueB = Rgb8::Blue(color);
 					}
 
-					FragmentShader->FragmentShade(rasterizer, Fragment);
+					FragmentShader->FragmentShade(rasterizer, fragment);
 				}
 			};
 
@@ -9,8 +9,92 @@ namespace IntegerWorld
 	{
 		namespace Mesh
 		{
-			template<uint16_t vertexCount,
-				uint16_t triangleCount,
+			/// <summary>
+			/// Primitive frustum culling from the triangle's vertex outcodes (see frustum_t::GetOutcode).
+			/// Triangles with all vertices outside the same plane are trivially rejected, all-inside triangles are accepted.
+			/// Otherwise the triangle is kept if any vertex is inside.
+			/// </summary>
+			/// <returns>True if the triangle is outside the frustum.</returns>
+			static bool IsOutcodeTriangleOutside(const uint8_t outcodeA, const uint8_t outcodeB, const uint8_t outcodeC)
+			{
+				if ((outcodeA & outcodeB & outcodeC) != 0)
+					return true;
+
+				if ((outcodeA | outcodeB | outcodeC) == 0)
+					return false;
+
+				return outcodeA != 0 && outcodeB != 0 && outcodeC != 0;
+			}
+
+			/// <summary>
+			/// Lights a triangle's albedo with the scene shader, from its world-space vertices.
+			/// The material and the precomputed normal (rotated by transform) are read at index, when the sources have them.
+			/// </summary>
+			template<typename MaterialSourceType, typename NormalSourceType>
+			static Rgb8::color_t GetTriangleLitColor(const ISceneShader& sceneShader, const object_lights_t& lights,
+				MaterialSourceType& materialSource, NormalSourceType& normalSource,
+				const transform16_scale_rotate_translate_t& transform, const primitive_index_t index,
+				const Rgb8::color_t albedo, const vertex16_t& a, const vertex16_t& b, const vertex16_t& c)
+			{
+				material_t material;
+				if (MaterialSourceType::HasMaterials())
+				{
+					material = materialSource.GetMaterial(index);
+				}
+				else
+				{
+					material = { 0, UFRACTION8_1X, 0, 0, 0, 0 };
+				}
+
+				vertex16_t worldNormal;
+				if (NormalSourceType::HasNormals())
+				{
+					// Rotate precomputed normal.
+					worldNormal = normalSource.GetNormal(index);
+					ApplyTransformRotation(transform, worldNormal);
+				}
+				else
+				{
+					// Calculate triangle normal.
+					worldNormal = GetNormal16(a, b, c);
+					NormalizeVertex16(worldNormal);
+				}
+
+				const vertex16_t worldPosition{
+						AverageApproximate(a.x, b.x, c.x),
+						AverageApproximate(a.y, b.y, c.y),
+						AverageApproximate(a.z, b.z, c.z) };
+
+				return sceneShader.GetObjectLitColor(albedo, material, worldPosition, worldNormal, lights);
+			}
+
+			/// <summary>
+			/// Bounding sphere around an object's translation, from its object-space radius scaled by resize.
+			/// NoCulling objects report no bounds, so they are never culled.
+			/// With INTEGER_WORLD_LARGE_WORLD the center is only known after rebasing, so there are no bounds
+			/// and the object culls itself on ObjectShade.
+			/// </summary>
+			/// <returns>True if the object has bounds.</returns>
+			template<FrustumCullingEnum frustumCulling>
+			static bool GetObjectBoundingSphere(const vertex16_t& translation, const scale16_t resize, const uint16_t boundingRadius,
+				vertex16_t& center, uint16_t& radius)
+			{
+#if defined(INTEGER_WORLD_LARGE_WORLD)
+				return false;
+#else
+				if (frustumCulling == FrustumCullingEnum::NoCulling
+					|| boundingRadius == 0)
+					return false;
+
+				center = translation;
+				radius = Scale(resize, boundingRadius);
+
+				return true;
+#endif
+			}
+
+			template<primitive_index_t vertexCount,
+				primitive_index_t triangleCount,
 				typename VertexSourceType,
 				typename TriangleSourceType,
 				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
@@ -24,12 +108,17 @@ namespace IntegerWorld
 			private:
 				using Base = TemplateTransformObject<vertexCount, triangleCount>;
 
+			protected:
+				// World-space face culling only rejects faces past ~2 degrees from edge-on.
+				static constexpr uint8_t FaceCullingMarginShift = 5;
+
 			protected:
 				using Base::Vertices;
 				using Base::Primitives;
 				using Base::WorldPosition;
 				using Base::VertexCount;
 				using Base::MeshTransform;
+				using Base::FusedCameraTransform;
 
 			protected:
 				VertexSourceType& VertexSource;
@@ -39,8 +128,37 @@ namespace IntegerWorld
 				NormalSourceType& NormalSource;
 				UvSourceType& UvSource;
 
+			public:
+				/// <summary>
+				/// Object-space bounding sphere radius around the object origin, before Resize.
+				/// 0 when unknown: object culling only tests the object origin and every primitive is frustum tested.
+				/// </summary>
+				uint16_t BoundingRadius = 0;
+
+				/// <summary>
+				/// Opt-in fused vertex path for unlit objects: vertices are transformed and projected straight from the vertex source.
+				/// The vertex buffer isn't loaded on ObjectShade, so objects that animate vertices in VertexShade must leave it off.
+				/// </summary>
+				bool FusedVertices = false;
+
 			protected:
-				uint16_t TriangleCount = triangleCount;
+				primitive_index_t TriangleCount = triangleCount;
+
+				// Bounding sphere is fully inside the frustum for this frame, primitive frustum tests are skipped.
+				bool PrimitivesInside = false;
+
+				// Whole object is culled for this frame, the vertex passes are skipped.
+				bool ObjectCulled = false;
+
+				// Per-vertex frustum outcodes, computed on WorldTransform for primitive culling.
+				uint8_t Outcodes[frustumCulling == FrustumCullingEnum::PrimitiveCulling ? vertexCount : 1]{};
+
+				// Frame frustum, valid from ObjectShade to WorldShade.
+				const frustum_t* CullingFrustum = nullptr;
+
+				// Vertex bits, set in WorldShade for primitives that survive frustum culling.
+				// Unused vertices skip the camera transform and projection.
+				uint8_t UsedVertices[frustumCulling == FrustumCullingEnum::PrimitiveCulling ? ((vertexCount + 7) / 8) : 1]{};
 
 			public:
 				AbstractObject(VertexSourceType& vertexSource,
@@ -63,39 +181,75 @@ namespace IntegerWorld
 				/// <summary>
 				/// Object pass:
 				/// - Applies object-level frustum culling and initializes primitive z flags.
+				///   With a BoundingRadius, objects outside the frustum are culled for any culling mode but NoCulling,
+				///   and objects fully inside skip primitive culling.
+				///   Culled objects skip the vertex passes: WorldTransform, CameraTransform and ScreenProject return done.
 				/// - Loads source vertices into the working buffer if the object is inside the frustum.
+				///   Skipped with FusedCameraTransform, the fused vertex path reads the source directly.
+				///   FusedCameraTransform is cleared when primitives need world-space frustum tests.
 				/// </summary>
 				virtual void ObjectShade(const frustum_t& frustum)
 				{
 					Base::ObjectShade(frustum);
 
 					int16_t zFlag = 0;
+					PrimitivesInside = false;
+					CullingFrustum = &frustum;
 
 					switch (frustumCulling)
 					{
 					case FrustumCullingEnum::ObjectCulling:
-						if (!frustum.IsPointInside(WorldPosition))
+					case FrustumCullingEnum::PrimitiveCulling:
+						if (BoundingRadius > 0)
 						{
-							zFlag = -VERTEX16_UNIT;
+							const uint16_t radius = Scale(Base::Resize, BoundingRadius);
+							if (!frustum.IsSphereInside(WorldPosition, radius))
+							{
+								zFlag = -VERTEX16_UNIT;
+							}
+							else
+							{
+								PrimitivesInside = frustum.IsSphereFullyInside(WorldPosition, radius);
+							}
 						}
-						for (uint_fast16_t i = 0; i < TriangleCount; i++)
+						else if (frustumCulling == FrustumCullingEnum::ObjectCulling
+							&& !frustum.IsPointInside(WorldPosition))
 						{
-							Primitives[i] = zFlag;
+							zFlag = -VERTEX16_UNIT;
 						}
 						break;
-					case FrustumCullingEnum::PrimitiveCulling:
 					case FrustumCullingEnum::NoCulling:
-						for (uint_fast16_t i = 0; i < TriangleCount; i++)
-						{
-							Primitives[i] = 0;
-						}
 					default:
 						break;
 					};
 
-					if (zFlag >= 0)
+					// Large-world objects beyond 16-bit render space are culled for any culling mode.
+					if (Base::IsOutOfRange())
+					{
+						zFlag = -VERTEX16_UNIT;
+					}
+
+					if (frustumCulling == FrustumCullingEnum::PrimitiveCulling
+						&& !PrimitivesInside)
+					{
+						FusedCameraTransform = false;
+						for (primitive_index_t i = 0; i < sizeof(UsedVertices); i++)
+						{
+							UsedVertices[i] = 0;
+						}
+					}
+
+					ObjectCulled = zFlag < 0;
+
+					for (primitive_index_t i = 0; i < TriangleCount; i++)
 					{
-						for (uint_fast16_t i = 0; i < VertexCount; i++)
+						Primitives[i] = zFlag;
+					}
+
+					if (!ObjectCulled
+						&& !FusedCameraTransform)
+					{
+						for (primitive_index_t i = 0; i < VertexCount; i++)
 						{
 							auto vertex = VertexSource.GetVertex(i);
 
@@ -106,13 +260,155 @@ namespace IntegerWorld
 					}
 				}
 
+				/// <summary>
+				/// World pass, per vertex: also caches the vertex frustum outcode when primitives need frustum culling.
+				/// Objects culled on ObjectShade return done before any transform or outcode.
+				/// </summary>
+				virtual bool WorldTransform(const primitive_index_t vertexIndex)
+				{
+					if (ObjectCulled
+						|| Base::WorldTransform(vertexIndex))
+						return true;
+
+					if (frustumCulling == FrustumCullingEnum::PrimitiveCulling
+						&& !PrimitivesInside)
+					{
+						Outcodes[vertexIndex] = CullingFrustum->GetOutcode(Vertices[vertexIndex]);
+					}
+
+					return false;
+				}
+
+				virtual bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex)
+				{
+					if (ObjectCulled)
+						return true;
+
+					if (IsVertexUnused(vertexIndex))
+						return false;
+
+					return Base::CameraTransform(transform, vertexIndex);
+				}
+
+				virtual bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex)
+				{
+					if (ObjectCulled)
+						return true;
+
+					if (IsVertexUnused(vertexIndex))
+						return false;
+
+					return Base::ScreenProject(screenProjector, vertexIndex);
+				}
+
+				/// <summary>
+				/// Bounding sphere around Translation, see GetObjectBoundingSphere.
+				/// </summary>
+				virtual bool GetBoundingSphere(vertex16_t& center, uint16_t& radius)
+				{
+					return GetObjectBoundingSphere<frustumCulling>(Base::Translation, Base::Resize, BoundingRadius, center, radius);
+				}
+
+			protected:
+				/// <summary>
+				/// Primitive frustum culling from the cached vertex outcodes, see IsOutcodeTriangleOutside.
+				/// </summary>
+				/// <returns>True if the triangle is outside the frustum.</returns>
+				template<typename face_t>
+				bool IsTriangleOutside(const face_t& triangle) const
+				{
+					if (PrimitivesInside)
+						return false;
+
+					return IsOutcodeTriangleOutside(Outcodes[triangle.a], Outcodes[triangle.b], Outcodes[triangle.c]);
+				}
+
+				/// <summary>
+				/// World-space face culling against the camera position, for world-space vertices.
+				/// Lets WorldShade skip lighting of culled faces, the projected winding test in ScreenShade still applies.
+				/// </summary>
+				/// <returns>True if the triangle faces the culled side.</returns>
+				template<typename face_t>
+				bool IsTriangleFaceCulled(const face_t& triangle, const vertex16_t& cameraPosition) const
+				{
+					if (faceCulling == FaceCullingEnum::NoCulling)
+						return false;
+
+					const vertex16_t normal = GetNormal16(Vertices[triangle.a], Vertices[triangle.b], Vertices[triangle.c]);
+
+					// View vector from the camera to the triangle, reduced so the dot product fits in 32 bits.
+					int32_t viewX = static_cast<int32_t>(Vertices[triangle.a].x) - cameraPosition.x;
+					int32_t viewY = static_cast<int32_t>(Vertices[triangle.a].y) - cameraPosition.y;
+					int32_t viewZ = static_cast<int32_t>(Vertices[triangle.a].z) - cameraPosition.z;
+					while (AbsValue(viewX) > (INT16_MAX / 2)
+						|| AbsValue(viewY) > (INT16_MAX / 2)
+						|| AbsValue(viewZ) > (INT16_MAX / 2))
+					{
+						viewX = SignedRightShift(viewX, 1);
+						viewY = SignedRightShift(viewY, 1);
+						viewZ = SignedRightShift(viewZ, 1);
+					}
+
+					const int32_t facing = DotProduct16(normal, vertex16_t{ static_cast<int16_t>(viewX), static_cast<int16_t>(viewY), static_cast<int16_t>(viewZ) });
+
+					// Near edge-on faces are left to the screen-space test, so rounding never culls a visible sliver.
+					const int32_t normalMax = MaxValue<int32_t>(MaxValue<int32_t>(AbsValue(normal.x), AbsValue(normal.y)), AbsValue(normal.z));
+					const int32_t viewMax = MaxValue<int32_t>(MaxValue<int32_t>(AbsValue(viewX), AbsValue(viewY)), AbsValue(viewZ));
+					const int32_t margin = (normalMax * viewMax) >> FaceCullingMarginShift;
+
+					switch (faceCulling)
+					{
+					case FaceCullingEnum::BackfaceCulling:
+						return facing > margin;
+					case FaceCullingEnum::FrontfaceCulling:
+						return facing < -margin;
+					default:
+						return false;
+					}
+				}
+
+				/// <summary>
+				/// Marks the triangle's vertices as used, after it survived frustum culling.
+				/// </summary>
+				template<typename face_t>
+				void SetVerticesUsed(const face_t& triangle)
+				{
+					if (frustumCulling == FrustumCullingEnum::PrimitiveCulling
+						&& !PrimitivesInside)
+					{
+						UsedVertices[triangle.a >> 3] |= 1 << (triangle.a & 7);
+						UsedVertices[triangle.b >> 3] |= 1 << (triangle.b & 7);
+						UsedVertices[triangle.c >> 3] |= 1 << (triangle.c & 7);
+					}
+				}
+
+			private:
+				/// <summary>
+				/// Vertices are only masked with primitive culling, when the object isn't fully inside the frustum.
+				/// </summary>
+				bool IsVertexUnused(const primitive_index_t vertexIndex) const
+				{
+					return frustumCulling == FrustumCullingEnum::PrimitiveCulling
+						&& !PrimitivesInside
+						&& vertexIndex < VertexCount
+						&& (UsedVertices[vertexIndex >> 3] & (1 << (vertexIndex & 7))) == 0;
+				}
+
+			protected:
+
+				virtual void TransformProjectVertices(const ViewportProjector& screenProjector, const primitive_index_t start, const uint8_t count)
+				{
+					VertexKernel::TransformProject(MeshTransform, screenProjector, VertexSource, &Vertices[start], start, count);
+				}
+
+			public:
 				/// <summary>
 				/// Screen pass:
 				/// - Applies mesh culling mode (backface/frontface/none) using projected 2D winding.
 				/// - Emits a z key (average vertex z) for depth ordering when the primitive is visible.
 				/// </summary>
 				/// <returns>false to continue; true when no more primitives are available.</returns>
-				virtual bool ScreenShade(const uint16_t primitiveIndex)
+				virtual bool ScreenShade(const primitive_index_t primitiveIndex)
 				{
 					if (primitiveIndex >= TriangleCount)
 						return true;
@@ -169,7 +465,7 @@ namespace IntegerWorld
 				/// </summary>
 				virtual void FragmentCollect(FragmentCollector& fragmentCollector) override
 				{
-					for (uint_fast16_t i = 0; i < TriangleCount; i++)
+					for (primitive_index_t i = 0; i < TriangleCount; i++)
 					{
 						if (Primitives[i] >= 0)
 						{
@@ -33,9 +33,12 @@ namespace IntegerWorld
 
 						void FragmentShade(WindowRasterizer& rasterizer, const fragment_t& fragment)
 						{
-							if (PixelShader.SetFragmentData(fragment))
+							// Per-fragment copy keeps the shader reentrant when fragments are rasterized concurrently.
+							TexturePixelShaderType pixelShader(PixelShader);
+
+							if (pixelShader.SetFragmentData(fragment))
 							{
-								rasterizer.RasterTriangle<blendMode>(fragment.vertexA, fragment.vertexB, fragment.vertexC, PixelShader);
+								rasterizer.RasterTriangle<blendMode>(fragment.vertexA, fragment.vertexB, fragment.vertexC, pixelShader);
 							}
 						}
 					};
@@ -69,15 +72,14 @@ namespace IntegerWorld
 
 					class ZInterpolateShader : public IFragmentShader<mesh_triangle_fragment_t>
 					{
-					private:
-						PixelShaders::ZInterpolate<mesh_triangle_fragment_t> PixelShader{};
-
 					public:
 						void FragmentShade(WindowRasterizer& rasterizer, const mesh_triangle_fragment_t& fragment)
 						{
-							if (PixelShader.SetFragmentData(fragment))
+							PixelShaders::ZInterpolate<mesh_triangle_fragment_t> pixelShader{};
+
+							if (pixelShader.SetFragmentData(fragment))
 							{
-								rasterizer.RasterTriangle(fragment.vertexA, fragment.vertexB, fragment.vertexC, PixelShader);
+								rasterizer.RasterTriangle(fragment.vertexA, fragment.vertexB, fragment.vertexC, pixelShader);
 							}
 						}
 					};
@@ -105,15 +107,14 @@ namespace IntegerWorld
 						pixel_blend_mode_t blendMode = pixel_blend_mode_t::Replace>
 					class ColorInterpolateShader : public IFragmentShader<mesh_vertex_fragment_t>
 					{
-					private:
-						PixelShaders::VertexColorInterpolate<TriangleSamplerType> PixelShader{};
-
 					public:
 						void FragmentShade(WindowRasterizer& rasterizer, const mesh_vertex_fragment_t& fragment)
 						{
-							if (PixelShader.SetFragmentData(fragment))
+							PixelShaders::VertexColorInterpolate<TriangleSamplerType> pixelShader{};
+
+							if (pixelShader.SetFragmentData(fragment))
 							{
-								rasterizer.RasterTriangle<blendMode>(fragment.vertexA, fragment.vertexB, fragment.vertexC, PixelShader);
+								rasterizer.RasterTriangle<blendMode>(fragment.vertexA, fragment.vertexB, fragment.vertexC, pixelShader);
 							}
 						}
 					};
@@ -121,44 +122,42 @@ namespace IntegerWorld
 					template<typename TriangleSamplerType = PrimitiveShaders::TriangleAffineSampler>
 					class ZInterpolateShader : public IFragmentShader<mesh_vertex_fragment_t>
 					{
-					private:
-						PixelShaders::ZInterpolate<mesh_vertex_fragment_t, TriangleSamplerType> PixelShader{};
-
 					public:
 						void FragmentShade(WindowRasterizer& rasterizer, const mesh_vertex_fragment_t& fragment)
 						{
-							if (PixelShader.SetFragmentData(fragment))
+							PixelShaders::ZInterpolate<mesh_vertex_fragment_t, TriangleSamplerType> pixelShader{};
+
+							if (pixelShader.SetFragmentData(fragment))
 							{
-								rasterizer.RasterTriangle(fragment.vertexA, fragment.vertexB, fragment.vertexC, PixelShader);
+								rasterizer.RasterTriangle(fragment.vertexA, fragment.vertexB, fragment.vertexC, pixelShader);
 							}
 						}
 					};
 
 					class WireframeShader : public IFragmentShader<mesh_vertex_fragment_t>
 					{
-					private:
-						Edge::PixelShaders::VertexColorInterpolate PixelShader{};
-
 					public:
 						void FragmentShade(WindowRasterizer& rasterizer, const mesh_vertex_fragment_t& fragment)
 						{
-							if (PixelShader.SetFragmentData(fragment.vertexA, fragment.vertexB,
+							Edge::PixelShaders::VertexColorInterpolate pixelShader{};
+
+							if (pixelShader.SetFragmentData(fragment.vertexA, fragment.vertexB,
 								Rgb8::Color(fragment.redA, fragment.greenA, fragment.blueA),
 								Rgb8::Color(fragment.redB, fragment.greenB, fragment.blueB)))
 							{
-								rasterizer.RasterLine<>(fragment.vertexA, fragment.vertexB, PixelShader);
+								rasterizer.RasterLine<>(fragment.vertexA, fragment.vertexB, pixelShader);
 
-								if (PixelShader.SetFragmentData(fragment.vertexA, fragment.vertexC,
+								if (pixelShader.SetFragmentData(fragment.vertexA, fragment.vertexC,
 									Rgb8::Color(fragment.redA, fragment.greenA, fragment.blueA),
 									Rgb8::Color(fragment.redC, fragment.greenC, fragment.blueC)))
 								{
-									rasterizer.RasterLine<>(fragment.vertexA, fragment.vertexC, PixelShader);
+									rasterizer.RasterLine<>(fragment.vertexA, fragment.vertexC, pixelShader);
 
-									if (PixelShader.SetFragmentData(fragment.vertexB, fragment.vertexC,
+									if (pixelShader.SetFragmentData(fragment.vertexB, fragment.vertexC,
 										Rgb8::Color(fragment.redB, fragment.greenB, fragment.blueB),
 										Rgb8::Color(fragment.redC, fragment.greenC, fragment.blueC)))
 									{
-										rasterizer.RasterLine<>(fragment.vertexB, fragment.vertexC, PixelShader);
+										rasterizer.RasterLine<>(fragment.vertexB, fragment.vertexC, pixelShader);
 									}
 								}
 							}
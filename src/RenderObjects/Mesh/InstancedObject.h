@@ -0,0 +1,478 @@
+#ifndef _INTEGER_WORLD_RENDER_OBJECTS_MESH_INSTANCED_OBJECT_h
+#define _INTEGER_WORLD_RENDER_OBJECTS_MESH_INSTANCED_OBJECT_h
+
+#include "AbstractObject.h"
+
+namespace IntegerWorld
+{
+	namespace RenderObjects
+	{
+		namespace Mesh
+		{
+			/// <summary>
+			/// Triangle shade mesh drawn as instanceCount copies, each with its own position, rotation and albedo (see mesh_instance_t).
+			/// The engine sees a single object with instanceCount * triangleCount primitives, indexed instance-major.
+			/// One vertex working buffer is shared by all instances:
+			/// - WorldShade transforms the current instance's vertices to world space, for primitive culling and lighting.
+			/// - ScreenShade transforms and projects the current instance's vertices, for face culling and depth.
+			/// - FragmentShade re-projects the triangle's 3 vertices with the instance's object -> camera transform.
+			/// RAM grows per instance with its mesh_instance_t, transform and culling flag, not with vertexCount.
+			/// Each instance primitive still costs 2 bytes of depth, plus 3 bytes of lit color when lit,
+			/// so RAM also grows with instanceCount * triangleCount.
+			/// Unlit instances (lit = false) take their Albedo directly and ignore SceneShader.
+			/// instanceCount * triangleCount must fit in primitive_index_t.
+			/// </summary>
+			template<primitive_index_t vertexCount,
+				primitive_index_t triangleCount,
+				uint8_t instanceCount,
+				typename VertexSourceType,
+				typename TriangleSourceType,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling,
+				typename MaterialSourceType = PrimitiveSources::Material::DiffuseMaterialSource,
+				bool lit = true>
+			class InstancedMeshObject : public RenderObjects::AbstractObject
+			{
+			private:
+				static_assert((static_cast<uint64_t>(instanceCount) * triangleCount) <= static_cast<primitive_index_t>(~static_cast<primitive_index_t>(0)),
+					"instanceCount * triangleCount must fit in primitive_index_t.");
+
+			protected:
+				static constexpr primitive_index_t PrimitiveCount = static_cast<primitive_index_t>(static_cast<uint32_t>(instanceCount) * triangleCount);
+
+			public:
+				using fragment_t = mesh_triangle_fragment_t;
+
+				/// <summary>
+				/// Mesh triangle fragment shader. If null, no fragments are shaded.
+				/// </summary>
+				IFragmentShader<mesh_triangle_fragment_t>* FragmentShader = nullptr;
+
+				/// <summary>
+				/// Scene's lighting shader. If null or unlit, no lighting is applied.
+				/// </summary>
+				ISceneShader* SceneShader = nullptr;
+
+				/// <summary>
+				/// Per instance world position, rotation and albedo.
+				/// </summary>
+				mesh_instance_t Instances[instanceCount]{};
+
+				/// <summary>
+				/// Scale shared by all instances.
+				/// </summary>
+				scale16_t Resize = Scale16::SCALE_1X;
+
+				/// <summary>
+				/// Object-space bounding sphere radius around the mesh origin, before Resize.
+				/// 0 when unknown: instances are not culled as a whole and every primitive is frustum tested.
+				/// </summary>
+				uint16_t BoundingRadius = 0;
+
+			protected:
+				VertexSourceType& VertexSource;
+				TriangleSourceType& TriangleSource;
+				MaterialSourceType& MaterialSource;
+
+			private:
+				// Shared vertex working buffer, holds the vertices of ScratchInstance.
+				vertex16_t Vertices[vertexCount]{};
+
+				// Per-vertex frustum outcodes of ScratchInstance, for primitive culling.
+				uint8_t Outcodes[frustumCulling == FrustumCullingEnum::PrimitiveCulling ? vertexCount : 1]{};
+
+				// Per instance primitive z, negative when culled.
+				int16_t Primitives[PrimitiveCount]{};
+
+				// Per instance primitive lit albedo colors, unlit primitives use their instance's Albedo.
+				CompactRgb8List<lit ? PrimitiveCount : 1> LightBuffer{};
+
+				// Per instance object -> world transform, replaced by the object -> camera transform on CameraTransform.
+				transform16_scale_rotate_translate_t InstanceTransforms[instanceCount]{};
+
+				// Instance bounding sphere is fully inside the frustum for this frame, primitive frustum tests are skipped.
+				bool InstancesInside[instanceCount]{};
+
+				const ViewportProjector* Projector = nullptr;
+
+				// Instance whose vertices are in the working buffer, instanceCount when none.
+				uint8_t ScratchInstance = instanceCount;
+
+				// Scene lights reaching any instance this frame.
+				object_lights_t ObjectLights{};
+
+			public:
+				InstancedMeshObject(VertexSourceType& vertexSource,
+					TriangleSourceType& triangleSource,
+					MaterialSourceType& materialSource = const_cast<MaterialSourceType&>(PrimitiveSources::Material::DiffuseMaterialSourceInstance))
+					: RenderObjects::AbstractObject()
+					, VertexSource(vertexSource)
+					, TriangleSource(triangleSource)
+					, MaterialSource(materialSource)
+				{
+				}
+
+				/// <summary>
+				/// Object pass:
+				/// - Computes each instance's object -> world transform.
+				/// - With a BoundingRadius, culls instances outside the frustum and skips primitive culling for instances fully inside.
+				/// </summary>
+				virtual void ObjectShade(const frustum_t& frustum)
+				{
+					const uint16_t radius = Scale(Resize, BoundingRadius);
+
+					for (uint_fast8_t i = 0; i < instanceCount; i++)
+					{
+						InstanceTransforms[i].Translation = Instances[i].Position;
+						InstanceTransforms[i].Resize = Resize;
+						CalculateTransformRotation(InstanceTransforms[i], Instances[i].Rotation.x, Instances[i].Rotation.y, Instances[i].Rotation.z);
+
+						int16_t zFlag = 0;
+						InstancesInside[i] = false;
+						switch (frustumCulling)
+						{
+						case FrustumCullingEnum::ObjectCulling:
+						case FrustumCullingEnum::PrimitiveCulling:
+							if (BoundingRadius > 0)
+							{
+								if (!frustum.IsSphereInside(Instances[i].Position, radius))
+								{
+									zFlag = -VERTEX16_UNIT;
+								}
+								else
+								{
+									InstancesInside[i] = frustum.IsSphereFullyInside(Instances[i].Position, radius);
+								}
+							}
+							else if (frustumCulling == FrustumCullingEnum::ObjectCulling
+								&& !frustum.IsPointInside(Instances[i].Position))
+							{
+								zFlag = -VERTEX16_UNIT;
+							}
+							break;
+						case FrustumCullingEnum::NoCulling:
+						default:
+							break;
+						};
+
+						const primitive_index_t offset = static_cast<primitive_index_t>(i) * triangleCount;
+						for (primitive_index_t j = 0; j < triangleCount; j++)
+						{
+							Primitives[offset + j] = zFlag;
+						}
+					}
+
+					ScratchInstance = instanceCount;
+
+					if (IsLit())
+					{
+						// Lights are selected for the sphere around all instances, 0 radius selects all without bounds.
+						vertex16_t center{};
+						uint16_t allRadius = 0;
+						GetInstancesSphere(center, allRadius);
+						SceneShader->SelectObjectLights(ObjectLights, center, allRadius);
+					}
+				}
+
+				// Vertices are transformed per instance on WorldShade and ScreenShade.
+				virtual bool WorldTransform(const primitive_index_t vertexIndex)
+				{
+					return true;
+				}
+
+				/// <summary>
+				/// World pass:
+				/// - Loads the instance's world-space vertices on its first visible primitive.
+				/// - Optionally culls primitives against the frustum.
+				/// - Applies the scene shader to light the instance's albedo.
+				/// </summary>
+				/// <returns>false to continue processing; true when no more primitives are available.</returns>
+				virtual bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex)
+				{
+					if (primitiveIndex >= PrimitiveCount)
+						return true;
+
+					if (Primitives[primitiveIndex] < 0)
+						return false;
+
+					const uint8_t instance = static_cast<uint8_t>(primitiveIndex / triangleCount);
+					const primitive_index_t triangleIndex = primitiveIndex - (static_cast<primitive_index_t>(instance) * triangleCount);
+					const bool primitiveCulling = frustumCulling == FrustumCullingEnum::PrimitiveCulling && !InstancesInside[instance];
+
+					if (!IsLit()
+						&& !primitiveCulling)
+						return false;
+
+					if (ScratchInstance != instance)
+					{
+						LoadWorldVertices(frustum, instance, primitiveCulling);
+					}
+
+					const auto triangle = TriangleSource.GetTriangle(triangleIndex);
+
+					if (primitiveCulling
+						&& IsTriangleOutside(triangle))
+					{
+						Primitives[primitiveIndex] = -VERTEX16_UNIT;
+						return false;
+					}
+
+					if (IsLit())
+					{
+						LightBuffer.SetColor(GetTriangleLitColor(*SceneShader, ObjectLights, MaterialSource,
+							const_cast<PrimitiveSources::Normal::Static::NoSource&>(PrimitiveSources::Normal::NormalNoSourceInstance),
+							InstanceTransforms[instance], triangleIndex,
+							Instances[instance].Albedo, Vertices[triangle.a], Vertices[triangle.b], Vertices[triangle.c]), primitiveIndex);
+					}
+
+					return false;
+				}
+
+				/// <summary>
+				/// Camera pass, per instance: composes the instance's object -> camera transform.
+				/// </summary>
+				virtual bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex)
+				{
+					if (vertexIndex >= instanceCount)
+						return true;
+
+					CalculateObjectCameraTransform(InstanceTransforms[vertexIndex], InstanceTransforms[vertexIndex], transform);
+					ScratchInstance = instanceCount;
+
+					return false;
+				}
+
+				// Vertices are projected per instance on ScreenShade and FragmentShade.
+				virtual bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex)
+				{
+					Projector = &screenProjector;
+
+					return true;
+				}
+
+				/// <summary>
+				/// Screen pass:
+				/// - Projects the instance's vertices on its first visible primitive.
+				/// - Applies mesh culling mode (backface/frontface/none) using projected 2D winding.
+				/// - Emits a z key (average vertex z) for depth ordering when the primitive is visible.
+				/// </summary>
+				/// <returns>false to continue; true when no more primitives are available.</returns>
+				virtual bool ScreenShade(const primitive_index_t primitiveIndex)
+				{
+					if (primitiveIndex >= PrimitiveCount)
+						return true;
+
+					if (Primitives[primitiveIndex] < 0)
+						return false;
+
+					const uint8_t instance = static_cast<uint8_t>(primitiveIndex / triangleCount);
+					if (ScratchInstance != instance)
+					{
+						for (primitive_index_t start = 0; start < vertexCount; start += VertexKernel::ChunkSize)
+						{
+							VertexKernel::TransformProject(InstanceTransforms[instance], *Projector, VertexSource, &Vertices[start],
+								start, static_cast<uint8_t>(MinValue<uint32_t>(VertexKernel::ChunkSize, vertexCount - start)));
+						}
+						ScratchInstance = instance;
+					}
+
+					const auto triangle = TriangleSource.GetTriangle(primitiveIndex - (static_cast<primitive_index_t>(instance) * triangleCount));
+
+					if (faceCulling != FaceCullingEnum::NoCulling)
+					{
+						const int32_t signedArea = (static_cast<int32_t>(Vertices[triangle.b].x - Vertices[triangle.a].x)
+							* (Vertices[triangle.c].y - Vertices[triangle.a].y))
+							- (static_cast<int32_t>(Vertices[triangle.b].y - Vertices[triangle.a].y)
+								* (Vertices[triangle.c].x - Vertices[triangle.a].x));
+
+						if ((faceCulling == FaceCullingEnum::BackfaceCulling && signedArea >= 0)
+							|| (faceCulling == FaceCullingEnum::FrontfaceCulling && signedArea <= 0))
+						{
+							Primitives[primitiveIndex] = -VERTEX16_UNIT;
+							return false;
+						}
+					}
+
+					Primitives[primitiveIndex] = AverageApproximate(Vertices[triangle.a].z, Vertices[triangle.b].z, Vertices[triangle.c].z);
+
+					return false;
+				}
+
+				virtual void FragmentCollect(FragmentCollector& fragmentCollector) override
+				{
+					for (primitive_index_t i = 0; i < PrimitiveCount; i++)
+					{
+						if (Primitives[i] >= 0)
+						{
+							fragmentCollector.AddFragment(i, Primitives[i]);
+						}
+					}
+				}
+
+				/// <summary>
+				/// Produces a triangle fragment for the rasterizer and calls the fragment shader.
+				/// The triangle's vertices are projected again, as the working buffer only holds one instance.
+				/// </summary>
+				/// <param name="rasterizer">Window rasterizer to receive the shaded triangle.</param>
+				/// <param name="primitiveIndex">Instance primitive index.</param>
+				virtual void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex)
+				{
+					if (FragmentShader == nullptr)
+						return;
+
+					const uint8_t instance = static_cast<uint8_t>(primitiveIndex / triangleCount);
+					const primitive_index_t triangleIndex = primitiveIndex - (static_cast<primitive_index_t>(instance) * triangleCount);
+
+					mesh_triangle_fragment_t fragment{};
+					fragment.index = triangleIndex;
+					fragment.z = Primitives[primitiveIndex];
+					{
+						const auto triangle = TriangleSource.GetTriangle(triangleIndex);
+						VertexKernel::TransformProject(InstanceTransforms[instance], *Projector, VertexSource, &fragment.vertexA, triangle.a, 1);
+						VertexKernel::TransformProject(InstanceTransforms[instance], *Projector, VertexSource, &fragment.vertexB, triangle.b, 1);
+						VertexKernel::TransformProject(InstanceTransforms[instance], *Projector, VertexSource, &fragment.vertexC, triangle.c, 1);
+					}
+					{
+						const auto color = IsLit() ? LightBuffer.GetColor(primitiveIndex) : Instances[instance].Albedo;
+						fragment.red = Rgb8::Red(color);
+						fragment.green = Rgb8::Green(color);
+						fragment.blue = Rgb8::Blue(color);
+					}
+
+					FragmentShader->FragmentShade(rasterizer, fragment);
+				}
+
+				/// <summary>
+				/// Bounding sphere around all instances, see GetInstancesSphere.
+				/// NoCulling objects report no bounds, so they are never culled.
+				/// </summary>
+				virtual bool GetBoundingSphere(vertex16_t& center, uint16_t& radius)
+				{
+					if (frustumCulling == FrustumCullingEnum::NoCulling)
+						return false;
+
+					return GetInstancesSphere(center, radius);
+				}
+
+			protected:
+				/// <summary>
+				/// Sphere around all instances, from their positions and BoundingRadius scaled by Resize.
+				/// </summary>
+				/// <returns>True if the object has a BoundingRadius.</returns>
+				bool GetInstancesSphere(vertex16_t& center, uint16_t& radius) const
+				{
+					if (BoundingRadius == 0)
+						return false;
+
+					vertex16_t low = Instances[0].Position;
+					vertex16_t high = Instances[0].Position;
+					for (uint_fast8_t i = 1; i < instanceCount; i++)
+					{
+						low.x = MinValue(low.x, Instances[i].Position.x);
+						low.y = MinValue(low.y, Instances[i].Position.y);
+						low.z = MinValue(low.z, Instances[i].Position.z);
+						high.x = MaxValue(high.x, Instances[i].Position.x);
+						high.y = MaxValue(high.y, Instances[i].Position.y);
+						high.z = MaxValue(high.z, Instances[i].Position.z);
+					}
+
+					center.x = static_cast<int16_t>((static_cast<int32_t>(low.x) + high.x) / 2);
+					center.y = static_cast<int16_t>((static_cast<int32_t>(low.y) + high.y) / 2);
+					center.z = static_cast<int16_t>((static_cast<int32_t>(low.z) + high.z) / 2);
+
+					const uint32_t halfX = (static_cast<int32_t>(high.x) - low.x + 1) / 2;
+					const uint32_t halfY = (static_cast<int32_t>(high.y) - low.y + 1) / 2;
+					const uint32_t halfZ = (static_cast<int32_t>(high.z) - low.z + 1) / 2;
+					const uint32_t spread = IntegerSignal::SquareRoot32((halfX * halfX) + (halfY * halfY) + (halfZ * halfZ)) + 1;
+
+					radius = static_cast<uint16_t>(MinValue<uint32_t>(UINT16_MAX, spread + Scale(Resize, BoundingRadius)));
+
+					return true;
+				}
+
+			private:
+				bool IsLit() const
+				{
+					return lit && SceneShader != nullptr;
+				}
+
+				void LoadWorldVertices(const frustum_t& frustum, const uint8_t instance, const bool primitiveCulling)
+				{
+					for (primitive_index_t i = 0; i < vertexCount; i++)
+					{
+						Vertices[i] = VertexSource.GetVertex(i);
+						ApplyTransform(InstanceTransforms[instance], Vertices[i]);
+
+						if (primitiveCulling)
+						{
+							Outcodes[i] = frustum.GetOutcode(Vertices[i]);
+						}
+					}
+					ScratchInstance = instance;
+				}
+
+				/// <summary>
+				/// Primitive frustum culling from the cached vertex outcodes, see IsOutcodeTriangleOutside.
+				/// </summary>
+				template<typename face_t>
+				bool IsTriangleOutside(const face_t& triangle) const
+				{
+					return IsOutcodeTriangleOutside(Outcodes[triangle.a], Outcodes[triangle.b], Outcodes[triangle.c]);
+				}
+			};
+
+			template<primitive_index_t vertexCount, primitive_index_t triangleCount, uint8_t instanceCount,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling,
+				bool lit = true>
+			class SimpleStaticInstancedMeshObject : public InstancedMeshObject<
+				vertexCount,
+				triangleCount,
+				instanceCount,
+				PrimitiveSources::Vertex::Static::Source,
+				PrimitiveSources::Triangle::Static::Source,
+				frustumCulling,
+				faceCulling,
+				PrimitiveSources::Material::Dynamic::SingleSource,
+				lit>
+			{
+			private:
+				using Base = InstancedMeshObject<
+					vertexCount,
+					triangleCount,
+					instanceCount,
+					PrimitiveSources::Vertex::Static::Source,
+					PrimitiveSources::Triangle::Static::Source,
+					frustumCulling,
+					faceCulling,
+					PrimitiveSources::Material::Dynamic::SingleSource,
+					lit>;
+
+			private:
+				PrimitiveSources::Vertex::Static::Source VerticesSource;
+				PrimitiveSources::Triangle::Static::Source TrianglesSource;
+
+				PrimitiveSources::Material::Dynamic::SingleSource MaterialsSource{};
+
+			public:
+				SimpleStaticInstancedMeshObject(const vertex16_t* vertices, const triangle_face_t* triangles)
+					: Base(VerticesSource, TrianglesSource, MaterialsSource)
+					, VerticesSource(vertices)
+					, TrianglesSource(triangles)
+				{
+				}
+
+				void SetMaterial(const material_t& material)
+				{
+					MaterialsSource.Material = material;
+				}
+
+				material_t GetMaterial() const
+				{
+					return MaterialsSource.Material;
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
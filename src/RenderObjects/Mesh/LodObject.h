@@ -0,0 +1,178 @@
+#ifndef _INTEGER_WORLD_RENDER_OBJECTS_MESH_LOD_OBJECT_h
+#define _INTEGER_WORLD_RENDER_OBJECTS_MESH_LOD_OBJECT_h
+
+#include "TriangleShadeObject.h"
+
+namespace IntegerWorld
+{
+	namespace RenderObjects
+	{
+		namespace Mesh
+		{
+			/// <summary>
+			/// Triangle shade mesh with discrete levels of detail, one vertex and triangle source pair per level.
+			/// - Level 0 is the full mesh and sizes the working buffers, coarser levels must fit in vertexCount and triangleCount.
+			/// - The level is picked on ObjectShade from the projected BoundingRadius, with hysteresis against flicker.
+			///   Without a BoundingRadius, level 0 is always used.
+			/// Albedo and material sources are indexed by the current level's triangles, single sources fit all levels.
+			/// Vertex and triangle sources are copied per level, their types must be default-constructible and copy-assignable (e.g. Static::Source).
+			/// </summary>
+			template<primitive_index_t vertexCount,
+				primitive_index_t triangleCount,
+				uint8_t lodCount,
+				typename VertexSourceType,
+				typename TriangleSourceType,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling,
+				typename AlbedoSourceType = PrimitiveSources::Albedo::Static::FullSource,
+				typename MaterialSourceType = PrimitiveSources::Material::DiffuseMaterialSource>
+			class LodTriangleObject : public TriangleShadeObject<
+				vertexCount,
+				triangleCount,
+				VertexSourceType,
+				TriangleSourceType,
+				frustumCulling,
+				faceCulling,
+				AlbedoSourceType,
+				MaterialSourceType>
+			{
+			private:
+				using BaseClass = TriangleShadeObject<
+					vertexCount,
+					triangleCount,
+					VertexSourceType,
+					TriangleSourceType,
+					frustumCulling,
+					faceCulling,
+					AlbedoSourceType,
+					MaterialSourceType>;
+
+				// Switching back to a finer level needs a projected radius 1/8 above the level's threshold.
+				static constexpr uint8_t HysteresisShift = 3;
+
+			protected:
+				using BaseClass::VertexCount;
+				using BaseClass::TriangleCount;
+
+			private:
+				// Current level's sources, referenced by the base object.
+				VertexSourceType LevelVertexSource;
+				TriangleSourceType LevelTriangleSource;
+
+				VertexSourceType LevelVertices[lodCount]{};
+				TriangleSourceType LevelTriangles[lodCount]{};
+				primitive_index_t LevelVertexCounts[lodCount]{};
+				primitive_index_t LevelTriangleCounts[lodCount]{};
+
+				// Projected radius in pixels, at or below which each level is used.
+				uint16_t LevelRadius[lodCount]{};
+
+				uint8_t Level = 0;
+				uint8_t LevelCount = 1;
+
+			public:
+				/// <summary>
+				/// Creates the object with only the full detail level 0. Coarser levels are added with SetLevel().
+				/// </summary>
+				/// <param name="vertexSource">Level 0 vertices, vertexCount long.</param>
+				/// <param name="triangleSource">Level 0 triangles, triangleCount long.</param>
+				LodTriangleObject(const VertexSourceType& vertexSource,
+					const TriangleSourceType& triangleSource,
+					AlbedoSourceType& albedoSource = const_cast<AlbedoSourceType&>(PrimitiveSources::Albedo::FullAlbedoSourceInstance),
+					MaterialSourceType& materialSource = const_cast<MaterialSourceType&>(PrimitiveSources::Material::DiffuseMaterialSourceInstance))
+					: BaseClass(LevelVertexSource, LevelTriangleSource, albedoSource, materialSource)
+					, LevelVertexSource(vertexSource)
+					, LevelTriangleSource(triangleSource)
+				{
+					LevelVertices[0] = vertexSource;
+					LevelTriangles[0] = triangleSource;
+					LevelVertexCounts[0] = vertexCount;
+					LevelTriangleCounts[0] = triangleCount;
+				}
+
+				/// <summary>
+				/// Sets a coarser level of detail. Levels are used in order, with decreasing pixelRadius.
+				/// </summary>
+				/// <param name="level">Level index in [1, lodCount).</param>
+				/// <param name="pixelRadius">Projected radius in pixels, at or below which this level is used.</param>
+				/// <returns>False if the level is out of range or doesn't fit the working buffers.</returns>
+				bool SetLevel(const uint8_t level,
+					const VertexSourceType& vertexSource, const primitive_index_t levelVertexCount,
+					const TriangleSourceType& triangleSource, const primitive_index_t levelTriangleCount,
+					const uint16_t pixelRadius)
+				{
+					if (level == 0
+						|| level > LevelCount
+						|| level >= lodCount
+						|| levelVertexCount > vertexCount
+						|| levelTriangleCount > triangleCount)
+						return false;
+
+					LevelVertices[level] = vertexSource;
+					LevelTriangles[level] = triangleSource;
+					LevelVertexCounts[level] = levelVertexCount;
+					LevelTriangleCounts[level] = levelTriangleCount;
+					LevelRadius[level] = pixelRadius;
+					LevelCount = MaxValue<uint8_t>(LevelCount, level + 1);
+
+					return true;
+				}
+
+				/// <summary>
+				/// Level of detail used in the current frame.
+				/// </summary>
+				uint8_t GetLevel() const
+				{
+					return Level;
+				}
+
+				/// <summary>
+				/// Object pass:
+				/// - Selects the level of detail before the base object loads vertices and flags primitives.
+				/// </summary>
+				virtual void ObjectShade(const frustum_t& frustum)
+				{
+					uint8_t level = 0;
+					if (BaseClass::BoundingRadius > 0)
+					{
+						BaseClass::UpdateWorldPosition(frustum);
+						level = SelectLevel(frustum.GetProjectedRadius(BaseClass::WorldPosition, Scale(BaseClass::Resize, BaseClass::BoundingRadius)));
+					}
+
+					Level = level;
+					LevelVertexSource = LevelVertices[level];
+					LevelTriangleSource = LevelTriangles[level];
+					VertexCount = LevelVertexCounts[level];
+					TriangleCount = LevelTriangleCounts[level];
+
+					BaseClass::ObjectShade(frustum);
+				}
+
+			private:
+				/// <summary>
+				/// Coarsest level whose threshold the projected radius is within.
+				/// Level 0 is the finest. Thresholds of levels 1 to the current level, the current and finer levels, are raised,
+				/// so switching to a finer level needs a larger radius than switching back to a coarser one.
+				/// </summary>
+				uint8_t SelectLevel(const uint16_t pixelRadius) const
+				{
+					uint8_t level = 0;
+					for (uint_fast8_t i = 1; i < LevelCount; i++)
+					{
+						uint32_t threshold = LevelRadius[i];
+						if (i <= Level)
+							threshold += threshold >> HysteresisShift;
+
+						if (pixelRadius > threshold)
+							break;
+
+						level = i;
+					}
+
+					return level;
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
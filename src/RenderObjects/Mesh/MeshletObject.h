@@ -0,0 +1,300 @@
+#ifndef _INTEGER_WORLD_RENDER_OBJECTS_MESH_MESHLET_OBJECT_h
+#define _INTEGER_WORLD_RENDER_OBJECTS_MESH_MESHLET_OBJECT_h
+
+#include "TriangleShadeObject.h"
+
+namespace IntegerWorld
+{
+	namespace RenderObjects
+	{
+		namespace Mesh
+		{
+			/// <summary>
+			/// Triangle shade mesh with triangles grouped in meshlets (see meshlet_t), as generated by the OBJ converter.
+			/// Whole meshlets are culled on ObjectShade, before any per-vertex or per-primitive work:
+			/// - Against the frustum by bounding sphere, with PrimitiveCulling.
+			/// - By normal cone against the camera position, with face culling.
+			/// Vertices only referenced by culled meshlets skip the world, camera and screen passes.
+			/// </summary>
+			template<primitive_index_t vertexCount,
+				primitive_index_t triangleCount,
+				uint16_t meshletCount,
+				typename VertexSourceType,
+				typename TriangleSourceType,
+				typename MeshletSourceType,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling,
+				typename AlbedoSourceType = PrimitiveSources::Albedo::Static::FullSource,
+				typename MaterialSourceType = PrimitiveSources::Material::DiffuseMaterialSource,
+				typename NormalSourceType = PrimitiveSources::Normal::Static::NoSource,
+				typename UvSourceType = PrimitiveSources::Uv::Static::NoSource>
+			class MeshletTriangleObject : public TriangleShadeObject<
+				vertexCount,
+				triangleCount,
+				VertexSourceType,
+				TriangleSourceType,
+				frustumCulling,
+				faceCulling,
+				AlbedoSourceType,
+				MaterialSourceType,
+				NormalSourceType,
+				UvSourceType>
+			{
+			private:
+				using BaseClass = TriangleShadeObject<
+					vertexCount,
+					triangleCount,
+					VertexSourceType,
+					TriangleSourceType,
+					frustumCulling,
+					faceCulling,
+					AlbedoSourceType,
+					MaterialSourceType,
+					NormalSourceType,
+					UvSourceType>;
+
+			protected:
+				using BaseClass::Primitives;
+				using BaseClass::TriangleSource;
+				using BaseClass::TriangleCount;
+				using BaseClass::VertexCount;
+				using BaseClass::MeshTransform;
+				using BaseClass::FusedCameraTransform;
+				using BaseClass::PrimitivesInside;
+				using BaseClass::FaceCullingMarginShift;
+
+			protected:
+				MeshletSourceType& MeshletSource;
+
+				uint16_t MeshletCount = meshletCount;
+
+			private:
+				// Vertex bits, set in ObjectShade for the vertices of meshlets that survive culling.
+				uint8_t MeshletVertices[(vertexCount + 7) / 8]{};
+
+				// At least one meshlet was culled this frame, vertices outside MeshletVertices are skipped.
+				bool MeshletsCulled = false;
+
+			public:
+				MeshletTriangleObject(VertexSourceType& vertexSource,
+					TriangleSourceType& triangleSource,
+					MeshletSourceType& meshletSource,
+					AlbedoSourceType& albedoSource = const_cast<AlbedoSourceType&>(PrimitiveSources::Albedo::FullAlbedoSourceInstance),
+					MaterialSourceType& materialSource = const_cast<MaterialSourceType&>(PrimitiveSources::Material::DiffuseMaterialSourceInstance),
+					NormalSourceType& normalSource = const_cast<NormalSourceType&>(PrimitiveSources::Normal::NormalNoSourceInstance),
+					UvSourceType& uvSource = const_cast<UvSourceType&>(PrimitiveSources::Uv::NoUvSourceInstance))
+					: BaseClass(vertexSource, triangleSource, albedoSource, materialSource, normalSource, uvSource)
+					, MeshletSource(meshletSource)
+				{
+				}
+
+				/// <summary>
+				/// Object pass:
+				/// - Flags the primitives of culled meshlets.
+				/// - Marks the vertices of the remaining meshlets, if any meshlet was culled.
+				/// </summary>
+				virtual void ObjectShade(const frustum_t& frustum)
+				{
+					BaseClass::ObjectShade(frustum);
+
+					MeshletsCulled = false;
+
+					// Object culled, all primitives are already flagged.
+					if (TriangleCount == 0
+						|| Primitives[0] < 0)
+						return;
+
+					const bool frustumTest = frustumCulling == FrustumCullingEnum::PrimitiveCulling && !PrimitivesInside;
+					if (!frustumTest
+						&& faceCulling == FaceCullingEnum::NoCulling)
+						return;
+
+					for (uint_fast16_t i = 0; i < MeshletCount; i++)
+					{
+						const auto meshlet = MeshletSource.GetMeshlet(i);
+						if (IsMeshletCulled(meshlet, frustum, frustumTest))
+						{
+							for (uint_fast16_t j = 0; j < meshlet.triangleCount; j++)
+							{
+								Primitives[meshlet.firstTriangle + j] = -VERTEX16_UNIT;
+							}
+							MeshletsCulled = true;
+						}
+					}
+
+					if (!MeshletsCulled)
+						return;
+
+					for (primitive_index_t i = 0; i < sizeof(MeshletVertices); i++)
+					{
+						MeshletVertices[i] = 0;
+					}
+
+					for (uint_fast16_t i = 0; i < MeshletCount; i++)
+					{
+						const auto meshlet = MeshletSource.GetMeshlet(i);
+						if (meshlet.triangleCount == 0
+							|| Primitives[meshlet.firstTriangle] < 0)
+							continue;
+
+						for (uint_fast16_t j = 0; j < meshlet.triangleCount; j++)
+						{
+							const auto triangle = TriangleSource.GetTriangle(meshlet.firstTriangle + j);
+							MeshletVertices[triangle.a >> 3] |= 1 << (triangle.a & 7);
+							MeshletVertices[triangle.b >> 3] |= 1 << (triangle.b & 7);
+							MeshletVertices[triangle.c >> 3] |= 1 << (triangle.c & 7);
+						}
+					}
+				}
+
+				virtual bool WorldTransform(const primitive_index_t vertexIndex)
+				{
+					if (IsMeshletVertexCulled(vertexIndex))
+						return false;
+
+					return BaseClass::WorldTransform(vertexIndex);
+				}
+
+				virtual bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex)
+				{
+					if (IsMeshletVertexCulled(vertexIndex))
+						return false;
+
+					return BaseClass::CameraTransform(transform, vertexIndex);
+				}
+
+				virtual bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex)
+				{
+					if (IsMeshletVertexCulled(vertexIndex))
+						return false;
+
+					return BaseClass::ScreenProject(screenProjector, vertexIndex);
+				}
+
+			protected:
+				/// <summary>
+				/// Tests the meshlet's world-space bounding sphere against the frustum,
+				/// and its normal cone against the camera position for the culled face side.
+				/// </summary>
+				/// <returns>True if no triangle of the meshlet can be visible.</returns>
+				bool IsMeshletCulled(const meshlet_t& meshlet, const frustum_t& frustum, const bool frustumTest) const
+				{
+					vertex16_t center = meshlet.center;
+					ApplyTransform(MeshTransform, center);
+					const uint16_t radius = Scale(MeshTransform.Resize, meshlet.radius);
+
+					if (frustumTest
+						&& !frustum.IsSphereInside(center, radius))
+						return true;
+
+					if (faceCulling == FaceCullingEnum::NoCulling
+						|| meshlet.coneCutoff >= UFRACTION16_1X)
+						return false;
+
+					vertex16_t axis = meshlet.coneAxis;
+					ApplyTransformRotation(MeshTransform, axis);
+
+					const int32_t viewX = static_cast<int32_t>(center.x) - frustum.origin.x;
+					const int32_t viewY = static_cast<int32_t>(center.y) - frustum.origin.y;
+					const int32_t viewZ = static_cast<int32_t>(center.z) - frustum.origin.z;
+
+					// View distance along the cone axis, towards the culled side.
+					int32_t axial = SignedRightShift((viewX * axis.x) + (viewY * axis.y) + (viewZ * axis.z), GetBitShifts(VERTEX16_UNIT));
+					if (faceCulling == FaceCullingEnum::FrontfaceCulling)
+						axial = -axial;
+
+					// Culled if axial >= cutoff * |view| + radius, squared on both sides.
+					const int32_t margin = axial - radius;
+					if (margin <= 0)
+						return false;
+
+					const uint64_t viewSquare = static_cast<uint64_t>(static_cast<int64_t>(viewX) * viewX)
+						+ static_cast<uint64_t>(static_cast<int64_t>(viewY) * viewY)
+						+ static_cast<uint64_t>(static_cast<int64_t>(viewZ) * viewZ);
+					// Cone widened by the face culling margin, near edge-on faces are left to the screen-space test.
+					const uint32_t cutoff = MinValue<uint32_t>(UFRACTION16_1X, static_cast<uint32_t>(meshlet.coneCutoff) + (UFRACTION16_1X >> FaceCullingMarginShift));
+					const uint32_t cutoffSquare = (cutoff * cutoff) >> GetBitShifts(UFRACTION16_1X);
+
+					return ((static_cast<uint64_t>(margin) * static_cast<uint32_t>(margin)) << GetBitShifts(UFRACTION16_1X))
+						>= (viewSquare * cutoffSquare);
+				}
+
+			private:
+				bool IsMeshletVertexCulled(const primitive_index_t vertexIndex) const
+				{
+					return MeshletsCulled
+						&& !FusedCameraTransform
+						&& vertexIndex < VertexCount
+						&& (MeshletVertices[vertexIndex >> 3] & (1 << (vertexIndex & 7))) == 0;
+				}
+			};
+
+			template<primitive_index_t vertexCount, primitive_index_t triangleCount, uint16_t meshletCount,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling>
+			class SimpleStaticMeshletTriangleObject : public MeshletTriangleObject<
+				vertexCount,
+				triangleCount,
+				meshletCount,
+				PrimitiveSources::Vertex::Static::Source,
+				PrimitiveSources::Triangle::Static::Source,
+				PrimitiveSources::Meshlet::Static::Source,
+				frustumCulling,
+				faceCulling,
+				PrimitiveSources::Albedo::Dynamic::SingleSource,
+				PrimitiveSources::Material::Dynamic::SingleSource>
+			{
+			private:
+				using Base = MeshletTriangleObject<
+					vertexCount,
+					triangleCount,
+					meshletCount,
+					PrimitiveSources::Vertex::Static::Source,
+					PrimitiveSources::Triangle::Static::Source,
+					PrimitiveSources::Meshlet::Static::Source,
+					frustumCulling,
+					faceCulling,
+					PrimitiveSources::Albedo::Dynamic::SingleSource,
+					PrimitiveSources::Material::Dynamic::SingleSource>;
+
+			private:
+				PrimitiveSources::Vertex::Static::Source VerticesSource;
+				PrimitiveSources::Triangle::Static::Source TrianglesSource;
+				PrimitiveSources::Meshlet::Static::Source MeshletsSource;
+
+				PrimitiveSources::Albedo::Dynamic::SingleSource AlbedosSource{};
+				PrimitiveSources::Material::Dynamic::SingleSource MaterialsSource{};
+
+			public:
+				SimpleStaticMeshletTriangleObject(const vertex16_t* vertices, const triangle_face_t* triangles, const meshlet_t* meshlets)
+					: Base(VerticesSource, TrianglesSource, MeshletsSource, AlbedosSource, MaterialsSource)
+					, VerticesSource(vertices)
+					, TrianglesSource(triangles)
+					, MeshletsSource(meshlets)
+				{
+				}
+
+				void SetAlbedo(const Rgb8::color_t albedo)
+				{
+					AlbedosSource.Albedo = albedo;
+				}
+
+				Rgb8::color_t GetAlbedo() const
+				{
+					return AlbedosSource.Albedo;
+				}
+
+				void SetMaterial(const material_t& material)
+				{
+					MaterialsSource.Material = material;
+				}
+
+				material_t GetMaterial() const
+				{
+					return MaterialsSource.Material;
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
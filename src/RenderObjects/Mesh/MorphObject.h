@@ -0,0 +1,244 @@
+#ifndef _INTEGER_WORLD_RENDER_OBJECTS_MESH_MORPH_OBJECT_h
+#define _INTEGER_WORLD_RENDER_OBJECTS_MESH_MORPH_OBJECT_h
+
+#include "TriangleShadeObject.h"
+
+namespace IntegerWorld
+{
+	namespace RenderObjects
+	{
+		namespace Mesh
+		{
+			/// <summary>
+			/// Triangle shade mesh animated by morph targets (see morph_target_t), as generated by the OBJ converter.
+			/// - Base vertices come from the vertex source, targets are sparse int8 deltas from the morph source.
+			/// - Targets are blended with Weights on VertexShade, up to MaxActiveTargets with a non-zero weight per frame.
+			/// - Triangle normals are computed from the blended vertices, there are no precomputed normals.
+			/// BoundingRadius must contain the morphed mesh, the converter's includes every target at full weight.
+			/// </summary>
+			template<primitive_index_t vertexCount,
+				primitive_index_t triangleCount,
+				uint8_t targetCount,
+				typename VertexSourceType,
+				typename TriangleSourceType,
+				typename MorphSourceType,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling,
+				typename AlbedoSourceType = PrimitiveSources::Albedo::Static::FullSource,
+				typename MaterialSourceType = PrimitiveSources::Material::DiffuseMaterialSource>
+			class MorphTriangleObject : public TriangleShadeObject<
+				vertexCount,
+				triangleCount,
+				VertexSourceType,
+				TriangleSourceType,
+				frustumCulling,
+				faceCulling,
+				AlbedoSourceType,
+				MaterialSourceType>
+			{
+			private:
+				using BaseClass = TriangleShadeObject<
+					vertexCount,
+					triangleCount,
+					VertexSourceType,
+					TriangleSourceType,
+					frustumCulling,
+					faceCulling,
+					AlbedoSourceType,
+					MaterialSourceType>;
+
+				using MeshClass = AbstractObject<
+					vertexCount,
+					triangleCount,
+					VertexSourceType,
+					TriangleSourceType,
+					frustumCulling,
+					faceCulling,
+					AlbedoSourceType,
+					MaterialSourceType>;
+
+			public:
+				/// <summary>
+				/// Targets blended per frame, weights past the first MaxActiveTargets non-zero ones are ignored.
+				/// </summary>
+				static constexpr uint8_t MaxActiveTargets = 4;
+
+			protected:
+				using BaseClass::Vertices;
+				using BaseClass::Primitives;
+				using BaseClass::TriangleCount;
+				using BaseClass::VertexCount;
+				using BaseClass::FusedCameraTransform;
+
+			private:
+				struct active_target_t
+				{
+					uint16_t next;
+					uint16_t end;
+					fraction16_t weight;
+					uint8_t shift;
+				};
+
+			public:
+				/// <summary>
+				/// Per-target blend weights, FRACTION16_1X applies the full target.
+				/// </summary>
+				fraction16_t Weights[targetCount]{};
+
+			protected:
+				MorphSourceType& MorphSource;
+
+			private:
+				// Targets with a non-zero weight this frame, with their delta cursor.
+				active_target_t ActiveTargets[MaxActiveTargets]{};
+				uint8_t ActiveCount = 0;
+
+			public:
+				MorphTriangleObject(VertexSourceType& vertexSource,
+					TriangleSourceType& triangleSource,
+					MorphSourceType& morphSource,
+					AlbedoSourceType& albedoSource = const_cast<AlbedoSourceType&>(PrimitiveSources::Albedo::FullAlbedoSourceInstance),
+					MaterialSourceType& materialSource = const_cast<MaterialSourceType&>(PrimitiveSources::Material::DiffuseMaterialSourceInstance))
+					: BaseClass(vertexSource, triangleSource, albedoSource, materialSource)
+					, MorphSource(morphSource)
+				{
+				}
+
+				/// <summary>
+				/// Object pass:
+				/// - Always loads the base vertices, the fused vertex path would skip the blend.
+				/// - Picks the active targets and resets their delta cursors.
+				/// </summary>
+				virtual void ObjectShade(const frustum_t& frustum)
+				{
+					FusedCameraTransform = false;
+					MeshClass::ObjectShade(frustum);
+					BaseClass::SelectObjectLights();
+
+					ActiveCount = 0;
+
+					// Object culled, vertices aren't loaded.
+					if (TriangleCount == 0
+						|| Primitives[0] < 0)
+						return;
+
+					for (uint_fast8_t i = 0; i < targetCount && ActiveCount < MaxActiveTargets; i++)
+					{
+						if (Weights[i] == 0)
+							continue;
+
+						const morph_target_t target = MorphSource.GetTarget(i);
+						if (target.deltaCount == 0)
+							continue;
+
+						ActiveTargets[ActiveCount].next = target.firstDelta;
+						ActiveTargets[ActiveCount].end = target.firstDelta + target.deltaCount;
+						ActiveTargets[ActiveCount].weight = Weights[i];
+						ActiveTargets[ActiveCount].shift = target.shift;
+						ActiveCount++;
+					}
+				}
+
+				/// <summary>
+				/// Vertex pass: adds the weighted deltas of the active targets to the vertex.
+				/// Vertices are visited in order, so each target's sorted deltas are walked once with a cursor.
+				/// </summary>
+				/// <returns>false to continue; true when all deltas are applied.</returns>
+				virtual bool VertexShade(const primitive_index_t vertexIndex)
+				{
+					if (vertexIndex >= VertexCount)
+						return true;
+
+					bool pending = false;
+					for (uint_fast8_t i = 0; i < ActiveCount; i++)
+					{
+						active_target_t& active = ActiveTargets[i];
+						if (active.next >= active.end)
+							continue;
+
+						const morph_delta_t delta = MorphSource.GetDelta(active.next);
+						if (delta.vertex == vertexIndex)
+						{
+							Vertices[vertexIndex].x += Fraction(active.weight, SignedLeftShift(static_cast<int16_t>(delta.x), active.shift));
+							Vertices[vertexIndex].y += Fraction(active.weight, SignedLeftShift(static_cast<int16_t>(delta.y), active.shift));
+							Vertices[vertexIndex].z += Fraction(active.weight, SignedLeftShift(static_cast<int16_t>(delta.z), active.shift));
+							active.next++;
+						}
+
+						pending |= active.next < active.end;
+					}
+
+					return !pending;
+				}
+			};
+
+			template<primitive_index_t vertexCount, primitive_index_t triangleCount, uint8_t targetCount,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling>
+			class SimpleStaticMorphTriangleObject : public MorphTriangleObject<
+				vertexCount,
+				triangleCount,
+				targetCount,
+				PrimitiveSources::Vertex::Static::Source,
+				PrimitiveSources::Triangle::Static::Source,
+				PrimitiveSources::Morph::Static::Source,
+				frustumCulling,
+				faceCulling,
+				PrimitiveSources::Albedo::Dynamic::SingleSource,
+				PrimitiveSources::Material::Dynamic::SingleSource>
+			{
+			private:
+				using Base = MorphTriangleObject<
+					vertexCount,
+					triangleCount,
+					targetCount,
+					PrimitiveSources::Vertex::Static::Source,
+					PrimitiveSources::Triangle::Static::Source,
+					PrimitiveSources::Morph::Static::Source,
+					frustumCulling,
+					faceCulling,
+					PrimitiveSources::Albedo::Dynamic::SingleSource,
+					PrimitiveSources::Material::Dynamic::SingleSource>;
+
+			private:
+				PrimitiveSources::Vertex::Static::Source VerticesSource;
+				PrimitiveSources::Triangle::Static::Source TrianglesSource;
+				PrimitiveSources::Morph::Static::Source MorphsSource;
+
+				PrimitiveSources::Albedo::Dynamic::SingleSource AlbedosSource{};
+				PrimitiveSources::Material::Dynamic::SingleSource MaterialsSource{};
+
+			public:
+				SimpleStaticMorphTriangleObject(const vertex16_t* vertices, const triangle_face_t* triangles,
+					const morph_target_t* morphTargets, const morph_delta_t* morphDeltas)
+					: Base(VerticesSource, TrianglesSource, MorphsSource, AlbedosSource, MaterialsSource)
+					, VerticesSource(vertices)
+					, TrianglesSource(triangles)
+					, MorphsSource(morphTargets, morphDeltas)
+				{
+				}
+
+				void SetAlbedo(const Rgb8::color_t albedo)
+				{
+					AlbedosSource.Albedo = albedo;
+				}
+
+				Rgb8::color_t GetAlbedo() const
+				{
+					return AlbedosSource.Albedo;
+				}
+
+				void SetMaterial(const material_t& material)
+				{
+					MaterialsSource.Material = material;
+				}
+
+				material_t GetMaterial() const
+				{
+					return MaterialsSource.Material;
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
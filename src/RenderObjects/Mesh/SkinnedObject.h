@@ -0,0 +1,230 @@
+#ifndef _INTEGER_WORLD_RENDER_OBJECTS_MESH_SKINNED_OBJECT_h
+#define _INTEGER_WORLD_RENDER_OBJECTS_MESH_SKINNED_OBJECT_h
+
+#include "TriangleShadeObject.h"
+
+namespace IntegerWorld
+{
+	namespace RenderObjects
+	{
+		namespace Mesh
+		{
+			/// <summary>
+			/// Triangle shade mesh deformed by a bone palette (linear blend skinning), as generated by the OBJ converter with a skin sidecar.
+			/// - Vertices are in bind pose, each with up to 4 bones and weights from the skin source (see skin_vertex_t).
+			/// - Bones is the application's per-frame palette of bind pose -> object space transforms, applied on VertexShade.
+			///   Without a palette the mesh renders in bind pose.
+			/// - Triangle normals are computed from the skinned vertices, there are no precomputed normals.
+			/// BoundingRadius must contain every pose.
+			/// </summary>
+			template<primitive_index_t vertexCount,
+				primitive_index_t triangleCount,
+				typename VertexSourceType,
+				typename TriangleSourceType,
+				typename SkinSourceType,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling,
+				typename AlbedoSourceType = PrimitiveSources::Albedo::Static::FullSource,
+				typename MaterialSourceType = PrimitiveSources::Material::DiffuseMaterialSource>
+			class SkinnedTriangleObject : public TriangleShadeObject<
+				vertexCount,
+				triangleCount,
+				VertexSourceType,
+				TriangleSourceType,
+				frustumCulling,
+				faceCulling,
+				AlbedoSourceType,
+				MaterialSourceType>
+			{
+			private:
+				using BaseClass = TriangleShadeObject<
+					vertexCount,
+					triangleCount,
+					VertexSourceType,
+					TriangleSourceType,
+					frustumCulling,
+					faceCulling,
+					AlbedoSourceType,
+					MaterialSourceType>;
+
+				using MeshClass = AbstractObject<
+					vertexCount,
+					triangleCount,
+					VertexSourceType,
+					TriangleSourceType,
+					frustumCulling,
+					faceCulling,
+					AlbedoSourceType,
+					MaterialSourceType>;
+
+				static constexpr uint8_t WeightShifts = GetBitShifts(UFRACTION8_1X);
+
+			protected:
+				using BaseClass::Vertices;
+				using BaseClass::Primitives;
+				using BaseClass::TriangleCount;
+				using BaseClass::VertexCount;
+				using BaseClass::FusedCameraTransform;
+
+			public:
+				/// <summary>
+				/// Bone palette, indexed by the skin bones. Must stay valid for the frame.
+				/// </summary>
+				const transform16_rotate_translate_t* Bones = nullptr;
+
+			protected:
+				SkinSourceType& SkinSource;
+
+			private:
+				// Vertices were loaded this frame and there's a palette to apply.
+				bool Skinning = false;
+
+			public:
+				SkinnedTriangleObject(VertexSourceType& vertexSource,
+					TriangleSourceType& triangleSource,
+					SkinSourceType& skinSource,
+					AlbedoSourceType& albedoSource = const_cast<AlbedoSourceType&>(PrimitiveSources::Albedo::FullAlbedoSourceInstance),
+					MaterialSourceType& materialSource = const_cast<MaterialSourceType&>(PrimitiveSources::Material::DiffuseMaterialSourceInstance))
+					: BaseClass(vertexSource, triangleSource, albedoSource, materialSource)
+					, SkinSource(skinSource)
+				{
+				}
+
+				/// <summary>
+				/// Object pass:
+				/// - Always loads the bind pose vertices, the fused vertex path would skip skinning.
+				/// </summary>
+				virtual void ObjectShade(const frustum_t& frustum)
+				{
+					FusedCameraTransform = false;
+					MeshClass::ObjectShade(frustum);
+					BaseClass::SelectObjectLights();
+
+					// Object culled, vertices aren't loaded.
+					Skinning = Bones != nullptr
+						&& TriangleCount > 0
+						&& Primitives[0] >= 0;
+				}
+
+				/// <summary>
+				/// Vertex pass: replaces the bind pose vertex with the weighted sum of its bone transforms.
+				/// Single bone vertices skip the blend.
+				/// </summary>
+				/// <returns>false to continue; true when all vertices are skinned.</returns>
+				virtual bool VertexShade(const primitive_index_t vertexIndex)
+				{
+					if (!Skinning
+						|| vertexIndex >= VertexCount)
+						return true;
+
+					const skin_vertex_t skin = SkinSource.GetSkin(vertexIndex);
+					const vertex16_t bind = Vertices[vertexIndex];
+
+					if (skin.weights[0] >= UFRACTION8_1X)
+					{
+						Vertices[vertexIndex] = ApplyBone(Bones[skin.bones[0]], bind);
+
+						return false;
+					}
+
+					int32_t x = 0;
+					int32_t y = 0;
+					int32_t z = 0;
+					for (uint_fast8_t i = 0; i < 4; i++)
+					{
+						const ufraction8_t weight = skin.weights[i];
+						if (weight == 0)
+							continue;
+
+						const vertex16_t vertex = ApplyBone(Bones[skin.bones[i]], bind);
+						x += static_cast<int32_t>(weight) * vertex.x;
+						y += static_cast<int32_t>(weight) * vertex.y;
+						z += static_cast<int32_t>(weight) * vertex.z;
+					}
+
+					Vertices[vertexIndex].x = static_cast<int16_t>(SignedRightShift(x, WeightShifts));
+					Vertices[vertexIndex].y = static_cast<int16_t>(SignedRightShift(y, WeightShifts));
+					Vertices[vertexIndex].z = static_cast<int16_t>(SignedRightShift(z, WeightShifts));
+
+					return false;
+				}
+
+			private:
+				static vertex16_t ApplyBone(const transform16_rotate_translate_t& bone, vertex16_t vertex)
+				{
+					ApplyTransform(static_cast<const transform16_rotate_t&>(bone), vertex);
+					vertex.x += bone.Translation.x;
+					vertex.y += bone.Translation.y;
+					vertex.z += bone.Translation.z;
+
+					return vertex;
+				}
+			};
+
+			template<primitive_index_t vertexCount, primitive_index_t triangleCount,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling>
+			class SimpleStaticSkinnedTriangleObject : public SkinnedTriangleObject<
+				vertexCount,
+				triangleCount,
+				PrimitiveSources::Vertex::Static::Source,
+				PrimitiveSources::Triangle::Static::Source,
+				PrimitiveSources::Skin::Static::Source,
+				frustumCulling,
+				faceCulling,
+				PrimitiveSources::Albedo::Dynamic::SingleSource,
+				PrimitiveSources::Material::Dynamic::SingleSource>
+			{
+			private:
+				using Base = SkinnedTriangleObject<
+					vertexCount,
+					triangleCount,
+					PrimitiveSources::Vertex::Static::Source,
+					PrimitiveSources::Triangle::Static::Source,
+					PrimitiveSources::Skin::Static::Source,
+					frustumCulling,
+					faceCulling,
+					PrimitiveSources::Albedo::Dynamic::SingleSource,
+					PrimitiveSources::Material::Dynamic::SingleSource>;
+
+			private:
+				PrimitiveSources::Vertex::Static::Source VerticesSource;
+				PrimitiveSources::Triangle::Static::Source TrianglesSource;
+				PrimitiveSources::Skin::Static::Source SkinsSource;
+
+				PrimitiveSources::Albedo::Dynamic::SingleSource AlbedosSource{};
+				PrimitiveSources::Material::Dynamic::SingleSource MaterialsSource{};
+
+			public:
+				SimpleStaticSkinnedTriangleObject(const vertex16_t* vertices, const triangle_face_t* triangles, const skin_vertex_t* skins)
+					: Base(VerticesSource, TrianglesSource, SkinsSource, AlbedosSource, MaterialsSource)
+					, VerticesSource(vertices)
+					, TrianglesSource(triangles)
+					, SkinsSource(skins)
+				{
+				}
+
+				void SetAlbedo(const Rgb8::color_t albedo)
+				{
+					AlbedosSource.Albedo = albedo;
+				}
+
+				Rgb8::color_t GetAlbedo() const
+				{
+					return AlbedosSource.Albedo;
+				}
+
+				void SetMaterial(const material_t& material)
+				{
+					MaterialsSource.Material = material;
+				}
+
+				material_t GetMaterial() const
+				{
+					return MaterialsSource.Material;
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
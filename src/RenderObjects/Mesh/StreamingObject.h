@@ -0,0 +1,377 @@
+#ifndef _INTEGER_WORLD_RENDER_OBJECTS_MESH_STREAMING_OBJECT_h
+#define _INTEGER_WORLD_RENDER_OBJECTS_MESH_STREAMING_OBJECT_h
+
+#include "AbstractObject.h"
+
+namespace IntegerWorld
+{
+	namespace RenderObjects
+	{
+		namespace Mesh
+		{
+			/// <summary>
+			/// Low-RAM triangle mesh without a vertex working buffer, trades CPU for RAM.
+			/// - Only per-triangle depth and visibility are kept, vertices are streamed from the source (PROGMEM safe) on demand.
+			/// - WorldShade transforms triangle vertices to world space for primitive frustum culling.
+			/// - ScreenShade transforms and projects triangle vertices for face culling and depth.
+			/// - FragmentShade transforms and projects them again for the rasterizer, and lights the triangle then.
+			/// Shared vertices are transformed once per triangle that uses them, about 6 times for a closed mesh.
+			/// </summary>
+			template<primitive_index_t triangleCount,
+				typename VertexSourceType,
+				typename TriangleSourceType,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling,
+				typename AlbedoSourceType = PrimitiveSources::Albedo::Static::FullSource,
+				typename MaterialSourceType = PrimitiveSources::Material::DiffuseMaterialSource,
+				typename NormalSourceType = PrimitiveSources::Normal::Static::NoSource,
+				typename UvSourceType = PrimitiveSources::Uv::Static::NoSource>
+			class StreamingTriangleObject : public AbstractTransformObject
+			{
+			private:
+				using Base = AbstractTransformObject;
+
+			public:
+				using fragment_t = mesh_triangle_fragment_t;
+
+				/// <summary>
+				/// Mesh triangle fragment shader. If null, no fragments are shaded.
+				/// </summary>
+				IFragmentShader<mesh_triangle_fragment_t>* FragmentShader = nullptr;
+
+				/// <summary>
+				/// Scene's lighting shader. If null, no lighting is applied.
+				/// </summary>
+				ISceneShader* SceneShader = nullptr;
+
+				/// <summary>
+				/// Object-space bounding sphere radius around the object origin, before Resize.
+				/// 0 when unknown: object culling only tests the object origin and every primitive is frustum tested.
+				/// </summary>
+				uint16_t BoundingRadius = 0;
+
+			protected:
+				VertexSourceType& VertexSource;
+				TriangleSourceType& TriangleSource;
+				AlbedoSourceType& AlbedoSource;
+				MaterialSourceType& MaterialSource;
+				NormalSourceType& NormalSource;
+				UvSourceType& UvSource;
+
+			protected:
+				// Per-triangle depth, negative when culled.
+				int16_t Primitives[triangleCount]{};
+
+				primitive_index_t TriangleCount = triangleCount;
+
+			private:
+				// Fused object -> camera transform, composed on CameraTransform.
+				transform16_scale_rotate_translate_t CameraMeshTransform{};
+
+				// Frame projector, set on ScreenProject.
+				const ViewportProjector* Projector = nullptr;
+
+				// Bounding sphere is fully inside the frustum for this frame, primitive frustum tests are skipped.
+				bool PrimitivesInside = false;
+
+				// Scene lights reaching the object this frame.
+				object_lights_t ObjectLights{};
+
+			public:
+				StreamingTriangleObject(VertexSourceType& vertexSource,
+					TriangleSourceType& triangleSource,
+					AlbedoSourceType& albedoSource = const_cast<AlbedoSourceType&>(PrimitiveSources::Albedo::FullAlbedoSourceInstance),
+					MaterialSourceType& materialSource = const_cast<MaterialSourceType&>(PrimitiveSources::Material::DiffuseMaterialSourceInstance),
+					NormalSourceType& normalSource = const_cast<NormalSourceType&>(PrimitiveSources::Normal::NormalNoSourceInstance),
+					UvSourceType& uvSource = const_cast<UvSourceType&>(PrimitiveSources::Uv::NoUvSourceInstance))
+					: Base()
+					, VertexSource(vertexSource)
+					, TriangleSource(triangleSource)
+					, AlbedoSource(albedoSource)
+					, MaterialSource(materialSource)
+					, NormalSource(normalSource)
+					, UvSource(uvSource)
+				{
+				}
+
+				/// <summary>
+				/// Object pass:
+				/// - Applies object-level frustum culling and initializes primitive z flags, as the buffered mesh objects.
+				/// </summary>
+				virtual void ObjectShade(const frustum_t& frustum)
+				{
+					Base::ObjectShade(frustum);
+
+					int16_t zFlag = 0;
+					PrimitivesInside = false;
+
+					switch (frustumCulling)
+					{
+					case FrustumCullingEnum::ObjectCulling:
+					case FrustumCullingEnum::PrimitiveCulling:
+						if (BoundingRadius > 0)
+						{
+							const uint16_t radius = Scale(Resize, BoundingRadius);
+							if (!frustum.IsSphereInside(WorldPosition, radius))
+							{
+								zFlag = -VERTEX16_UNIT;
+							}
+							else
+							{
+								PrimitivesInside = frustum.IsSphereFullyInside(WorldPosition, radius);
+							}
+						}
+						else if (frustumCulling == FrustumCullingEnum::ObjectCulling
+							&& !frustum.IsPointInside(WorldPosition))
+						{
+							zFlag = -VERTEX16_UNIT;
+						}
+						break;
+					case FrustumCullingEnum::NoCulling:
+					default:
+						break;
+					};
+
+					if (IsOutOfRange())
+					{
+						zFlag = -VERTEX16_UNIT;
+					}
+
+					for (primitive_index_t i = 0; i < TriangleCount; i++)
+					{
+						Primitives[i] = zFlag;
+					}
+
+					if (SceneShader != nullptr)
+						SceneShader->SelectObjectLights(ObjectLights, WorldPosition, Scale(Resize, BoundingRadius));
+				}
+
+				// No vertex buffer to transform.
+				virtual bool WorldTransform(const primitive_index_t vertexIndex)
+				{
+					return true;
+				}
+
+				/// <summary>
+				/// World pass:
+				/// - Frustum culls primitives from their streamed world-space vertices.
+				/// Lighting is deferred to FragmentShade, there is no per-triangle color buffer.
+				/// </summary>
+				virtual bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex)
+				{
+					if (frustumCulling != FrustumCullingEnum::PrimitiveCulling
+						|| PrimitivesInside
+						|| primitiveIndex >= TriangleCount)
+						return true;
+
+					if (Primitives[primitiveIndex] < 0)
+						return false;
+
+					const auto triangle = TriangleSource.GetTriangle(primitiveIndex);
+					const uint8_t outcodeA = frustum.GetOutcode(GetWorldVertex(triangle.a));
+					const uint8_t outcodeB = frustum.GetOutcode(GetWorldVertex(triangle.b));
+					const uint8_t outcodeC = frustum.GetOutcode(GetWorldVertex(triangle.c));
+
+					if (IsOutcodeTriangleOutside(outcodeA, outcodeB, outcodeC))
+					{
+						Primitives[primitiveIndex] = -VERTEX16_UNIT;
+					}
+
+					return false;
+				}
+
+				virtual bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex)
+				{
+					CalculateObjectCameraTransform(CameraMeshTransform, MeshTransform, transform);
+
+					return true;
+				}
+
+				virtual bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex)
+				{
+					Projector = &screenProjector;
+
+					return true;
+				}
+
+				/// <summary>
+				/// Screen pass:
+				/// - Applies mesh culling mode (backface/frontface/none) using projected 2D winding of the streamed vertices.
+				/// - Emits a z key (average vertex z) for depth ordering when the primitive is visible.
+				/// </summary>
+				virtual bool ScreenShade(const primitive_index_t primitiveIndex)
+				{
+					if (primitiveIndex >= TriangleCount)
+						return true;
+
+					if (Primitives[primitiveIndex] < 0)
+						return false;
+
+					const auto triangle = TriangleSource.GetTriangle(primitiveIndex);
+					const vertex16_t a = GetScreenVertex(triangle.a);
+					const vertex16_t b = GetScreenVertex(triangle.b);
+					const vertex16_t c = GetScreenVertex(triangle.c);
+
+					if (faceCulling != FaceCullingEnum::NoCulling)
+					{
+						const int32_t signedArea = (static_cast<int32_t>(b.x - a.x) * (c.y - a.y))
+							- (static_cast<int32_t>(b.y - a.y) * (c.x - a.x));
+
+						if ((faceCulling == FaceCullingEnum::BackfaceCulling && signedArea >= 0)
+							|| (faceCulling == FaceCullingEnum::FrontfaceCulling && signedArea <= 0))
+						{
+							Primitives[primitiveIndex] = -VERTEX16_UNIT;
+							return false;
+						}
+					}
+
+					Primitives[primitiveIndex] = AverageApproximate(a.z, b.z, c.z);
+
+					return false;
+				}
+
+				virtual void FragmentCollect(FragmentCollector& fragmentCollector)
+				{
+					for (primitive_index_t i = 0; i < TriangleCount; i++)
+					{
+						if (Primitives[i] >= 0)
+						{
+							fragmentCollector.AddFragment(i, Primitives[i]);
+						}
+					}
+				}
+
+				/// <summary>
+				/// Streams and projects the triangle vertices again, lights the triangle and calls the fragment shader.
+				/// </summary>
+				virtual void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex)
+				{
+					if (FragmentShader == nullptr)
+						return;
+
+					const auto triangle = TriangleSource.GetTriangle(primitiveIndex);
+
+					mesh_triangle_fragment_t fragment{};
+					fragment.index = primitiveIndex;
+					fragment.z = Primitives[primitiveIndex];
+					fragment.vertexA = GetScreenVertex(triangle.a);
+					fragment.vertexB = GetScreenVertex(triangle.b);
+					fragment.vertexC = GetScreenVertex(triangle.c);
+
+					Rgb8::color_t primitiveColor = Rgb8::WHITE;
+					if (AlbedoSourceType::HasAlbedos())
+					{
+						primitiveColor = AlbedoSource.GetAlbedo(primitiveIndex);
+					}
+
+					if (SceneShader != nullptr)
+					{
+						primitiveColor = GetTriangleLitColor(*SceneShader, ObjectLights, MaterialSource, NormalSource, MeshTransform, primitiveIndex,
+							primitiveColor, GetWorldVertex(triangle.a), GetWorldVertex(triangle.b), GetWorldVertex(triangle.c));
+					}
+
+					fragment.red = Rgb8::Red(primitiveColor);
+					fragment.green = Rgb8::Green(primitiveColor);
+					fragment.blue = Rgb8::Blue(primitiveColor);
+
+					if (UvSourceType::HasUvs())
+					{
+						const auto uvs = UvSource.GetUvs(primitiveIndex);
+						fragment.uvA = uvs.a;
+						fragment.uvB = uvs.b;
+						fragment.uvC = uvs.c;
+					}
+
+					FragmentShader->FragmentShade(rasterizer, fragment);
+				}
+
+				/// <summary>
+				/// Bounding sphere around Translation, see GetObjectBoundingSphere.
+				/// </summary>
+				virtual bool GetBoundingSphere(vertex16_t& center, uint16_t& radius)
+				{
+					return GetObjectBoundingSphere<frustumCulling>(Translation, Resize, BoundingRadius, center, radius);
+				}
+
+			private:
+				vertex16_t GetWorldVertex(const primitive_index_t vertexIndex) const
+				{
+					const auto source = VertexSource.GetVertex(vertexIndex);
+					vertex16_t vertex{ source.x, source.y, source.z };
+					ApplyTransform(MeshTransform, vertex);
+
+					return vertex;
+				}
+
+				vertex16_t GetScreenVertex(const primitive_index_t vertexIndex) const
+				{
+					const auto source = VertexSource.GetVertex(vertexIndex);
+					vertex16_t vertex{ source.x, source.y, source.z };
+					ApplyTransform(CameraMeshTransform, vertex);
+					Projector->Project(vertex);
+
+					return vertex;
+				}
+			};
+
+			template<primitive_index_t triangleCount,
+				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
+				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling>
+			class SimpleStaticStreamingTriangleObject : public StreamingTriangleObject<
+				triangleCount,
+				PrimitiveSources::Vertex::Static::Source,
+				PrimitiveSources::Triangle::Static::Source,
+				frustumCulling,
+				faceCulling,
+				PrimitiveSources::Albedo::Dynamic::SingleSource,
+				PrimitiveSources::Material::Dynamic::SingleSource>
+			{
+			private:
+				using Base = StreamingTriangleObject<
+					triangleCount,
+					PrimitiveSources::Vertex::Static::Source,
+					PrimitiveSources::Triangle::Static::Source,
+					frustumCulling,
+					faceCulling,
+					PrimitiveSources::Albedo::Dynamic::SingleSource,
+					PrimitiveSources::Material::Dynamic::SingleSource>;
+
+			private:
+				PrimitiveSources::Vertex::Static::Source VerticesSource;
+				PrimitiveSources::Triangle::Static::Source TrianglesSource;
+
+				PrimitiveSources::Albedo::Dynamic::SingleSource AlbedosSource{};
+				PrimitiveSources::Material::Dynamic::SingleSource MaterialsSource{};
+
+			public:
+				SimpleStaticStreamingTriangleObject(const vertex16_t* vertices, const triangle_face_t* triangles)
+					: Base(VerticesSource, TrianglesSource, AlbedosSource, MaterialsSource)
+					, VerticesSource(vertices)
+					, TrianglesSource(triangles)
+				{
+				}
+
+				void SetAlbedo(const Rgb8::color_t albedo)
+				{
+					AlbedosSource.Albedo = albedo;
+				}
+
+				Rgb8::color_t GetAlbedo() const
+				{
+					return AlbedosSource.Albedo;
+				}
+
+				void SetMaterial(const material_t& material)
+				{
+					MaterialsSource.Material = material;
+				}
+
+				material_t GetMaterial() const
+				{
+					return MaterialsSource.Material;
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
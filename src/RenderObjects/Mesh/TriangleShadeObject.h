@@ -9,8 +9,8 @@ namespace IntegerWorld
 	{
 		namespace Mesh
 		{
-			template<uint16_t vertexCount,
-				uint16_t triangleCount,
+			template<primitive_index_t vertexCount,
+				primitive_index_t triangleCount,
 				typename VertexSourceType,
 				typename TriangleSourceType,
 				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
@@ -50,6 +50,10 @@ namespace IntegerWorld
 				using BaseClass::TriangleSource;
 				using BaseClass::TriangleCount;
 				using BaseClass::MeshTransform;
+				using BaseClass::FusedCameraTransform;
+				using BaseClass::IsTriangleOutside;
+				using BaseClass::SetVerticesUsed;
+				using BaseClass::IsTriangleFaceCulled;
 				using BaseClass::AlbedoSource;
 				using BaseClass::MaterialSource;
 				using BaseClass::NormalSource;
@@ -72,8 +76,8 @@ namespace IntegerWorld
 				// Per-triangle lit albedo colors.
 				CompactRgb8List<triangleCount> LightBuffer{};
 
-				// Reusable triangle fragment.
-				mesh_triangle_fragment_t Fragment{};
+				// Scene lights reaching the object this frame.
+				object_lights_t ObjectLights{};
 
 			public:
 				TriangleShadeObject(VertexSourceType& vertexSource,
@@ -86,6 +90,30 @@ namespace IntegerWorld
 				{
 				}
 
+				/// <summary>
+				/// Object pass:
+				/// - Unlit objects don't use world-space vertices, so with FusedVertices they use the fused vertex path unless primitives need frustum culling.
+				/// </summary>
+				virtual void ObjectShade(const frustum_t& frustum)
+				{
+					FusedCameraTransform = BaseClass::FusedVertices && SceneShader == nullptr;
+
+					BaseClass::ObjectShade(frustum);
+
+					SelectObjectLights();
+				}
+
+			protected:
+				/// <summary>
+				/// Selects the scene lights that reach the object's bounding sphere, once per frame after WorldPosition is set.
+				/// </summary>
+				void SelectObjectLights()
+				{
+					if (SceneShader != nullptr)
+						SceneShader->SelectObjectLights(ObjectLights, BaseClass::WorldPosition, Scale(BaseClass::Resize, BaseClass::BoundingRadius));
+				}
+
+			public:
 				/// <summary>
 				/// World pass:
 				/// - Computes per-primitive world position (triangle center).
@@ -94,7 +122,7 @@ namespace IntegerWorld
 				/// - Applies the scene shader to light the primitive's albedo color.
 				/// </summary>
 				/// <returns>false to continue processing; true when no more primitives are available.</returns>
-				virtual bool WorldShade(const frustum_t& frustum, const uint16_t primitiveIndex)
+				virtual bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex)
 				{
 					if (primitiveIndex >= TriangleCount)
 						return true;
@@ -107,9 +135,7 @@ namespace IntegerWorld
 					switch (frustumCulling)
 					{
 					case FrustumCullingEnum::PrimitiveCulling:
-						if (!frustum.IsPointInside(Vertices[triangle.a])
-							&& !frustum.IsPointInside(Vertices[triangle.b])
-							&& !frustum.IsPointInside(Vertices[triangle.c]))
+						if (IsTriangleOutside(triangle))
 						{
 							Primitives[primitiveIndex] = -VERTEX16_UNIT;
 							return false;
@@ -120,6 +146,16 @@ namespace IntegerWorld
 						break;
 					};
 
+					// Face culling before lighting, with world-space vertices.
+					if (!FusedCameraTransform
+						&& IsTriangleFaceCulled(triangle, frustum.origin))
+					{
+						Primitives[primitiveIndex] = -VERTEX16_UNIT;
+						return false;
+					}
+
+					SetVerticesUsed(triangle);
+
 					Rgb8::color_t primitiveColor = Rgb8::WHITE;
 					if (AlbedoSourceType::HasAlbedos())
 					{
@@ -128,37 +164,9 @@ namespace IntegerWorld
 
 					if (SceneShader != nullptr)
 					{
-						material_t primitiveMaterial;
-						if (MaterialSourceType::HasMaterials())
-						{
-							primitiveMaterial = MaterialSource.GetMaterial(primitiveIndex);
-						}
-						else
-						{
-							primitiveMaterial = { 0, UFRACTION8_1X, 0, 0, 0, 0 };
-						}
-
-						vertex16_t worldNormal;
-						if (NormalSourceType::HasNormals())
-						{
-							// Rotate precomputed normal.
-							worldNormal = NormalSource.GetNormal(primitiveIndex);
-							ApplyTransformRotation(MeshTransform, worldNormal);
-						}
-						else
-						{
-							// Calculate triangle normal.
-							worldNormal = GetNormal16(Vertices[triangle.a], Vertices[triangle.b], Vertices[triangle.c]);
-							NormalizeVertex16(worldNormal);
-						}
-
-						const vertex16_t worldPosition{
-								AverageApproximate(Vertices[triangle.a].x, Vertices[triangle.b].x, Vertices[triangle.c].x),
-								AverageApproximate(Vertices[triangle.a].y, Vertices[triangle.b].y, Vertices[triangle.c].y),
-								AverageApproximate(Vertices[triangle.a].z, Vertices[triangle.b].z, Vertices[triangle.c].z) };
-
 						// Apply scene shader to get lit color.
-						primitiveColor = SceneShader->GetLitColor(primitiveColor, primitiveMaterial, worldPosition, worldNormal);
+						primitiveColor = GetTriangleLitColor(*SceneShader, ObjectLights, MaterialSource, NormalSource, MeshTransform, primitiveIndex,
+							primitiveColor, Vertices[triangle.a], Vertices[triangle.b], Vertices[triangle.c]);
 					}
 
 					// Cache the modulated color for the fragment shader.
@@ -173,39 +181,40 @@ namespace IntegerWorld
 				/// </summary>
 				/// <param name="rasterizer">Window rasterizer to receive the shaded triangle.</param>
 				/// <param name="primitiveIndex">Triangle index.</param>
-				virtual void FragmentShade(WindowRasterizer& rasterizer, const uint16_t primitiveIndex)
+				virtual void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex)
 				{
 					if (FragmentShader == nullptr)
 						return;
 
-					Fragment.index = primitiveIndex;
-					Fragment.z = Primitives[primitiveIndex];
+					mesh_triangle_fragment_t fragment{};
+					fragment.index = primitiveIndex;
+					fragment.z = Primitives[primitiveIndex];
 					{
 						const auto triangle = TriangleSource.GetTriangle(primitiveIndex);
-						Fragment.vertexA = Vertices[triangle.a];
-						Fragment.vertexB = Vertices[triangle.b];
-						Fragment.vertexC = Vertices[triangle.c];
+						fragment.vertexA = Vertices[triangle.a];
+						fragment.vertexB = Vertices[triangle.b];
+						fragment.vertexC = Vertices[triangle.c];
 					}
 					{
 						const auto color = LightBuffer.GetColor(primitiveIndex);
-						Fragment.red = Rgb8::Red(color);
-						Fragment.green = Rgb8::Green(color);
-						Fragment.blue = Rgb8::Blue(color);
+						fragment.red = Rgb8::Red(color);
+						fragment.green = Rgb8::Green(color);
+						fragment.blue = Rgb8::Blue(color);
 					}
 
 					if (UvSourceType::HasUvs())
 					{
 						const auto uvs = UvSource.GetUvs(primitiveIndex);
-						Fragment.uvA = uvs.a;
-						Fragment.uvB = uvs.b;
-						Fragment.uvC = uvs.c;
+						fragment.uvA = uvs.a;
+						fragment.uvB = uvs.b;
+						fragment.uvC = uvs.c;
 					}
 
-					FragmentShader->FragmentShade(rasterizer, Fragment);
+					FragmentShader->FragmentShade(rasterizer, fragment);
 				}
 			};
 
-			template<uint16_t vertexCount, uint16_t triangleCount,
+			template<primitive_index_t vertexCount, primitive_index_t triangleCount,
 				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
 				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling>
 			class SimpleStaticMeshTriangleObject : public TriangleShadeObject<
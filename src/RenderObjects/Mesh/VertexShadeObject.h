@@ -9,8 +9,8 @@ namespace IntegerWorld
 	{
 		namespace Mesh
 		{
-			template<uint16_t vertexCount,
-				uint16_t triangleCount,
+			template<primitive_index_t vertexCount,
+				primitive_index_t triangleCount,
 				typename VertexSourceType,
 				typename TriangleSourceType,
 				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
@@ -51,6 +51,10 @@ namespace IntegerWorld
 				using Base::TriangleCount;
 				using Base::VertexCount;
 				using Base::MeshTransform;
+				using Base::FusedCameraTransform;
+				using Base::ObjectCulled;
+				using Base::IsTriangleOutside;
+				using Base::SetVerticesUsed;
 				using Base::VertexSource;
 				using Base::AlbedoSource;
 				using Base::MaterialSource;
@@ -72,8 +76,8 @@ namespace IntegerWorld
 				// Per-triangle lit albedo colors.
 				CompactRgb8List<vertexCount> LightBuffer{};
 
-				// Reusable triangle fragment.
-				mesh_vertex_fragment_t Fragment{};
+				// Scene lights reaching the object this frame.
+				object_lights_t ObjectLights{};
 
 			public:
 				VertexShadeObject(VertexSourceType& vertexSource,
@@ -86,16 +90,34 @@ namespace IntegerWorld
 				{
 				}
 
+				/// <summary>
+				/// Object pass:
+				/// - Unlit objects don't use world-space vertices, so with FusedVertices they use the fused vertex path unless primitives need frustum culling.
+				/// </summary>
+				virtual void ObjectShade(const frustum_t& frustum)
+				{
+					FusedCameraTransform = Base::FusedVertices && SceneShader == nullptr;
+
+					Base::ObjectShade(frustum);
+
+					if (SceneShader != nullptr)
+						SceneShader->SelectObjectLights(ObjectLights, Base::WorldPosition, Scale(Base::Resize, Base::BoundingRadius));
+				}
+
 				/// <summary>
 				/// World pass:
 				/// - Computes per-primitive world position (vertices).
 				/// - Optionally culls primitives against the frustum.
 				/// - Computes or rotates the vertex world normal.
 				/// - Applies the scene shader to light the primitive's albedo color.
+				/// - Culled objects skip vertex lighting, their primitives are already flagged.
 				/// </summary>
 				/// <returns>false to continue processing; true when no more primitives are available.</returns>
-				virtual bool WorldShade(const frustum_t& frustum, const uint16_t primitiveIndex)
+				virtual bool WorldShade(const frustum_t& /*frustum*/, const primitive_index_t primitiveIndex)
 				{
+					if (ObjectCulled)
+						return true;
+
 					if (primitiveIndex < TriangleCount
 						&&
 						(frustumCulling == FrustumCullingEnum::NoCulling || (Primitives[primitiveIndex] >= 0)))
@@ -106,13 +128,15 @@ namespace IntegerWorld
 						{
 							const auto triangle = TriangleSource.GetTriangle(primitiveIndex);
 
-							// If the triangle center is outside the frustum, mark it as culled.
-							if (!frustum.IsPointInside(Vertices[triangle.a])
-								&& !frustum.IsPointInside(Vertices[triangle.b])
-								&& !frustum.IsPointInside(Vertices[triangle.c]))
+							// If the triangle is outside the frustum, mark it as culled.
+							if (IsTriangleOutside(triangle))
 							{
 								Primitives[primitiveIndex] = -VERTEX16_UNIT;
 							}
+							else
+							{
+								SetVerticesUsed(triangle);
+							}
 						}
 						break;
 						case FrustumCullingEnum::NoCulling:
@@ -161,7 +185,7 @@ namespace IntegerWorld
 							}
 
 							// Apply scene shader to get lit color.
-							primitiveColor = SceneShader->GetLitColor(primitiveColor, primitiveMaterial, Vertices[primitiveIndex], worldNormal);
+							primitiveColor = SceneShader->GetObjectLitColor(primitiveColor, primitiveMaterial, Vertices[primitiveIndex], worldNormal, ObjectLights);
 						}
 
 						// Cache the lit albedo color.
@@ -177,50 +201,51 @@ namespace IntegerWorld
 				/// </summary>
 				/// <param name="rasterizer">Window rasterizer to receive the shaded triangle.</param>
 				/// <param name="primitiveIndex">Triangle index.</param>
-				virtual void FragmentShade(WindowRasterizer& rasterizer, const uint16_t primitiveIndex)
+				virtual void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex)
 				{
 					if (FragmentShader == nullptr)
 						return;
 
 					const auto triangle = TriangleSource.GetTriangle(primitiveIndex);
 
-					Fragment.index = primitiveIndex;
-					Fragment.z = Primitives[primitiveIndex];
-					Fragment.vertexA = Vertices[triangle.a];
-					Fragment.vertexB = Vertices[triangle.b];
-					Fragment.vertexC = Vertices[triangle.c];
+					mesh_vertex_fragment_t fragment{};
+					fragment.index = primitiveIndex;
+					fragment.z = Primitives[primitiveIndex];
+					fragment.vertexA = Vertices[triangle.a];
+					fragment.vertexB = Vertices[triangle.b];
+					fragment.vertexC = Vertices[triangle.c];
 
 					{
 						auto color = LightBuffer.GetColor(triangle.a);
-						Fragment.redA = Rgb8::Red(color);
-						Fragment.greenA = Rgb8::Green(color);
-						Fragment.blueA = Rgb8::Blue(color);
+						fragment.redA = Rgb8::Red(color);
+						fragment.greenA = Rgb8::Green(color);
+						fragment.blueA = Rgb8::Blue(color);
 
 						color = LightBuffer.GetColor(triangle.b);
-						Fragment.redB = Rgb8::Red(color);
-						Fragment.greenB = Rgb8::Green(color);
-						Fragment.blueB = Rgb8::Blue(color);
+						fragment.redB = Rgb8::Red(color);
+						fragment.greenB = Rgb8::Green(color);
+						fragment.blueB = Rgb8::Blue(color);
 
 						color = LightBuffer.GetColor(triangle.c);
-						Fragment.redC = Rgb8::Red(color);
-						Fragment.greenC = Rgb8::Green(color);
-						Fragment.blueC = Rgb8::Blue(color);
+						fragment.redC = Rgb8::Red(color);
+						fragment.greenC = Rgb8::Green(color);
+						fragment.blueC = Rgb8::Blue(color);
 					}
 
 					if (UvSourceType::HasUvs())
 					{
 						const auto uvs = UvSource.GetUvs(primitiveIndex);
-						Fragment.uvA = uvs.a;
-						Fragment.uvB = uvs.b;
-						Fragment.uvC = uvs.c;
+						fragment.uvA = uvs.a;
+						fragment.uvB = uvs.b;
+						fragment.uvC = uvs.c;
 					}
 
-					FragmentShader->FragmentShade(rasterizer, Fragment);
+					FragmentShader->FragmentShade(rasterizer, fragment);
 				}
 			};
 
-			template<uint16_t vertexCount,
-				uint16_t triangleCount,
+			template<primitive_index_t vertexCount,
+				primitive_index_t triangleCount,
 				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
 				FaceCullingEnum faceCulling = FaceCullingEnum::BackfaceCulling>
 			class SimpleStaticMeshVertexObject : public VertexShadeObject<
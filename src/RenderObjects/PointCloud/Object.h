@@ -9,7 +9,7 @@ namespace IntegerWorld
 	{
 		namespace PointCloud
 		{
-			template<uint16_t vertexCount,
+			template<primitive_index_t vertexCount,
 				typename VertexSourceType,
 				FrustumCullingEnum frustumCulling = FrustumCullingEnum::PrimitiveCulling,
 				FaceCullingEnum faceCulling = FaceCullingEnum::NoCulling,
@@ -48,8 +48,6 @@ namespace IntegerWorld
 				// Per-triangle lit albedo colors.
 				CompactRgb8List<vertexCount> LightBuffer{};
 
-				point_cloud_fragment_t Fragment{};
-
 			public:
 				ShadeObject(VertexSourceType& vertexSource,
 					AlbedoSourceType& albedoSource = const_cast<AlbedoSourceType&>(PrimitiveSources::Albedo::FullAlbedoSourceInstance),
@@ -80,7 +78,12 @@ namespace IntegerWorld
 						break;
 					};
 
-					for (uint_fast16_t i = 0; i < VertexCount; i++)
+					if (Base::IsOutOfRange())
+					{
+						zFlag = -VERTEX16_UNIT;
+					}
+
+					for (primitive_index_t i = 0; i < VertexCount; i++)
 					{
 						auto vertex = VertexSource.GetVertex(i);
 						Vertices[i].x = vertex.x;
@@ -90,7 +93,7 @@ namespace IntegerWorld
 					}
 				}
 
-				virtual bool WorldShade(const frustum_t& frustum, const uint16_t primitiveIndex)
+				virtual bool WorldShade(const frustum_t& frustum, const primitive_index_t primitiveIndex)
 				{
 					if (primitiveIndex >= VertexCount)
 						return true;
@@ -155,7 +158,7 @@ namespace IntegerWorld
 					return false;
 				}
 
-				virtual bool CameraTransform(const transform16_camera_t& transform, const uint16_t vertexIndex)
+				virtual bool CameraTransform(const transform16_camera_t& transform, const primitive_index_t vertexIndex)
 				{
 					if (vertexIndex == 0)
 						ApplyCameraTransform(transform, ScreenPosition);
@@ -163,7 +166,7 @@ namespace IntegerWorld
 					return Base::CameraTransform(transform, vertexIndex);
 				}
 
-				virtual bool ScreenProject(ViewportProjector& screenProjector, const uint16_t vertexIndex)
+				virtual bool ScreenProject(ViewportProjector& screenProjector, const primitive_index_t vertexIndex)
 				{
 					if (vertexIndex == 0)
 						screenProjector.Project(ScreenPosition);
@@ -171,7 +174,7 @@ namespace IntegerWorld
 					return Base::ScreenProject(screenProjector, vertexIndex);
 				}
 
-				virtual bool ScreenShade(const uint16_t primitiveIndex)
+				virtual bool ScreenShade(const primitive_index_t primitiveIndex)
 				{
 					if (primitiveIndex >= VertexCount)
 						return true;
@@ -212,7 +215,7 @@ namespace IntegerWorld
 				/// </summary>
 				void FragmentCollect(FragmentCollector& fragmentCollector)
 				{
-					for (uint_fast16_t i = 0; i < VertexCount; i++)
+					for (primitive_index_t i = 0; i < VertexCount; i++)
 					{
 						if (Primitives[i] >= 0)
 						{
@@ -221,23 +224,24 @@ namespace IntegerWorld
 					}
 				}
 
-				virtual void FragmentShade(WindowRasterizer& rasterizer, const uint16_t primitiveIndex)
+				virtual void FragmentShade(WindowRasterizer& rasterizer, const primitive_index_t primitiveIndex)
 				{
 					if (FragmentShader == nullptr)
 						return;
 
-					Fragment.index = primitiveIndex;
-					Fragment.x = Vertices[primitiveIndex].x;
-					Fragment.y = Vertices[primitiveIndex].y;
-					Fragment.z = Primitives[primitiveIndex];
+					point_cloud_fragment_t fragment{};
+					fragment.index = primitiveIndex;
+					fragment.x = Vertices[primitiveIndex].x;
+					fragment.y = Vertices[primitiveIndex].y;
+					fragment.z = Primitives[primitiveIndex];
 					{
 						const auto color = LightBuffer.GetColor(primitiveIndex);
-						Fragment.red = Rgb8::Red(color);
-						Fragment.green = Rgb8::Green(color);
-						Fragment.blue = Rgb8::Blue(color);
+						fragment.red = Rgb8::Red(color);
+						fragment.green = Rgb8::Green(color);
+						fragment.blue = Rgb8::Blue(color);
 					}
 
-					FragmentShader->FragmentShade(rasterizer, Fragment);
+					FragmentShader->FragmentShade(rasterizer, fragment);
 				}
 			};
 		}
@@ -10,77 +10,47 @@ namespace IntegerWorld
 		namespace Abstract
 		{
 			/// <summary>
-			/// Lightweight base for scene shader implementations that compute lighting and effects.
-			///
-			/// This class provides a minimal per-fragment lifecycle and RGB accumulation helpers:
-			/// - StartShade(): initialize per-fragment state from an input color
-			/// - ColorMix(): add one or more lighting contributions with saturating arithmetic
-			/// - EndShade(): finalize and return the accumulated shaded color
+			/// Per-call RGB accumulator for scene shaders, kept on the caller's stack.
 			///
-			/// It does not implement ISceneShader::Shade()  derived shaders must implement
-			/// the Shade() overloads and orchestrate the lifecycle above.
-			/// 
-			/// Usage pattern in a derived shader:
-			/// 1) StartShade(color)            // capture base/albedo and reset accumulators
-			/// 2) For each light: compute its RGB contribution and ColorMix(r, g, b)
-			///    - Modulate contributions by material terms (Diffuse/Specular/etc.) and Fragment color as needed
-			/// 3) color = EndShade()           // write back the final shaded color
+			/// Usage pattern in a derived shader's GetLitColor():
+			/// 1) shade.Start(color)            // initialize from a base/ambient color (or Start() for black)
+			/// 2) For each light: compute its RGB contribution and shade.Add(r, g, b)
+			/// 3) return shade.End(alpha)       // produce the final shaded color
 			///
-			/// Notes:
-			/// - FragmentR/G/B store the base fragment color. EndShade() does not implicitly
-			///   blend with FragmentR/G/B; derived shaders must apply any desired base-color modulation explicitly.
-			/// - ColorMix() uses saturating adds (0..255) per component to avoid overflow when accumulating lights.
+			/// Add() uses saturating adds (0..255) per component to avoid overflow when accumulating lights.
 			/// </summary>
-			class Shader : public ISceneShader
+			struct shade_accumulator_t
 			{
-			protected:
-				///// <summary>
-				///// Components of the base fragment color (material/texture color)
-				///// </summary>
-				//Rgb8::component_t FragmentR{};
-				//Rgb8::component_t FragmentG{};
-				//Rgb8::component_t FragmentB{};
-
-				/// <summary>
-				/// Components of the accumulated shading result (lighting contribution)
-				/// </summary>
-				Rgb8::component_t ShadeR{};
-				Rgb8::component_t ShadeG{};
-				Rgb8::component_t ShadeB{};
-
-			public:
-				Shader() : ISceneShader() {}
+				Rgb8::component_t R;
+				Rgb8::component_t G;
+				Rgb8::component_t B;
 
-			protected:
 				/// <summary>
-				/// Initializes the per-fragment state with the given input color.
-				/// Captures the color into FragmentR/G/B and clears the accumulated ShadeR/G/B to black.
-				/// Call once at the start of each Shade(...) implementation.
+				/// Starts the accumulation from the given color.
 				/// </summary>
 				/// <param name="color">Input color for the fragment (e.g., texture or primitive color)</param>
-				void StartShade(const Rgb8::color_t& color)
+				void Start(const Rgb8::color_t color)
 				{
-
-					// Start with initial color as the base for shading.
-					ShadeR = Rgb8::Red(color);
-					ShadeG = Rgb8::Green(color);
-					ShadeB = Rgb8::Blue(color);
+					R = Rgb8::Red(color);
+					G = Rgb8::Green(color);
+					B = Rgb8::Blue(color);
 				}
 
-				void StartShade(const Rgb8::component_t r, const Rgb8::component_t g, const Rgb8::component_t b)
+				void Start(const Rgb8::component_t r, const Rgb8::component_t g, const Rgb8::component_t b)
 				{
-					// Start with initial color as the base for shading.
-					ShadeR = r;
-					ShadeG = g;
-					ShadeB = b;
+					R = r;
+					G = g;
+					B = b;
 				}
 
-				void StartShade()
+				/// <summary>
+				/// Starts the accumulation from black.
+				/// </summary>
+				void Start()
 				{
-					// Start with black.
-					ShadeR = 0;
-					ShadeG = 0;
-					ShadeB = 0;
+					R = 0;
+					G = 0;
+					B = 0;
 				}
 
 				/// <summary>
@@ -90,33 +60,43 @@ namespace IntegerWorld
 				/// <param name="rMix">Red contribution to add (0..255)</param>
 				/// <param name="gMix">Green contribution to add (0..255)</param>
 				/// <param name="bMix">Blue contribution to add (0..255)</param>
-				void AddShade(const Rgb8::component_t rMix, const Rgb8::component_t gMix, const Rgb8::component_t bMix)
+				void Add(const Rgb8::component_t rMix, const Rgb8::component_t gMix, const Rgb8::component_t bMix)
 				{
-					ShadeR = static_cast<uint8_t>(MinValue<uint16_t>(Rgb8::COMPONENT_MAX, static_cast<uint16_t>(ShadeR) + rMix));
-					ShadeG = static_cast<uint8_t>(MinValue<uint16_t>(Rgb8::COMPONENT_MAX, static_cast<uint16_t>(ShadeG) + gMix));
-					ShadeB = static_cast<uint8_t>(MinValue<uint16_t>(Rgb8::COMPONENT_MAX, static_cast<uint16_t>(ShadeB) + bMix));
+					R = static_cast<uint8_t>(MinValue<uint16_t>(Rgb8::COMPONENT_MAX, static_cast<uint16_t>(R) + rMix));
+					G = static_cast<uint8_t>(MinValue<uint16_t>(Rgb8::COMPONENT_MAX, static_cast<uint16_t>(G) + gMix));
+					B = static_cast<uint8_t>(MinValue<uint16_t>(Rgb8::COMPONENT_MAX, static_cast<uint16_t>(B) + bMix));
 				}
 
 				/// <summary>
-				/// Finalizes the shading process and returns the accumulated color.
-				/// Does not implicitly combine with the original FragmentR/G/B; the return value is whatever
-				/// was accumulated via ColorMix().
+				/// Returns the accumulated color.
 				/// </summary>
-				/// <returns>The final RGB color produced by the accumulation pipeline</returns>
-				Rgb8::color_t EndShade() const
+				Rgb8::color_t End() const
 				{
-					return Rgb8::Color(ShadeR, ShadeG, ShadeB);
+					return Rgb8::Color(R, G, B);
 				}
 
 				/// <summary>
-				/// Alpha-preserving overload of EndShade().
+				/// Alpha-preserving overload of End().
 				/// </summary>
 				/// <param name="alpha">Alpha component to include in the final color</param>
-				/// <returns>The final RGB color produced by the accumulation pipeline</returns>
-				Rgb8::color_t EndShade(const uint8_t alpha) const
+				Rgb8::color_t End(const uint8_t alpha) const
 				{
-					return Rgb8::Color(alpha, ShadeR, ShadeG, ShadeB);
+					return Rgb8::Color(alpha, R, G, B);
 				}
+			};
+
+			/// <summary>
+			/// Lightweight base for scene shader implementations that compute lighting and effects.
+			/// Provides fixed-point helpers shared by lighting shaders.
+			///
+			/// Scene shaders hold no per-call state: GetLitColor() is const and accumulates into a
+			/// stack-local shade_accumulator_t. A single shader instance may be shared by concurrent
+			/// object shading workers, as long as its configuration (lights, ambient) is not changed mid-frame.
+			/// </summary>
+			class Shader : public ISceneShader
+			{
+			public:
+				Shader() : ISceneShader() {}
 
 			protected:
 				/// <summary>
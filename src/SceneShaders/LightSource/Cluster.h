@@ -0,0 +1,226 @@
+#ifndef _INTEGER_WORLD_SCENE_SHADERS_LIGHT_SOURCE_CLUSTER_h
+#define _INTEGER_WORLD_SCENE_SHADERS_LIGHT_SOURCE_CLUSTER_h
+
+#include "Model.h"
+
+namespace IntegerWorld
+{
+	namespace SceneShaders
+	{
+		namespace LightSource
+		{
+			/// <summary>
+			/// Spatial clusters of point lights, for light LOD in the light source shader.
+			/// Lights are grouped without reordering the light array: the cluster light order lists
+			/// each cluster's light indices in turn, followed by the lights left out of clusters.
+			///
+			/// Usage:
+			/// 1) Build() when lights are placed, once for fixed lights or each frame for moving lights.
+			/// 2) Update() each frame the light colors change, to refresh the aggregate lights.
+			/// 3) Register with Shader::SetLightClusters().
+			/// </summary>
+			class LightClusters
+			{
+			protected:
+				light_cluster_t* Clusters;
+				uint8_t* Order;
+				const uint8_t MaxClusters;
+				const uint8_t MaxLights;
+
+				uint8_t ClusterCount = 0;
+				uint8_t ClusteredCount = 0;
+				uint8_t LightCount = 0;
+
+			public:
+				LightClusters(light_cluster_t* clusters, uint8_t* order, const uint8_t maxClusters, const uint8_t maxLights)
+					: Clusters(clusters)
+					, Order(order)
+					, MaxClusters(maxClusters)
+					, MaxLights(maxLights)
+				{
+				}
+
+				/// <summary>
+				/// Groups point lights within clusterSize of a seed light, greedily in light order.
+				/// A cluster only takes lights that keep its summed color within the channel range, so the aggregate light doesn't saturate.
+				/// Directional and Spot lights, and point lights without a neighbour, are left out of clusters.
+				/// Updates the aggregate lights.
+				/// </summary>
+				/// <param name="lights">Light array, as registered in the shader.</param>
+				/// <param name="lightCount">Count of lights in the array, up to the storage's max lights.</param>
+				/// <param name="clusterSize">Max distance of a cluster light from the cluster's seed light.</param>
+				void Build(const light_source_t* lights, const uint8_t lightCount, const uint16_t clusterSize)
+				{
+					ClusterCount = 0;
+					ClusteredCount = 0;
+					LightCount = MinValue(lightCount, MaxLights);
+
+					// Clustered light bits.
+					uint8_t clustered[(UINT8_MAX + 1) / 8]{};
+
+					const uint64_t clusterSquared = static_cast<uint64_t>(clusterSize) * clusterSize;
+
+					uint8_t placed = 0;
+					for (uint_fast8_t seed = 0; seed < LightCount && ClusterCount < MaxClusters; seed++)
+					{
+						if (lights[seed].Type != LightTypeEnum::Point
+							|| (clustered[seed >> 3] & (1 << (seed & 7))) != 0)
+							continue;
+
+						const uint8_t first = placed;
+						Order[placed++] = seed;
+						uint16_t red = Rgb8::Red(lights[seed].Color);
+						uint16_t green = Rgb8::Green(lights[seed].Color);
+						uint16_t blue = Rgb8::Blue(lights[seed].Color);
+						for (uint_fast8_t i = seed + 1; i < LightCount; i++)
+						{
+							if (lights[i].Type == LightTypeEnum::Point
+								&& (clustered[i >> 3] & (1 << (i & 7))) == 0
+								&& red + Rgb8::Red(lights[i].Color) <= Rgb8::COMPONENT_MAX
+								&& green + Rgb8::Green(lights[i].Color) <= Rgb8::COMPONENT_MAX
+								&& blue + Rgb8::Blue(lights[i].Color) <= Rgb8::COMPONENT_MAX
+								&& SquareDistance16(lights[seed].Position, lights[i].Position) <= clusterSquared)
+							{
+								red += Rgb8::Red(lights[i].Color);
+								green += Rgb8::Green(lights[i].Color);
+								blue += Rgb8::Blue(lights[i].Color);
+								clustered[i >> 3] |= 1 << (i & 7);
+								Order[placed++] = i;
+							}
+						}
+
+						if (placed - first < 2)
+						{
+							// Single lights stay individual.
+							placed = first;
+							continue;
+						}
+
+						clustered[seed >> 3] |= 1 << (seed & 7);
+						Clusters[ClusterCount].First = first;
+						Clusters[ClusterCount].Count = placed - first;
+						ClusterCount++;
+					}
+					ClusteredCount = placed;
+
+					// Lights left out of clusters.
+					for (uint_fast8_t i = 0; i < LightCount; i++)
+					{
+						if ((clustered[i >> 3] & (1 << (i & 7))) == 0)
+							Order[placed++] = i;
+					}
+
+					Update(lights);
+				}
+
+				/// <summary>
+				/// Updates each cluster's aggregate light from its lights' current positions, colors and ranges.
+				/// Colors brightened after Build() can saturate the summed color, Build() again to regroup.
+				/// </summary>
+				void Update(const light_source_t* lights)
+				{
+					for (uint_fast8_t c = 0; c < ClusterCount; c++)
+					{
+						light_cluster_t& cluster = Clusters[c];
+
+						int32_t x = 0, y = 0, z = 0;
+						uint16_t red = 0, green = 0, blue = 0;
+						uint32_t rangeSquaredMin = 0;
+						uint32_t rangeSquaredMax = 0;
+						for (uint_fast8_t i = cluster.First; i < cluster.First + cluster.Count; i++)
+						{
+							const light_source_t& light = lights[Order[i]];
+							x += light.Position.x;
+							y += light.Position.y;
+							z += light.Position.z;
+							red += Rgb8::Red(light.Color);
+							green += Rgb8::Green(light.Color);
+							blue += Rgb8::Blue(light.Color);
+							rangeSquaredMin = MaxValue(rangeSquaredMin, light.RangeSquaredMin);
+							rangeSquaredMax = MaxValue(rangeSquaredMax, light.RangeSquaredMax);
+						}
+
+						const vertex16_t centroid{
+							static_cast<int16_t>(x / cluster.Count),
+							static_cast<int16_t>(y / cluster.Count),
+							static_cast<int16_t>(z / cluster.Count) };
+
+						uint64_t extentSquared = 0;
+						for (uint_fast8_t i = cluster.First; i < cluster.First + cluster.Count; i++)
+						{
+							extentSquared = MaxValue(extentSquared, SquareDistance16(centroid, lights[Order[i]].Position));
+						}
+
+						// Rounded up, so objects outside the extent are outside every cluster light.
+						cluster.Extent = static_cast<uint16_t>(IntegerSignal::SquareRoot32(static_cast<uint32_t>(MinValue<uint64_t>(extentSquared, UINT32_MAX)))) + 1;
+
+						const uint32_t rangeMax = static_cast<uint32_t>(IntegerSignal::SquareRoot32(rangeSquaredMax)) + 1 + cluster.Extent;
+
+						cluster.Light.Position = centroid;
+						cluster.Light.Direction = { 0, 0, 0 };
+						cluster.Light.RangeSquaredMin = rangeSquaredMin;
+						cluster.Light.RangeSquaredMax = static_cast<uint32_t>(MinValue<uint64_t>(static_cast<uint64_t>(rangeMax) * rangeMax, UINT32_MAX));
+						cluster.Light.Color = Rgb8::Color(
+							static_cast<uint8_t>(MinValue<uint16_t>(red, Rgb8::COMPONENT_MAX)),
+							static_cast<uint8_t>(MinValue<uint16_t>(green, Rgb8::COMPONENT_MAX)),
+							static_cast<uint8_t>(MinValue<uint16_t>(blue, Rgb8::COMPONENT_MAX)));
+						cluster.Light.Parameter = 0;
+						cluster.Light.Type = LightTypeEnum::Point;
+					}
+				}
+
+				uint8_t GetClusterCount() const
+				{
+					return ClusterCount;
+				}
+
+				const light_cluster_t& GetCluster(const uint8_t index) const
+				{
+					return Clusters[index];
+				}
+
+				/// <summary>
+				/// Light count the clusters were built for.
+				/// </summary>
+				uint8_t GetLightCount() const
+				{
+					return LightCount;
+				}
+
+				/// <summary>
+				/// Number of entries in the cluster light order that belong to clusters, the rest are individual lights.
+				/// </summary>
+				uint8_t GetClusteredCount() const
+				{
+					return ClusteredCount;
+				}
+
+				/// <summary>
+				/// Light index at the given entry of the cluster light order.
+				/// </summary>
+				uint8_t GetOrderedLight(const uint8_t entry) const
+				{
+					return Order[entry];
+				}
+			};
+
+			/// <summary>
+			/// Light clusters with storage for up to maxLights lights and maxClusters clusters.
+			/// </summary>
+			template<uint8_t maxLights, uint8_t maxClusters>
+			class TemplateLightClusters : public LightClusters
+			{
+			private:
+				light_cluster_t ClusterStorage[maxClusters]{};
+				uint8_t OrderStorage[maxLights]{};
+
+			public:
+				TemplateLightClusters()
+					: LightClusters(ClusterStorage, OrderStorage, maxClusters, maxLights)
+				{
+				}
+			};
+		}
+	}
+}
+#endif
\ No newline at end of file
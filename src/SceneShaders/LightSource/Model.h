@@ -102,6 +102,33 @@ namespace IntegerWorld
 				}
 			};
 
+			/// <summary>
+			/// Group of nearby point lights, replaced by a single aggregate light for objects far from it.
+			/// </summary>
+			struct light_cluster_t
+			{
+				/// <summary>
+				/// Aggregate point light at the cluster centroid, with the summed color of its lights, which Build() keeps within the channel range.
+				/// Ranges are the largest of its lights, with the max range extended by Extent.
+				/// </summary>
+				light_source_t Light;
+
+				/// <summary>
+				/// Largest distance of a cluster light from the centroid.
+				/// </summary>
+				uint16_t Extent;
+
+				/// <summary>
+				/// First entry of the cluster's lights in the cluster light order.
+				/// </summary>
+				uint8_t First;
+
+				/// <summary>
+				/// Number of lights in the cluster.
+				/// </summary>
+				uint8_t Count;
+			};
+
 			/// <summary>
 			/// Creates a point light source with the specified parameters.
 			/// Point light emits light equally in all directions from a single position with distance-based attenuation.
@@ -4,6 +4,7 @@
 // #define INTEGER_WORLD_LIGHTS_SHADER_DEBUG // Enable light component toggles in the scene lights shader.
 
 #include "../Abstract.h"
+#include "Cluster.h"
 
 namespace IntegerWorld
 {
@@ -35,10 +36,23 @@ namespace IntegerWorld
 				bool Specular = true;
 				bool Fresnel = true;
 #endif
+			private:
+				/// <summary>
+				/// Light-invariant view terms of a lit point, computed once per call rather than per light.
+				/// </summary>
+				struct surface_view_t
+				{
+					vertex16_t vector; // Normalized view vector (V).
+					ufraction16_t fresnel; // Fresnel transfer (positive material Fresnel) or scale (negative).
+					bool hasFresnel;
+				};
+
 			private:
 				const light_source_t* Lights = nullptr;
 				uint8_t LightCount = 0; // Number of active lights.
 
+				const LightClusters* Clusters = nullptr;
+
 			public:
 				/// <summary>
 				/// Pointer to the world-space camera position. When unset, view direction is approximated
@@ -52,6 +66,13 @@ namespace IntegerWorld
 				/// </summary>
 				Rgb8::color_t AmbientLight{};
 
+				/// <summary>
+				/// Light LOD distance, in cluster extents: objects whose bounding sphere is farther from a cluster's centroid
+				/// get the cluster's aggregate light instead of its lights.
+				/// Lower distances trade more lighting accuracy for fewer lights per object.
+				/// </summary>
+				uint8_t ClusterDistance = 4;
+
 			public:
 				Shader() : Abstract::Shader() {}
 
@@ -67,6 +88,18 @@ namespace IntegerWorld
 					LightCount = lightCount * (Lights != nullptr);
 				}
 
+				/// <summary>
+				/// Registers light clusters built over the registered lights, for object light selection. nullptr disables light LOD.
+				/// Clusters are ignored when built for a different light count, or when lights and clusters don't fit the 8-bit light indices.
+				/// Clustering is lossy: an aggregate light shades as a single point at the centroid, so far objects are lit slightly differently.
+				/// LightClusters::Build() keeps each cluster's summed color within the channel range, so aggregates don't saturate.
+				/// Expect an image brightness error of a few percent against per-light shading (see the LightClusters host example).
+				/// </summary>
+				void SetLightClusters(const LightClusters* clusters)
+				{
+					Clusters = clusters;
+				}
+
 				/// <summary>
 				/// Computes the lit color for a fragment using material properties and active lights.
 				/// Workflow per light:
@@ -86,232 +119,468 @@ namespace IntegerWorld
 				virtual Rgb8::color_t GetLitColor(const Rgb8::color_t albedo,
 					const material_t& material,
 					const vertex16_t& position,
-					const vertex16_t& normal)
+					const vertex16_t& normal) const
+				{
+					Abstract::shade_accumulator_t shade;
+					StartShade(shade, albedo, material);
+
+					if (LightCount > 0)
+					{
+						surface_view_t view;
+						StartView(view, material, position, normal);
+
+						for (uint8_t i = 0; i < LightCount; i++)
+						{
+							AddLight(shade, view, Lights[i], albedo, material, position, normal);
+						}
+					}
+
+					// Preserve original alpha while returning accumulated RGB.
+					return shade.End(Rgb8::Alpha(albedo));
+				}
+
+				/// <summary>
+				/// Selects the Point and Spot lights whose range reaches the object's bounding sphere, and all Directional lights.
+				/// Lights are dropped only when out of range for every point in the sphere, so the lit color is the same as GetLitColor.
+				/// With light clusters, objects beyond ClusterDistance get a cluster's aggregate light in place of its lights.
+				/// Falls back to all lights without a radius or when more lights reach the object than fit the list.
+				/// </summary>
+				virtual void SelectObjectLights(object_lights_t& lights, const vertex16_t& center, const uint16_t radius) const
+				{
+					lights.count = OBJECT_LIGHTS_ALL;
+					if (radius == 0)
+						return;
+
+					uint8_t count = 0;
+					if (HasClusters())
+					{
+						// Aggregate lights are indexed after the lights.
+						for (uint8_t c = 0; c < Clusters->GetClusterCount(); c++)
+						{
+							const light_cluster_t& cluster = Clusters->GetCluster(c);
+							if (IsClusterFar(cluster, center, radius))
+							{
+								if (!SelectLight(lights, count, cluster.Light, LightCount + c, center, radius))
+									return;
+							}
+							else
+							{
+								for (uint8_t i = cluster.First; i < cluster.First + cluster.Count; i++)
+								{
+									const uint8_t index = Clusters->GetOrderedLight(i);
+									if (!SelectLight(lights, count, Lights[index], index, center, radius))
+										return;
+								}
+							}
+						}
+
+						for (uint8_t i = Clusters->GetClusteredCount(); i < LightCount; i++)
+						{
+							const uint8_t index = Clusters->GetOrderedLight(i);
+							if (!SelectLight(lights, count, Lights[index], index, center, radius))
+								return;
+						}
+					}
+					else
+					{
+						for (uint8_t i = 0; i < LightCount; i++)
+						{
+							if (!SelectLight(lights, count, Lights[i], i, center, radius))
+								return;
+						}
+					}
+					lights.count = count;
+				}
+
+				/// <summary>
+				/// GetLitColor over the lights selected for the object.
+				/// </summary>
+				virtual Rgb8::color_t GetObjectLitColor(const Rgb8::color_t albedo,
+					const material_t& material,
+					const vertex16_t& position,
+					const vertex16_t& normal,
+					const object_lights_t& lights) const
+				{
+					if (lights.count == OBJECT_LIGHTS_ALL)
+						return GetLitColor(albedo, material, position, normal);
+
+					Abstract::shade_accumulator_t shade;
+					StartShade(shade, albedo, material);
+
+					if (lights.count > 0)
+					{
+						surface_view_t view;
+						StartView(view, material, position, normal);
+
+						for (uint8_t i = 0; i < lights.count; i++)
+						{
+							const uint8_t index = lights.indices[i];
+							if (index < LightCount)
+							{
+								AddLight(shade, view, Lights[index], albedo, material, position, normal);
+							}
+							else if (HasClusters())
+							{
+								// Lights may have been replaced since selection, so the aggregate index is checked.
+								if (index - LightCount < Clusters->GetClusterCount())
+									AddLight(shade, view, Clusters->GetCluster(index - LightCount).Light, albedo, material, position, normal);
+							}
+						}
+					}
+
+					return shade.End(Rgb8::Alpha(albedo));
+				}
+
+			private:
+				/// <summary>
+				/// Initializes the shading accumulator with ambient * material.Rough (acts as diffuse baseline) and the emissive component.
+				/// </summary>
+				void StartShade(Abstract::shade_accumulator_t& shade, const Rgb8::color_t albedo, const material_t& material) const
 				{
-					// Initialize shading accumulator with ambient * material.Rough (acts as diffuse baseline).
 #if defined(INTEGER_WORLD_LIGHTS_SHADER_DEBUG)
 					if (Ambient)
 					{
-						StartShade(Fraction(material.Rough, Rgb8::Red(AmbientLight)),
+						shade.Start(Fraction(material.Rough, Rgb8::Red(AmbientLight)),
 							Fraction(material.Rough, Rgb8::Green(AmbientLight)),
 							Fraction(material.Rough, Rgb8::Blue(AmbientLight)));
 					}
 					else
 					{
-						StartShade(); // Debug path: start at black.
+						shade.Start(); // Debug path: start at black.
 					}
 #else
-					StartShade(Fraction(material.Rough, Rgb8::Red(AmbientLight)),
+					shade.Start(Fraction(material.Rough, Rgb8::Red(AmbientLight)),
 						Fraction(material.Rough, Rgb8::Green(AmbientLight)),
 						Fraction(material.Rough, Rgb8::Blue(AmbientLight)));
 #endif
-					const Rgb8::component_t alpha = Rgb8::Alpha(albedo);
-					const Rgb8::component_t albedoR = Rgb8::Red(albedo);
-					const Rgb8::component_t albedoG = Rgb8::Green(albedo);
-					const Rgb8::component_t albedoB = Rgb8::Blue(albedo);
 
 					if (material.Emit != 0)
 					{
 						// Add emissive component (unaffected by lighting).
-						const Rgb8::component_t emitR = Fraction(material.Emit, albedoR);
-						const Rgb8::component_t emitG = Fraction(material.Emit, albedoG);
-						const Rgb8::component_t emitB = Fraction(material.Emit, albedoB);
-						AddShade(emitR, emitG, emitB);
+						const Rgb8::component_t emitR = Fraction(material.Emit, Rgb8::Red(albedo));
+						const Rgb8::component_t emitG = Fraction(material.Emit, Rgb8::Green(albedo));
+						const Rgb8::component_t emitB = Fraction(material.Emit, Rgb8::Blue(albedo));
+						shade.Add(emitR, emitG, emitB);
 					}
+				}
+
+				/// <summary>
+				/// Sets the view terms shared by all lights, when the camera position is known.
+				/// Without it, V depends on the light and is set per light.
+				/// </summary>
+				void StartView(surface_view_t& view, const material_t& material, const vertex16_t& position, const vertex16_t& normal) const
+				{
+					if (CameraPosition != nullptr)
+					{
+						SetView(view, { static_cast<int16_t>(CameraPosition->x - position.x),
+							static_cast<int16_t>(CameraPosition->y - position.y),
+							static_cast<int16_t>(CameraPosition->z - position.z) },
+							material, normal);
+					}
+				}
+
+				/// <summary>
+				/// Normalizes the view vector (V) and computes the Fresnel term from VN.
+				/// Positive Fresnel: adds energy to specular, subtracts from diffuse.
+				/// Negative Fresnel: scales both diffuse and specular uniformly (inversion style).
+				/// </summary>
+				void SetView(surface_view_t& view, const vertex16_t& viewVector, const material_t& material, const vertex16_t& normal) const
+				{
+					view.vector = viewVector;
+					NormalizeVertex16(view.vector);
+					view.fresnel = 0;
+					view.hasFresnel = false;
+
+					// Fresnel precomputation only if material sets a non-zero fresnel control.
+					if (material.Fresnel == 0)
+						return;
+
+#if defined(INTEGER_WORLD_LIGHTS_SHADER_DEBUG)
+					if (!Fresnel)
+						return;
+#endif
+					const int32_t dotFresnel = AbsValue(DotProduct16(view.vector, normal)); // |VN|
+					ufraction16_t fresnel = DotProductToFraction(dotFresnel);
+					// Convert to edge emphasis: 1 - clamp(VN)
+					fresnel = UFRACTION16_1X - MinValue<ufraction16_t>(fresnel, UFRACTION16_1X);
+					if (fresnel == 0)
+						return;
+
+					// Focus fresnel based on material gloss.
+					fresnel = Interpolate(material.Gloss, fresnel, FocusFraction<FocusFresnel>(fresnel));
+
+					if (material.Fresnel > 0)
+					{
+						// Positive: energy transferred from diffuse to specular.
+						view.fresnel = Fraction(material.Fresnel, fresnel);
+					}
+					else
+					{
+						// Negative: global scaling (acts like grazing dampening).
+						const ufraction8_t materialScale = (static_cast<ufraction8_t>(-material.Fresnel) << 1);
+						view.fresnel = UFRACTION16_1X - Fraction(materialScale, fresnel);
+					}
+					view.hasFresnel = true;
+				}
+
+				/// <summary>
+				/// Accumulates one light's diffuse and specular contribution, see GetLitColor.
+				/// </summary>
+				void AddLight(Abstract::shade_accumulator_t& shade,
+					const surface_view_t& view,
+					const light_source_t& light,
+					const Rgb8::color_t albedo,
+					const material_t& material,
+					const vertex16_t& position,
+					const vertex16_t& normal) const
+				{
+					if (light.Color == 0)
+						return; // Skip black / disabled lights early.
+
+					const Rgb8::component_t albedoR = Rgb8::Red(albedo);
+					const Rgb8::component_t albedoG = Rgb8::Green(albedo);
+					const Rgb8::component_t albedoB = Rgb8::Blue(albedo);
 
 					vertex16_t illuminationVector; // L
-					vertex16_t viewVector;         // V
-					for (uint8_t i = 0; i < LightCount; i++)
+
+					// Per-light working fractions (all start at 0 and are built up).
+					ufraction16_t proximity = 0; // Distance attenuation.
+					ufraction16_t diffuse = 0; // Lambertian diffuse component.
+					ufraction16_t specular = 0; // Blinn-Phong component.
+
+					// Extract light RGB components (8-bit).
+					const Rgb8::component_t lightR = Rgb8::Red(light.Color);
+					const Rgb8::component_t lightG = Rgb8::Green(light.Color);
+					const Rgb8::component_t lightB = Rgb8::Blue(light.Color);
+
+					// Light * Albedo pre-scale (component-wise) using 8-bit fixed multiply >> 8.
+					const Rgb8::component_t litR = static_cast<Rgb8::component_t>((static_cast<uint16_t>(lightR) * albedoR) >> 8);
+					const Rgb8::component_t litG = static_cast<Rgb8::component_t>((static_cast<uint16_t>(lightG) * albedoG) >> 8);
+					const Rgb8::component_t litB = static_cast<Rgb8::component_t>((static_cast<uint16_t>(lightB) * albedoB) >> 8);
+
+					// Build illumination vector (L) per light type.
+					switch (light.Type)
 					{
-						const light_source_t& light = Lights[i];
-						if (light.Color == 0)
-							continue; // Skip black / disabled lights early.
-
-						// Per-light working fractions (all start at 0 and are built up).
-						ufraction16_t proximity = 0; // Distance attenuation.
-						ufraction16_t diffuse = 0; // Lambertian diffuse component.
-						ufraction16_t specular = 0; // Blinn-Phong component.
-						ufraction16_t fresnel = 0; // Fresnel modulation term.
-
-						// Extract light RGB components (8-bit).
-						const Rgb8::component_t lightR = Rgb8::Red(light.Color);
-						const Rgb8::component_t lightG = Rgb8::Green(light.Color);
-						const Rgb8::component_t lightB = Rgb8::Blue(light.Color);
-
-						// Light * Albedo pre-scale (component-wise) using 8-bit fixed multiply >> 8.
-						const Rgb8::component_t litR = static_cast<Rgb8::component_t>((static_cast<uint16_t>(lightR) * albedoR) >> 8);
-						const Rgb8::component_t litG = static_cast<Rgb8::component_t>((static_cast<uint16_t>(lightG) * albedoG) >> 8);
-						const Rgb8::component_t litB = static_cast<Rgb8::component_t>((static_cast<uint16_t>(lightB) * albedoB) >> 8);
-
-						// Build illumination vector (L) per light type.
-						switch (light.Type)
-						{
-						case LightTypeEnum::Point:
-						case LightTypeEnum::Spot:
-							// L = (light.Position - P)
-							illuminationVector = {
-								static_cast<int16_t>(light.Position.x - position.x),
-								static_cast<int16_t>(light.Position.y - position.y),
-								static_cast<int16_t>(light.Position.z - position.z) };
-
-							// Distance attenuation computed before normalization (range checks).
-							proximity = GetProximityFraction(light, illuminationVector);
-							if (proximity == 0)
-								continue; // Fully out of range.
-
-							NormalizeVertex16(illuminationVector);
-							break;
-						case LightTypeEnum::Directional:
-							// Direction assumed normalized; convert to illumination ray: L = -Direction
-							illuminationVector = {
-								static_cast<int16_t>(-light.Direction.x),
-								static_cast<int16_t>(-light.Direction.y),
-								static_cast<int16_t>(-light.Direction.z) };
-							break;
-						default:
-							continue; // Unknown type: skip.
-						}
+					case LightTypeEnum::Point:
+					case LightTypeEnum::Spot:
+						// L = (light.Position - P)
+						illuminationVector = {
+							static_cast<int16_t>(light.Position.x - position.x),
+							static_cast<int16_t>(light.Position.y - position.y),
+							static_cast<int16_t>(light.Position.z - position.z) };
+
+						// Distance attenuation computed before normalization (range checks).
+						proximity = GetProximityFraction(light, illuminationVector);
+						if (proximity == 0)
+							return; // Fully out of range.
+
+						// Skip lights that can't add a color LSB, before normalization.
+						// Light terms are attenuated by proximity, but positive Fresnel adds to specular unattenuated.
+						if (Fraction(GetReachFraction(view, material, proximity),
+							MaxValue(lightR, MaxValue(lightG, lightB))) == 0)
+							return; // Too faint.
+
+						NormalizeVertex16(illuminationVector);
+						break;
+					case LightTypeEnum::Directional:
+						// Direction assumed normalized; convert to illumination ray: L = -Direction
+						illuminationVector = {
+							static_cast<int16_t>(-light.Direction.x),
+							static_cast<int16_t>(-light.Direction.y),
+							static_cast<int16_t>(-light.Direction.z) };
+						break;
+					default:
+						return; // Unknown type: skip.
+					}
+
+					// View terms are shared by all lights. If camera unavailable, approximate head-on incidence.
+					surface_view_t lightView;
+					if (CameraPosition == nullptr)
+					{
+						SetView(lightView, {
+							static_cast<int16_t>(-illuminationVector.x),
+							static_cast<int16_t>(-illuminationVector.y),
+							static_cast<int16_t>(-illuminationVector.z) },
+							material, normal);
+					}
+					const surface_view_t& surfaceView = (CameraPosition != nullptr) ? view : lightView;
+
+					// Specular path only if surface has shine (inverse roughness > 0).
+					if (material.Shine > 0)
+					{
+						// Half-vector approximation: average L and V via arithmetic right shift.
+						vertex16_t halfVector = {
+							static_cast<int16_t>(SignedRightShift<int32_t>(static_cast<int32_t>(illuminationVector.x) + surfaceView.vector.x, 1)),
+							static_cast<int16_t>(SignedRightShift<int32_t>(static_cast<int32_t>(illuminationVector.y) + surfaceView.vector.y, 1)),
+							static_cast<int16_t>(SignedRightShift<int32_t>(static_cast<int32_t>(illuminationVector.z) + surfaceView.vector.z, 1)) };
+						NormalizeVertex16(halfVector);
+
+						const int32_t dotReflection = DotProduct16(halfVector, normal);
+						specular = DotProductToFraction(dotReflection);
+					}
 
-						// Build view vector (V). If camera unavailable, approximate head-on incidence.
-						if (CameraPosition != nullptr)
+					// Diffuse/specular weighting by light type.
+					switch (light.Type)
+					{
+					case LightTypeEnum::Point:
+						if (material.Rough > 0)
 						{
-							viewVector = { static_cast<int16_t>(CameraPosition->x - position.x),
-								static_cast<int16_t>(CameraPosition->y - position.y),
-								static_cast<int16_t>(CameraPosition->z - position.z) };
+							const int32_t dotIllumination = DotProduct16(illuminationVector, normal);
+							diffuse = Fraction(proximity, DotProductToFraction(dotIllumination));
 						}
-						else
+						if (specular > 0)
+							specular = Fraction(proximity,
+								Interpolate(material.Gloss, specular, FocusFraction<FocusSpecular>(specular)));
+						break;
+					case LightTypeEnum::Directional:
+						if (material.Rough > 0)
 						{
-							viewVector = {
-								static_cast<int16_t>(-illuminationVector.x),
-								static_cast<int16_t>(-illuminationVector.y),
-								static_cast<int16_t>(-illuminationVector.z) };
+							const int32_t dotIllumination = DotProduct16(illuminationVector, normal);
+							diffuse = DotProductToFraction(dotIllumination);
 						}
-						NormalizeVertex16(viewVector);
+						if (specular > 0)
+							specular = Interpolate(material.Gloss, specular, FocusFraction<FocusSpecular>(specular));
+						break;
+					case LightTypeEnum::Spot:
+					{
+						// Cone alignment: negative of DirectionL because L points from fragment to light.
+						const int32_t dotCone = -DotProduct16(light.Direction, illuminationVector);
+						ufraction16_t cone = DotProductToFraction(dotCone);
 
-						// Fresnel precomputation only if material sets a non-zero fresnel control.
-						// Positive Fresnel: adds energy to specular, subtracts from diffuse.
-						// Negative Fresnel: scales both diffuse and specular uniformly (inversion style).
-						if (material.Fresnel != 0)
-						{
-							const int32_t dotFresnel = AbsValue(DotProduct16(viewVector, normal)); // |VN|
-							fresnel = DotProductToFraction(dotFresnel);
-							// Convert to edge emphasis: 1 - clamp(VN)
-							fresnel = UFRACTION16_1X - MinValue<ufraction16_t>(fresnel, UFRACTION16_1X);
-						}
+						// Tighten cone with light.Parameter controlling interpolation.
+						cone = Interpolate(light.Parameter, cone, FocusFraction<FocusCone>(cone));
 
-						// Specular path only if surface has shine (inverse roughness > 0).
-						if (material.Shine > 0)
+						if (material.Rough > 0)
 						{
-							// Half-vector approximation: average L and V via arithmetic right shift.
-							vertex16_t halfVector = {
-								static_cast<int16_t>(SignedRightShift<int32_t>(static_cast<int32_t>(illuminationVector.x) + viewVector.x, 1)),
-								static_cast<int16_t>(SignedRightShift<int32_t>(static_cast<int32_t>(illuminationVector.y) + viewVector.y, 1)),
-								static_cast<int16_t>(SignedRightShift<int32_t>(static_cast<int32_t>(illuminationVector.z) + viewVector.z, 1)) };
-							NormalizeVertex16(halfVector);
-
-							const int32_t dotReflection = DotProduct16(halfVector, normal);
-							specular = DotProductToFraction(dotReflection);
+							const int32_t dotIllumination = DotProduct16(illuminationVector, normal);
+							diffuse = Fraction(proximity, Fraction(cone, DotProductToFraction(dotIllumination)));
 						}
 
-						// Diffuse/specular weighting by light type.
-						switch (light.Type)
+						if (specular > 0)
+							specular = Fraction(proximity, Fraction(cone,
+								Interpolate(material.Gloss, specular, FocusFraction<FocusSpecular>(specular))));
+					}
+					break;
+					default:
+						break;
+					}
+
+					// Fresnel redistribution.
+					if (surfaceView.hasFresnel)
+					{
+						if (material.Fresnel > 0)
 						{
-						case LightTypeEnum::Point:
-							if (material.Rough > 0)
-							{
-								const int32_t dotIllumination = DotProduct16(illuminationVector, normal);
-								diffuse = Fraction(proximity, DotProductToFraction(dotIllumination));
-							}
-							if (specular > 0)
-								specular = Fraction(proximity,
-									Interpolate(material.Gloss, specular, FocusFraction<FocusSpecular>(specular)));
-							break;
-						case LightTypeEnum::Directional:
-							if (material.Rough > 0)
-							{
-								const int32_t dotIllumination = DotProduct16(illuminationVector, normal);
-								diffuse = DotProductToFraction(dotIllumination);
-							}
-							if (specular > 0)
-								specular = Interpolate(material.Gloss, specular, FocusFraction<FocusSpecular>(specular));
-							break;
-						case LightTypeEnum::Spot:
+							// Positive: transfer energy from diffuse to specular.
+							specular = MinValue<int32_t>(static_cast<int32_t>(specular) + surfaceView.fresnel, UFRACTION16_1X);
+							diffuse = MaxValue<int32_t>(static_cast<int32_t>(diffuse) - surfaceView.fresnel, 0);
+						}
+						else
 						{
-							// Cone alignment: negative of DirectionL because L points from fragment to light.
-							const int32_t dotCone = -DotProduct16(light.Direction, illuminationVector);
-							ufraction16_t cone = DotProductToFraction(dotCone);
+							// Negative: global scaling.
+							specular = Fraction(surfaceView.fresnel, specular);
+							diffuse = Fraction(surfaceView.fresnel, diffuse);
+						}
+					}
 
-							// Tighten cone with light.Parameter controlling interpolation.
-							cone = Interpolate(light.Parameter, cone, FocusFraction<FocusCone>(cone));
+					// Final material application:
+					diffuse = Fraction(material.Rough, diffuse);
+					specular = Fraction(material.Shine, specular);
 
-							if (material.Rough > 0)
-							{
-								const int32_t dotIllumination = DotProduct16(illuminationVector, normal);
-								diffuse = Fraction(proximity, Fraction(cone, DotProductToFraction(dotIllumination)));
-							}
+					// Diffuse accumulation (Lambert * albedo * light color).
+#if defined(INTEGER_WORLD_LIGHTS_SHADER_DEBUG)
+					if (Diffuse)
+#endif
+						shade.Add(Fraction(diffuse, litR),
+							Fraction(diffuse, litG),
+							Fraction(diffuse, litB));
 
-							if (specular > 0)
-								specular = Fraction(proximity, Fraction(cone,
-									Interpolate(material.Gloss, specular, FocusFraction<FocusSpecular>(specular))));
-						}
-						break;
-						default:
-							break;
+					// Specular accumulation (light color tinted towards albedo using SpecularTint).
+#if defined(INTEGER_WORLD_LIGHTS_SHADER_DEBUG)
+					if (Specular)
+#endif
+						if (specular > 0)
+						{
+							const ufraction8_t specularTint = Fraction(specular, material.SpecularTint);
+							shade.Add(Fraction(specular, Interpolate(specularTint, lightR, litR)),
+								Fraction(specular, Interpolate(specularTint, lightG, litG)),
+								Fraction(specular, Interpolate(specularTint, lightB, litB)));
 						}
+				}
 
-						// Fresnel redistribution.
-#if defined(INTEGER_WORLD_LIGHTS_SHADER_DEBUG)
-						if (Fresnel)
-#endif					
-							if (fresnel > 0)
-							{
-								// Focus fresnel based on material gloss.
-								fresnel = Interpolate(material.Gloss, fresnel, FocusFraction<FocusFresnel>(fresnel));
+				/// <summary>
+				/// Upper bound of a Point or Spot light's diffuse and specular fractions, from its proximity.
+				/// Positive Fresnel is added unattenuated; without a camera position it isn't known before the light's V.
+				/// </summary>
+				ufraction16_t GetReachFraction(const surface_view_t& view, const material_t& material, const ufraction16_t proximity) const
+				{
+					if (material.Fresnel <= 0)
+						return proximity;
 
-								if (material.Fresnel > 0)
-								{
-									// Positive: transfer energy from diffuse to specular.
-									fresnel = Fraction(material.Fresnel, fresnel);
-									specular = MinValue<int32_t>(static_cast<int32_t>(specular) + fresnel, UFRACTION16_1X);
-									diffuse = MaxValue<int32_t>(static_cast<int32_t>(diffuse) - fresnel, 0);
-								}
-								else if (material.Fresnel < 0)
-								{
-									// Negative: global scaling (acts like grazing dampening).
-									const ufraction8_t materialScale = (static_cast<ufraction8_t>(-material.Fresnel) << 1);
-									fresnel = UFRACTION16_1X - Fraction(materialScale, fresnel);
-									specular = Fraction(fresnel, specular);
-									diffuse = Fraction(fresnel, diffuse);
-								}
-							}
+					if (CameraPosition == nullptr)
+						return UFRACTION16_1X;
 
-						// Final material application:
-						diffuse = Fraction(material.Rough, diffuse);
-						specular = Fraction(material.Shine, specular);
+					return static_cast<ufraction16_t>(MinValue<uint32_t>(UFRACTION16_1X, static_cast<uint32_t>(proximity) + view.fresnel));
+				}
 
-						// Diffuse accumulation (Lambert * albedo * light color).
-#if defined(INTEGER_WORLD_LIGHTS_SHADER_DEBUG)
-						if (Diffuse)
-#endif
-							AddShade(Fraction(diffuse, litR),
-								Fraction(diffuse, litG),
-								Fraction(diffuse, litB));
+				/// <summary>
+				/// Light clusters are registered and match the registered lights.
+				/// </summary>
+				bool HasClusters() const
+				{
+					return Clusters != nullptr
+						&& Clusters->GetLightCount() == LightCount
+						&& (static_cast<uint16_t>(LightCount) + Clusters->GetClusterCount()) < OBJECT_LIGHTS_ALL;
+				}
 
-						// Specular accumulation (light color tinted towards albedo using SpecularTint).
-#if defined(INTEGER_WORLD_LIGHTS_SHADER_DEBUG)
-						if (Specular)
-#endif
-							if (specular > 0)
-							{
-								const ufraction8_t specularTint = Fraction(specular, material.SpecularTint);
-								AddShade(Fraction(specular, Interpolate(specularTint, lightR, litR)),
-									Fraction(specular, Interpolate(specularTint, lightG, litG)),
-									Fraction(specular, Interpolate(specularTint, lightB, litB)));
-							}
+				/// <summary>
+				/// Adds the light to the object's list if it can reach the sphere.
+				/// </summary>
+				/// <returns>false when the list is full.</returns>
+				static bool SelectLight(object_lights_t& lights, uint8_t& count, const light_source_t& light, const uint8_t index, const vertex16_t& center, const uint16_t radius)
+				{
+					if (light.Color == 0)
+						return true;
+
+					switch (light.Type)
+					{
+					case LightTypeEnum::Point:
+					case LightTypeEnum::Spot:
+						if (!IsLightInRange(light, center, radius))
+							return true;
+						break;
+					case LightTypeEnum::Directional:
+						break;
+					default:
+						return true;
 					}
 
-					// Preserve original alpha while returning accumulated RGB.
-					return EndShade(alpha);
+					if (count >= INTEGER_WORLD_OBJECT_LIGHTS_MAX)
+						return false;
+
+					lights.indices[count++] = index;
+
+					return true;
+				}
+
+				/// <summary>
+				/// True if the sphere is beyond ClusterDistance cluster extents from the cluster's centroid.
+				/// </summary>
+				bool IsClusterFar(const light_cluster_t& cluster, const vertex16_t& center, const uint16_t radius) const
+				{
+					const uint32_t distance = static_cast<uint32_t>(radius) + static_cast<uint32_t>(ClusterDistance) * cluster.Extent;
+
+					return SquareDistance16(center, cluster.Light.Position) > static_cast<uint64_t>(distance) * distance;
+				}
+
+				/// <summary>
+				/// True if the light's range reaches any point of the sphere, i.e. distance < sqrt(RangeSquaredMax) + radius.
+				/// </summary>
+				static bool IsLightInRange(const light_source_t& light, const vertex16_t& center, const uint16_t radius)
+				{
+					// Rounded up range, so the test stays conservative.
+					const uint32_t reach = static_cast<uint32_t>(IntegerSignal::SquareRoot32(light.RangeSquaredMax)) + 1 + radius;
+
+					return SquareDistance16(center, light.Position) < static_cast<uint64_t>(reach) * reach;
 				}
 
 			protected: